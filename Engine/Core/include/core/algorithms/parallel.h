@@ -0,0 +1,341 @@
+#pragma once
+#include <core/algorithms/worker_pool.h>
+#include <core/containers/dvector.h>
+#include <core/memory/memory.h>
+#include <core/defines.h>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+
+namespace ds::core::algorithms
+{
+    /**
+     * Parallel algorithms over random access ranges such as DVector iterators
+     *
+     * Ranges are cut into grains of whole cache lines of elements, about four per thread, and
+     * the grains run on Worker_Pool. Neighbouring tasks never write to the same cache line of
+     * an aligned output. Ranges shorter than PARALLEL_MIN_ELEMENTS, or calls made while the pool
+     * is not initialized, run sequentially on the calling thread.
+     */
+
+    // Ranges below this many elements are not worth waking the workers for
+    inline constexpr ds_u64 PARALLEL_MIN_ELEMENTS = 4096;
+
+    // Grains handed out per participating thread, more grains balance uneven work better
+    inline constexpr ds_u64 PARALLEL_GRAINS_PER_THREAD = 4;
+
+    /**
+     * Get the grain size for splitting count elements of type T
+     * @return Elements per task, a multiple of the elements in one cache line
+     */
+    template<typename T>
+    ds_u64 grain_size(ds_u64 count)
+    {
+        constexpr ds_u64 LINE_ELEMENTS = sizeof(T) >= memory::CACHE_LINE_SIZE ? 1 : memory::CACHE_LINE_SIZE / sizeof(T);
+
+        ds_u64 tasks = static_cast<ds_u64>(Worker_Pool::Get_Concurrency()) * PARALLEL_GRAINS_PER_THREAD;
+        ds_u64 grain = (count + tasks - 1) / tasks;
+        return std::max<ds_u64>(LINE_ELEMENTS, (grain + LINE_ELEMENTS - 1) / LINE_ELEMENTS * LINE_ELEMENTS);
+    }
+
+    /**
+     * Call function(begin, end) on consecutive index ranges of at most grain elements
+     * covering [0, count), in parallel
+     */
+    template<typename Function>
+    void parallel_ranges(ds_u64 count, ds_u64 grain, Function&& function)
+    {
+        ds_u64 tasks = (count + grain - 1) / grain;
+        Worker_Pool::Run(tasks, [&](ds_u64 task) {
+            ds_u64 begin = task * grain;
+            function(begin, std::min(begin + grain, count));
+        });
+    }
+
+    // Whether a range of count elements should be split across the pool
+    inline bool should_parallelize(ds_u64 count)
+    {
+        return count >= PARALLEL_MIN_ELEMENTS && Worker_Pool::Get_Worker_Count() > 0;
+    }
+
+    /////////////////////////////////////////////////////////
+    // for_each / transform / reduce
+    /////////////////////////////////////////////////////////
+
+    /**
+     * Apply function to every element of [first, last)
+     * Elements are visited in no particular order
+     */
+    template<typename Iterator, typename Function>
+    void for_each(Iterator first, Iterator last, Function function)
+    {
+        using T = typename std::iterator_traits<Iterator>::value_type;
+        ds_u64 count = static_cast<ds_u64>(last - first);
+
+        if (!should_parallelize(count)) {
+            std::for_each(first, last, function);
+            return;
+        }
+
+        parallel_ranges(count, grain_size<T>(count), [&](ds_u64 begin, ds_u64 end) {
+            std::for_each(first + begin, first + end, function);
+        });
+    }
+
+    /**
+     * Write operation(x) for every x of [first, last) to the range starting at destination
+     * @return Iterator past the last element written
+     */
+    template<typename Input_Iterator, typename Output_Iterator, typename Operation>
+    Output_Iterator transform(Input_Iterator first, Input_Iterator last, Output_Iterator destination, Operation operation)
+    {
+        using T = typename std::iterator_traits<Output_Iterator>::value_type;
+        ds_u64 count = static_cast<ds_u64>(last - first);
+
+        if (!should_parallelize(count)) {
+            return std::transform(first, last, destination, operation);
+        }
+
+        // Grains follow the output type so tasks split on output cache lines
+        parallel_ranges(count, grain_size<T>(count), [&](ds_u64 begin, ds_u64 end) {
+            std::transform(first + begin, first + end, destination + begin, operation);
+        });
+
+        return destination + count;
+    }
+
+    /**
+     * Combine init and every element of [first, last) with operation
+     * operation must be associative, grains are combined in order so it needn't be commutative
+     */
+    template<typename Iterator, typename T, typename Operation = std::plus<>>
+    T reduce(Iterator first, Iterator last, T init, Operation operation = {})
+    {
+        using Value = typename std::iterator_traits<Iterator>::value_type;
+        ds_u64 count = static_cast<ds_u64>(last - first);
+
+        if (!should_parallelize(count)) {
+            return std::accumulate(first, last, std::move(init), operation);
+        }
+
+        // One partial result per grain, each on its own cache line
+        struct alignas(memory::CACHE_LINE_SIZE) Partial
+        {
+            std::optional<T> value;
+        };
+
+        ds_u64 grain = grain_size<Value>(count);
+        containers::DVector<Partial> partials((count + grain - 1) / grain);
+
+        parallel_ranges(count, grain, [&](ds_u64 begin, ds_u64 end) {
+            T partial = *(first + begin);
+            for (ds_u64 i = begin + 1; i < end; i++) {
+                partial = operation(std::move(partial), *(first + i));
+            }
+            partials[begin / grain].value.emplace(std::move(partial));
+        });
+
+        for (Partial& partial : partials) {
+            init = operation(std::move(init), std::move(*partial.value));
+        }
+
+        return init;
+    }
+
+    /////////////////////////////////////////////////////////
+    // sort
+    /////////////////////////////////////////////////////////
+
+    /**
+     * Find how many of the first diagonal elements of a stable merge of a and b come from a
+     */
+    template<typename Iterator_A, typename Iterator_B, typename Compare>
+    ds_u64 merge_split(ds_u64 diagonal, Iterator_A a, ds_u64 a_count, Iterator_B b, ds_u64 b_count, Compare& compare)
+    {
+        ds_u64 low = diagonal > b_count ? diagonal - b_count : 0;
+        ds_u64 high = std::min(diagonal, a_count);
+
+        // Smallest i where b[diagonal - i - 1] sorts strictly before a[i], ties go to a
+        while (low < high) {
+            ds_u64 i = low + (high - low) / 2;
+            if (compare(*(b + (diagonal - i - 1)), *(a + i))) {
+                high = i;
+            }
+            else {
+                low = i + 1;
+            }
+        }
+
+        return low;
+    }
+
+    /**
+     * One bottom-up merge pass: merge neighbouring sorted runs of width elements from source
+     * into destination. Every merge is cut into grain sized output pieces so the whole pass
+     * runs in parallel, not just one task per pair of runs.
+     */
+    template<typename Source, typename Destination, typename Compare>
+    void merge_pass(Source source, Destination destination, ds_u64 count, ds_u64 width, ds_u64 grain, Compare& compare)
+    {
+        ds_u64 merge_count = (count + 2 * width - 1) / (2 * width);
+        ds_u64 pieces_per_merge = (2 * width + grain - 1) / grain;
+
+        Worker_Pool::Run(merge_count * pieces_per_merge, [&](ds_u64 task) {
+            ds_u64 low = (task / pieces_per_merge) * 2 * width;
+            ds_u64 middle = std::min(low + width, count);
+            ds_u64 high = std::min(low + 2 * width, count);
+
+            ds_u64 out_begin = (task % pieces_per_merge) * grain;
+            if (out_begin >= high - low) {
+                return;
+            }
+            ds_u64 out_end = std::min(out_begin + grain, high - low);
+
+            Source a = source + low;
+            Source b = source + middle;
+            ds_u64 a_count = middle - low;
+            ds_u64 b_count = high - middle;
+
+            ds_u64 a_begin = merge_split(out_begin, a, a_count, b, b_count, compare);
+            ds_u64 a_end = merge_split(out_end, a, a_count, b, b_count, compare);
+            ds_u64 b_begin = out_begin - a_begin;
+            ds_u64 b_end = out_end - a_end;
+
+            std::merge(std::make_move_iterator(a + a_begin), std::make_move_iterator(a + a_end),
+                std::make_move_iterator(b + b_begin), std::make_move_iterator(b + b_end),
+                destination + low + out_begin, compare);
+        });
+    }
+
+    /**
+     * Sort runs with run_sort in parallel, then merge them pairwise in parallel passes
+     * The value type must be default constructible for the merge buffer
+     */
+    template<typename Iterator, typename Compare, typename Run_Sort>
+    void merge_sort(Iterator first, Iterator last, Compare& compare, Run_Sort run_sort)
+    {
+        using T = typename std::iterator_traits<Iterator>::value_type;
+        ds_u64 count = static_cast<ds_u64>(last - first);
+        ds_u64 grain = grain_size<T>(count);
+
+        // Initial runs: one grain each
+        parallel_ranges(count, grain, [&](ds_u64 begin, ds_u64 end) {
+            run_sort(first + begin, first + end, compare);
+        });
+
+        containers::DVector<T> buffer(count);
+        T* scratch = buffer.data();
+        bool in_scratch = false;
+
+        for (ds_u64 width = grain; width < count; width *= 2) {
+            if (in_scratch) {
+                merge_pass(scratch, first, count, width, grain, compare);
+            }
+            else {
+                merge_pass(first, scratch, count, width, grain, compare);
+            }
+            in_scratch = !in_scratch;
+        }
+
+        if (in_scratch) {
+            parallel_ranges(count, grain, [&](ds_u64 begin, ds_u64 end) {
+                std::move(scratch + begin, scratch + end, first + begin);
+            });
+        }
+    }
+
+    /**
+     * Sort [first, last) in parallel with a merge sort
+     */
+    template<typename Iterator, typename Compare = std::less<>>
+    void sort(Iterator first, Iterator last, Compare compare = {})
+    {
+        if (!should_parallelize(static_cast<ds_u64>(last - first))) {
+            std::sort(first, last, compare);
+            return;
+        }
+
+        merge_sort(first, last, compare, [](auto begin, auto end, Compare& run_compare) {
+            std::sort(begin, end, run_compare);
+        });
+    }
+
+    /**
+     * Sort [first, last) in parallel, keeping the order of equal elements
+     */
+    template<typename Iterator, typename Compare = std::less<>>
+    void stable_sort(Iterator first, Iterator last, Compare compare = {})
+    {
+        if (!should_parallelize(static_cast<ds_u64>(last - first))) {
+            std::stable_sort(first, last, compare);
+            return;
+        }
+
+        // Runs are stable and merges take ties from the left run, so the whole sort is stable
+        merge_sort(first, last, compare, [](auto begin, auto end, Compare& run_compare) {
+            std::stable_sort(begin, end, run_compare);
+        });
+    }
+
+    /////////////////////////////////////////////////////////
+    // stable_partition
+    /////////////////////////////////////////////////////////
+
+    /**
+     * Move the elements satisfying predicate before the others, keeping relative order on both sides
+     * The value type must be default constructible for the scatter buffer
+     *
+     * @return Iterator to the first element of the second group
+     */
+    template<typename Iterator, typename Predicate>
+    Iterator stable_partition(Iterator first, Iterator last, Predicate predicate)
+    {
+        using T = typename std::iterator_traits<Iterator>::value_type;
+        ds_u64 count = static_cast<ds_u64>(last - first);
+
+        if (!should_parallelize(count)) {
+            return std::stable_partition(first, last, predicate);
+        }
+
+        ds_u64 grain = grain_size<T>(count);
+        ds_u64 tasks = (count + grain - 1) / grain;
+
+        // Evaluate the predicate once per element and count matches per grain
+        containers::DVector<ds_u8> matches(count);
+        containers::DVector<ds_u64> true_counts(tasks);
+        parallel_ranges(count, grain, [&](ds_u64 begin, ds_u64 end) {
+            ds_u64 matched = 0;
+            for (ds_u64 i = begin; i < end; i++) {
+                matches[i] = predicate(*(first + i)) ? 1 : 0;
+                matched += matches[i];
+            }
+            true_counts[begin / grain] = matched;
+        });
+
+        // Exclusive prefix sums give each grain its output offsets on both sides
+        containers::DVector<ds_u64> true_offsets(tasks);
+        ds_u64 total_true = 0;
+        for (ds_u64 t = 0; t < tasks; t++) {
+            true_offsets[t] = total_true;
+            total_true += true_counts[t];
+        }
+
+        containers::DVector<T> buffer(count);
+        parallel_ranges(count, grain, [&](ds_u64 begin, ds_u64 end) {
+            ds_u64 task = begin / grain;
+            ds_u64 true_index = true_offsets[task];
+            ds_u64 false_index = total_true + (begin - true_offsets[task]);
+            for (ds_u64 i = begin; i < end; i++) {
+                buffer[matches[i] ? true_index++ : false_index++] = std::move(*(first + i));
+            }
+        });
+
+        parallel_ranges(count, grain, [&](ds_u64 begin, ds_u64 end) {
+            std::move(buffer.begin() + begin, buffer.begin() + end, first + begin);
+        });
+
+        return first + total_true;
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include <core/defines.h>
+#include <atomic>
+#include <exception>
+#include <type_traits>
+
+namespace ds::core::algorithms
+{
+    /**
+     * Engine-owned pool of worker threads for fork-join parallelism
+     *
+     * Run() splits work into numbered tasks that the calling thread and the workers claim
+     * one at a time until all are done. The caller always takes part, so Run() also works
+     * from inside a task, and it falls back to running everything on the calling thread
+     * while the pool is not initialized.
+     *
+     * Like Memory, the pool is set up with Initialize() and torn down with Shutdown().
+     */
+    class Worker_Pool
+    {
+    public:
+        /**
+         * Start the worker threads
+         * @param worker_count Number of background threads, 0 for one less than the hardware threads
+         */
+        static void Initialize(ds_u32 worker_count = 0);
+
+        /**
+         * Stop and join the worker threads, no Run() may be in flight
+         */
+        static void Shutdown();
+
+        static bool Is_Initialized();
+
+        /**
+         * Get the number of background threads, 0 when not initialized
+         */
+        static ds_u32 Get_Worker_Count();
+
+        /**
+         * Get the number of threads taking part in a Run(), workers plus the caller
+         */
+        static ds_u32 Get_Concurrency() { return Get_Worker_Count() + 1; }
+
+        /**
+         * Call function(task_index) for every index in [0, task_count) across the pool
+         * Blocks until every task has finished. If a task throws, tasks not yet claimed are
+         * skipped and the first exception is rethrown here once every thread has left the job
+         *
+         * @param task_count Number of tasks
+         * @param function Callable taking a ds_u64 task index
+         */
+        template<typename Function>
+        static void Run(ds_u64 task_count, Function&& function)
+        {
+            using Callable = std::remove_reference_t<Function>;
+
+            if (task_count == 0) {
+                return;
+            }
+
+            if (task_count == 1 || Get_Worker_Count() == 0) {
+                for (ds_u64 i = 0; i < task_count; i++) {
+                    function(i);
+                }
+                return;
+            }
+
+            Job job;
+            job.invoke = [](void* context, ds_u64 task_index) { (*static_cast<Callable*>(context))(task_index); };
+            job.context = const_cast<void*>(static_cast<const void*>(&function));
+            job.task_count = task_count;
+            Run_Job(job);
+        }
+
+    private:
+        // One Run() call, shared by every thread working on it
+        struct Job
+        {
+            void (*invoke)(void* context, ds_u64 task_index) = nullptr;
+            void* context = nullptr;
+            ds_u64 task_count = 0;
+            std::atomic<ds_u64> next_task{ 0 };     ///< Next unclaimed task index
+            std::atomic<ds_u32> references{ 0 };    ///< Queued or running worker references
+            std::atomic<bool> failed{ false };      ///< Whether a task has thrown
+            std::exception_ptr exception;           ///< First exception thrown by a task
+        };
+
+        struct State;
+
+        static void Run_Job(Job& job);
+        static void Execute(Job& job);
+        static bool Help_One(State& state);
+        static void Worker_Loop(State* state);
+
+        inline static State* s_state = nullptr;
+    };
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <core/defines.h>
+#include <type_traits>
+#include <utility>
+
+namespace ds::core::containers
+{
+	/**
+	 * Marks types whose objects can be moved to a new address with a plain memory copy,
+	 * without running the move constructor and destructor.
+	 *
+	 * Trivially copyable types qualify automatically. Engine types that own resources but do
+	 * not keep pointers into themselves (handles, strings with external storage, ...) can opt in
+	 * with DS_DECLARE_TRIVIALLY_RELOCATABLE.
+	 *
+	 * @tparam T Type to check
+	 */
+	template <typename T>
+	struct ds_is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+	// Pairs relocate trivially when both members do, even though their assignment is user-provided
+	template <typename First, typename Second>
+	struct ds_is_trivially_relocatable<std::pair<First, Second>>
+		: std::bool_constant<ds_is_trivially_relocatable<First>::value && ds_is_trivially_relocatable<Second>::value> {};
+
+	template <typename T>
+	inline constexpr bool ds_is_trivially_relocatable_v = ds_is_trivially_relocatable<T>::value;
+}
+
+/**
+ * Opts a type into memcpy relocation in engine containers
+ * Must be used at global namespace scope
+ */
+#define DS_DECLARE_TRIVIALLY_RELOCATABLE(type) \
+	template <> \
+	struct ds::core::containers::ds_is_trivially_relocatable<type> : std::true_type {}
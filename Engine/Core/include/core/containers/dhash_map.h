@@ -0,0 +1,162 @@
+#pragma once
+#include <core/containers/dhash_table.h>
+#include <stdexcept>
+
+namespace ds::core::containers
+{
+	// Key extractor for map slots
+	struct Hash_Map_Key_Of
+	{
+		template <typename Pair>
+		const auto& operator()(const Pair& pair) const noexcept { return pair.first; }
+	};
+
+	/**
+	 * DHash_Map - Open addressing hash map
+	 *
+	 * Swiss table map with SIMD group probing, see Hash_Table. Elements are stored inline in
+	 * the table, so unlike std::unordered_map, rehashing and insertion invalidate iterators,
+	 * references and pointers to elements. Erasing only invalidates the erased element.
+	 *
+	 * Elements are std::pair<Key, Value>. The key of an element must not be modified
+	 * through an iterator.
+	 *
+	 * @tparam Key Key type
+	 * @tparam Value Mapped type
+	 * @tparam Hash Hash function object for Key
+	 * @tparam Equal Equality function object for Key
+	 * @tparam Allocator Allocator for std::pair<Key, Value>, must model memory::Ds_Allocator
+	 */
+	template <typename Key, typename Value,
+		typename Hash = std::hash<Key>,
+		typename Equal = std::equal_to<Key>,
+		typename Allocator = memory::Default_Allocator<std::pair<Key, Value>>>
+	class DHash_Map : public Hash_Table<Key, std::pair<Key, Value>, Hash_Map_Key_Of, Hash, Equal, Allocator>
+	{
+		using Base = Hash_Table<Key, std::pair<Key, Value>, Hash_Map_Key_Of, Hash, Equal, Allocator>;
+
+	public:
+		using mapped_type = Value;
+		using typename Base::value_type;
+		using typename Base::allocator_type;
+		using typename Base::iterator;
+		using typename Base::const_iterator;
+
+		using Base::Base;
+
+		DHash_Map() = default;
+
+		DHash_Map(std::initializer_list<value_type> init, const allocator_type& alloc = allocator_type())
+			: Base(alloc)
+		{
+			this->reserve(init.size());
+			for (const value_type& value : init) {
+				this->insert(value);
+			}
+		}
+
+		//====================
+		// Element Access
+		//====================
+
+		/**
+		 * Access the value for key, inserting a default constructed one if it is missing
+		 * @param key Key to look up
+		 * @return Reference to the mapped value
+		 */
+		Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+		Value& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+		/**
+		 * Access the value for key with checking
+		 * @param key Key to look up
+		 * @return Reference to the mapped value
+		 * @throws std::out_of_range if key is not in the map
+		 */
+		Value& at(const Key& key);
+		const Value& at(const Key& key) const;
+
+		//====================
+		// Modifiers
+		//====================
+
+		/**
+		 * Construct a value for key in place unless key is already present
+		 * Nothing is constructed from args when the key exists
+		 * @return Iterator to the element for key and whether it was inserted
+		 */
+		template <typename K, typename... Args>
+		std::pair<iterator, bool> try_emplace(K&& key, Args&&... args);
+
+		/**
+		 * Insert value for key, or assign it to the existing element
+		 * @return Iterator to the element for key and whether it was inserted
+		 */
+		template <typename K, typename V>
+		std::pair<iterator, bool> insert_or_assign(K&& key, V&& value);
+	};
+
+
+    // *********************************************************************** //
+    // ************************** IMPLEMENTATION ***************************** //
+    // *********************************************************************** //
+
+
+    /////////////////////////////////////////////////////////
+    // Element Access Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename Key, typename Value, typename Hash, typename Equal, typename Allocator>
+    Value& DHash_Map<Key, Value, Hash, Equal, Allocator>::at(const Key& key)
+    {
+        iterator it = this->find(key);
+        if (it == this->end()) {
+            throw std::out_of_range("DHash_Map::at - Key not found");
+        }
+        return it->second;
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Equal, typename Allocator>
+    const Value& DHash_Map<Key, Value, Hash, Equal, Allocator>::at(const Key& key) const
+    {
+        const_iterator it = this->find(key);
+        if (it == this->end()) {
+            throw std::out_of_range("DHash_Map::at - Key not found");
+        }
+        return it->second;
+    }
+
+    /////////////////////////////////////////////////////////
+    // Modifier Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename Key, typename Value, typename Hash, typename Equal, typename Allocator>
+    template <typename K, typename... Args>
+    std::pair<typename DHash_Map<Key, Value, Hash, Equal, Allocator>::iterator, bool>
+        DHash_Map<Key, Value, Hash, Equal, Allocator>::try_emplace(K&& key, Args&&... args)
+    {
+        auto [index, inserted] = this->find_or_prepare_insert(key);
+        if (inserted) {
+            memory::Allocator_Traits<Allocator>::construct(this->m_allocator, this->m_slots + index,
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        return { this->iterator_at(index), inserted };
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Equal, typename Allocator>
+    template <typename K, typename V>
+    std::pair<typename DHash_Map<Key, Value, Hash, Equal, Allocator>::iterator, bool>
+        DHash_Map<Key, Value, Hash, Equal, Allocator>::insert_or_assign(K&& key, V&& value)
+    {
+        auto result = try_emplace(std::forward<K>(key), std::forward<V>(value));
+        if (!result.second) {
+            result.first->second = std::forward<V>(value);
+        }
+
+        return result;
+    }
+
+} // namespace ds::core::containers
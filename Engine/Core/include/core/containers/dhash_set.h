@@ -0,0 +1,51 @@
+#pragma once
+#include <core/containers/dhash_table.h>
+
+namespace ds::core::containers
+{
+	// Key extractor for set slots, the element is its own key
+	struct Hash_Set_Key_Of
+	{
+		template <typename Key>
+		const Key& operator()(const Key& key) const noexcept { return key; }
+	};
+
+	/**
+	 * DHash_Set - Open addressing hash set
+	 *
+	 * Swiss table set with SIMD group probing, see Hash_Table. Insertion and rehashing
+	 * invalidate iterators and references to elements. Elements must not be modified
+	 * through an iterator.
+	 *
+	 * @tparam Key Element type
+	 * @tparam Hash Hash function object for Key
+	 * @tparam Equal Equality function object for Key
+	 * @tparam Allocator Allocator for Key, must model memory::Ds_Allocator
+	 */
+	template <typename Key,
+		typename Hash = std::hash<Key>,
+		typename Equal = std::equal_to<Key>,
+		typename Allocator = memory::Default_Allocator<Key>>
+	class DHash_Set : public Hash_Table<Key, Key, Hash_Set_Key_Of, Hash, Equal, Allocator>
+	{
+		using Base = Hash_Table<Key, Key, Hash_Set_Key_Of, Hash, Equal, Allocator>;
+
+	public:
+		using typename Base::value_type;
+		using typename Base::allocator_type;
+
+		using Base::Base;
+
+		DHash_Set() = default;
+
+		DHash_Set(std::initializer_list<Key> init, const allocator_type& alloc = allocator_type())
+			: Base(alloc)
+		{
+			this->reserve(init.size());
+			for (const Key& key : init) {
+				this->insert(key);
+			}
+		}
+	};
+
+} // namespace ds::core::containers
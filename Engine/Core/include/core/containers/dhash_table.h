@@ -0,0 +1,794 @@
+#pragma once
+#include <core/memory/allocator_interface.h>
+#include <core/memory/allocator_adapters.h>
+#include <core/memory/memory.h>
+#include <core/containers/container_traits.h>
+#include <core/defines.h>
+#include <bit>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#if defined(DS_SIMD_NEON) && defined(DS_ARCH_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace ds::core::containers
+{
+	/**
+	 * Control byte values for Hash_Table
+	 *
+	 * Every slot has one control byte. Full slots store the low 7 bits of their hash (H2),
+	 * so a whole group of slots can be filtered with a single compare before keys are touched.
+	 * Empty and deleted slots have the high bit set.
+	 */
+	enum Hash_Control : ds_i8
+	{
+		HASH_CONTROL_EMPTY   = -128, // 0b10000000
+		HASH_CONTROL_DELETED = -2    // 0b11111110
+	};
+
+	/**
+	 * Bit mask over the slots of a group, one set bit per matching slot
+	 * @tparam SHIFT log2 of the number of mask bits per slot
+	 */
+	template <ds_u32 SHIFT>
+	struct Hash_Group_Mask
+	{
+		ds_u64 bits;
+
+		explicit operator bool() const noexcept { return bits != 0; }
+
+		// Index of the first matching slot in the group
+		ds_u32 Lowest() const noexcept { return static_cast<ds_u32>(std::countr_zero(bits)) >> SHIFT; }
+
+		// Drop the first matching slot
+		void Clear_Lowest() noexcept { bits &= bits - 1; }
+	};
+
+#if defined(DS_SIMD_SSE2)
+	/**
+	 * 16 control bytes compared at once with SSE2
+	 */
+	struct Hash_Group
+	{
+		static constexpr ds_u64 WIDTH = 16;
+		using Mask = Hash_Group_Mask<0>;
+
+		__m128i ctrl;
+
+		explicit Hash_Group(const ds_i8* pos) noexcept
+			: ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+		Mask Match(ds_i8 h2) const noexcept
+		{
+			return Mask{ static_cast<ds_u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl))) };
+		}
+
+		Mask Match_Empty() const noexcept
+		{
+			return Match(HASH_CONTROL_EMPTY);
+		}
+
+		Mask Match_Empty_Or_Deleted() const noexcept
+		{
+			// Only empty and deleted bytes have their sign bit set
+			return Mask{ static_cast<ds_u32>(_mm_movemask_epi8(ctrl)) };
+		}
+	};
+#elif defined(DS_SIMD_NEON) && defined(DS_ARCH_ARM64)
+	/**
+	 * 16 control bytes compared at once with NEON
+	 * NEON has no movemask, so each lane is narrowed to a nibble of a 64 bit mask instead
+	 */
+	struct Hash_Group
+	{
+		static constexpr ds_u64 WIDTH = 16;
+		using Mask = Hash_Group_Mask<2>;
+
+		uint8x16_t ctrl;
+
+		explicit Hash_Group(const ds_i8* pos) noexcept
+			: ctrl(vld1q_u8(reinterpret_cast<const ds_u8*>(pos))) {}
+
+		static Mask To_Mask(uint8x16_t lanes) noexcept
+		{
+			uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(lanes), 4);
+			return Mask{ vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ull };
+		}
+
+		Mask Match(ds_i8 h2) const noexcept
+		{
+			return To_Mask(vceqq_u8(ctrl, vdupq_n_u8(static_cast<ds_u8>(h2))));
+		}
+
+		Mask Match_Empty() const noexcept
+		{
+			return Match(HASH_CONTROL_EMPTY);
+		}
+
+		Mask Match_Empty_Or_Deleted() const noexcept
+		{
+			return To_Mask(vcltzq_s8(vreinterpretq_s8_u8(ctrl)));
+		}
+	};
+#else
+	/**
+	 * 8 control bytes compared at once inside a 64 bit word
+	 * Match can report false positives, which the key comparison filters out afterwards
+	 */
+	struct Hash_Group
+	{
+		static constexpr ds_u64 WIDTH = 8;
+		using Mask = Hash_Group_Mask<3>;
+
+		static constexpr ds_u64 LSBS = 0x0101010101010101ull;
+		static constexpr ds_u64 MSBS = 0x8080808080808080ull;
+
+		ds_u64 ctrl;
+
+		explicit Hash_Group(const ds_i8* pos) noexcept
+		{
+			memory::Memory::Memcpy(&ctrl, pos, sizeof(ctrl));
+		}
+
+		Mask Match(ds_i8 h2) const noexcept
+		{
+			ds_u64 x = ctrl ^ (LSBS * static_cast<ds_u8>(h2));
+			return Mask{ (x - LSBS) & ~x & MSBS };
+		}
+
+		Mask Match_Empty() const noexcept
+		{
+			// Empty is the only value with bit 7 set and bit 1 clear
+			return Mask{ ctrl & ~(ctrl << 6) & MSBS };
+		}
+
+		Mask Match_Empty_Or_Deleted() const noexcept
+		{
+			return Mask{ ctrl & MSBS };
+		}
+	};
+#endif
+
+	/**
+	 * Hash_Table - Open addressing hash table shared by DHash_Map and DHash_Set
+	 *
+	 * Swiss table layout: slots live in one flat array followed by their control bytes, and
+	 * lookups probe a group of control bytes at a time (SSE2, NEON or a 64 bit word depending
+	 * on DS_SIMD_*). The table holds at most 7/8 of its capacity. Erased slots become
+	 * tombstones that are dropped on the next rehash.
+	 *
+	 * Slots and control bytes come from a single allocation made through Allocator, so any
+	 * engine allocator adapter for Slot can back the table.
+	 *
+	 * @tparam Key Key type
+	 * @tparam Slot Stored element type
+	 * @tparam Key_Of Function object returning the key of a slot
+	 * @tparam Hash Hash function object for Key
+	 * @tparam Equal Equality function object for Key
+	 * @tparam Allocator Allocator for Slot, must model memory::Ds_Allocator
+	 */
+	template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+	class Hash_Table
+	{
+		static_assert(memory::Ds_Allocator<Allocator>, "Hash_Table requires an allocator that models Ds_Allocator");
+		static_assert(std::is_same_v<typename Allocator::value_type, Slot>, "Hash_Table allocator must allocate the table's value_type");
+
+	public:
+		using key_type        = Key;
+		using value_type      = Slot;
+		using hasher          = Hash;
+		using key_equal       = Equal;
+		using allocator_type  = Allocator;
+		using size_type       = ds_u64;
+		using difference_type = ds_i64;
+		using reference       = value_type&;
+		using const_reference = const value_type&;
+
+		static constexpr size_type GROUP_WIDTH = Hash_Group::WIDTH;
+
+		/**
+		 * Forward iterator over the full slots
+		 */
+		template <bool IS_CONST>
+		class Table_Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type        = Slot;
+			using difference_type   = ds_i64;
+			using pointer           = std::conditional_t<IS_CONST, const Slot*, Slot*>;
+			using reference         = std::conditional_t<IS_CONST, const Slot&, Slot&>;
+
+			Table_Iterator() noexcept = default;
+			Table_Iterator(const ds_i8* ctrl, pointer slot, const ds_i8* ctrl_end) noexcept
+				: m_ctrl(ctrl), m_slot(slot), m_ctrl_end(ctrl_end)
+			{
+				Skip_Free_Slots();
+			}
+
+			// Const iterators can be made from mutable ones
+			template <bool OTHER_CONST, typename = std::enable_if_t<IS_CONST && !OTHER_CONST>>
+			Table_Iterator(const Table_Iterator<OTHER_CONST>& other) noexcept
+				: m_ctrl(other.m_ctrl), m_slot(other.m_slot), m_ctrl_end(other.m_ctrl_end) {}
+
+			reference operator*() const { return *m_slot; }
+			pointer operator->() const { return m_slot; }
+
+			Table_Iterator& operator++() { ++m_ctrl; ++m_slot; Skip_Free_Slots(); return *this; }
+			Table_Iterator operator++(int) { Table_Iterator tmp = *this; ++*this; return tmp; }
+
+			bool operator==(const Table_Iterator& other) const { return m_ctrl == other.m_ctrl; }
+			bool operator!=(const Table_Iterator& other) const { return m_ctrl != other.m_ctrl; }
+
+		private:
+			void Skip_Free_Slots() noexcept
+			{
+				while (m_ctrl != m_ctrl_end && *m_ctrl < 0) {
+					++m_ctrl;
+					++m_slot;
+				}
+			}
+
+			const ds_i8* m_ctrl = nullptr;
+			pointer m_slot = nullptr;
+			const ds_i8* m_ctrl_end = nullptr;
+
+			template <bool> friend class Table_Iterator;
+			friend class Hash_Table;
+		};
+
+		using iterator       = Table_Iterator<false>;
+		using const_iterator = Table_Iterator<true>;
+
+		//====================
+		// Constructors/Destructor
+		//====================
+
+		Hash_Table() = default;
+		explicit Hash_Table(const allocator_type& alloc) : m_allocator(alloc) {}
+		Hash_Table(const Hash_Table& other);
+		Hash_Table(Hash_Table&& other) noexcept;
+		~Hash_Table();
+
+		Hash_Table& operator=(const Hash_Table& other);
+		Hash_Table& operator=(Hash_Table&& other) noexcept;
+
+		//====================
+		// Iterators
+		//====================
+
+		iterator begin() noexcept { return iterator(m_ctrl, m_slots, m_ctrl + m_capacity); }
+		const_iterator begin() const noexcept { return const_iterator(m_ctrl, m_slots, m_ctrl + m_capacity); }
+		const_iterator cbegin() const noexcept { return begin(); }
+
+		iterator end() noexcept { return iterator(m_ctrl + m_capacity, m_slots + m_capacity, m_ctrl + m_capacity); }
+		const_iterator end() const noexcept { return const_iterator(m_ctrl + m_capacity, m_slots + m_capacity, m_ctrl + m_capacity); }
+		const_iterator cend() const noexcept { return end(); }
+
+		//====================
+		// Capacity
+		//====================
+
+		[[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+		size_type size() const noexcept { return m_size; }
+
+		/**
+		 * Get the number of slots in the table
+		 * @return Slot count, of which at most 7/8 are ever full
+		 */
+		size_type capacity() const noexcept { return m_capacity; }
+
+		ds_f32 load_factor() const noexcept
+		{
+			return m_capacity == 0 ? 0.0f : static_cast<ds_f32>(m_size) / static_cast<ds_f32>(m_capacity);
+		}
+
+		/**
+		 * Make room for count elements without further rehashing
+		 * @param count Number of elements to hold
+		 */
+		void reserve(size_type count);
+
+		/**
+		 * Rebuild the table with at least count slots, dropping tombstones
+		 * @param count Minimum slot count, 0 to only fit the current elements
+		 */
+		void rehash(size_type count);
+
+		//====================
+		// Lookup
+		//====================
+
+		iterator find(const Key& key);
+		const_iterator find(const Key& key) const;
+		bool contains(const Key& key) const { return find(key) != end(); }
+		size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+		//====================
+		// Modifiers
+		//====================
+
+		void clear() noexcept;
+
+		std::pair<iterator, bool> insert(const value_type& value);
+		std::pair<iterator, bool> insert(value_type&& value);
+
+		/**
+		 * Construct an element in place unless its key is already present
+		 * The element is built first to learn its key, use try_emplace on maps to avoid that
+		 */
+		template <typename... Args>
+		std::pair<iterator, bool> emplace(Args&&... args);
+
+		iterator erase(const_iterator pos);
+		size_type erase(const Key& key);
+		void swap(Hash_Table& other) noexcept;
+
+		allocator_type get_allocator() const { return m_allocator; }
+
+	protected:
+		/**
+		 * Find the slot for key, reserving an empty one if the key is missing
+		 * The caller must construct the element in a reserved slot
+		 * @return Slot index and whether it was reserved for a new element
+		 */
+		std::pair<size_type, bool> find_or_prepare_insert(const Key& key);
+
+		iterator iterator_at(size_type index) noexcept { return iterator(m_ctrl + index, m_slots + index, m_ctrl + m_capacity); }
+
+		Slot* m_slots = nullptr;      ///< Slot storage, control bytes follow the last slot
+		ds_i8* m_ctrl = nullptr;      ///< Control bytes, the first GROUP_WIDTH - 1 are mirrored past the end
+		size_type m_size = 0;         ///< Number of elements
+		size_type m_capacity = 0;     ///< Number of slots, 0 or a power of two >= GROUP_WIDTH
+		size_type m_growth_left = 0;  ///< Insertions into empty slots left before the table must grow
+
+		DS_NO_UNIQUE_ADDRESS hasher m_hash;
+		DS_NO_UNIQUE_ADDRESS key_equal m_equal;
+		DS_NO_UNIQUE_ADDRESS allocator_type m_allocator;
+
+	private:
+		using allocator_traits = memory::Allocator_Traits<Allocator>;
+
+		static constexpr bool IS_RELOCATABLE = ds_is_trivially_relocatable_v<Slot>;
+		static constexpr bool IS_TRIVIALLY_DESTRUCTIBLE = std::is_trivially_destructible_v<Slot>;
+
+		// Probe sequence over groups, triangular steps visit every group of a power of two table
+		struct Probe_Sequence
+		{
+			size_type offset;
+			size_type index = 0;
+			size_type mask;
+
+			Probe_Sequence(size_type hash, size_type mask) : offset(hash & mask), mask(mask) {}
+
+			size_type Slot_At(size_type lane) const { return (offset + lane) & mask; }
+			void Next() { index += GROUP_WIDTH; offset = (offset + index) & mask; }
+		};
+
+		// Spread the user hash so both the probe start and H2 get well mixed bits
+		size_type hash_of(const Key& key) const
+		{
+			ds_u64 hash = static_cast<ds_u64>(m_hash(key)) * 0x9E3779B97F4A7C15ull;
+			return hash ^ (hash >> 32);
+		}
+
+		static size_type H1(size_type hash) noexcept { return hash >> 7; }
+		static ds_i8 H2(size_type hash) noexcept { return static_cast<ds_i8>(hash & 0x7F); }
+
+		static size_type capacity_to_growth(size_type capacity) noexcept { return capacity - capacity / 8; }
+
+		// Slot count for the allocation, the control bytes are carved out of trailing slots
+		static size_type allocation_count(size_type capacity) noexcept
+		{
+			return capacity + (capacity + GROUP_WIDTH + sizeof(Slot) - 1) / sizeof(Slot);
+		}
+
+		void set_ctrl(size_type index, ds_i8 value) noexcept
+		{
+			m_ctrl[index] = value;
+			if (index < GROUP_WIDTH - 1) {
+				m_ctrl[m_capacity + index] = value;
+			}
+		}
+
+		size_type find_index(const Key& key) const;
+		size_type find_first_non_full(size_type hash) const;
+		size_type prepare_insert(size_type hash);
+		void resize(size_type new_capacity);
+		void destroy_slots() noexcept;
+		void release() noexcept;
+		void copy_from(const Hash_Table& other);
+		void take_from(Hash_Table& other) noexcept;
+
+		static constexpr size_type NOT_FOUND = ~size_type(0);
+	};
+
+
+    // *********************************************************************** //
+    // ************************** IMPLEMENTATION ***************************** //
+    // *********************************************************************** //
+
+
+    /////////////////////////////////////////////////////////
+    // Constructors and Destructor
+    /////////////////////////////////////////////////////////
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::Hash_Table(const Hash_Table& other)
+        : m_hash(other.m_hash), m_equal(other.m_equal), m_allocator(other.m_allocator)
+    {
+        copy_from(other);
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::Hash_Table(Hash_Table&& other) noexcept
+        : m_hash(std::move(other.m_hash)), m_equal(std::move(other.m_equal)), m_allocator(other.m_allocator)
+    {
+        take_from(other);
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::~Hash_Table()
+    {
+        release();
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>&
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::operator=(const Hash_Table& other)
+    {
+        if (this != &other) {
+            clear();
+            m_hash = other.m_hash;
+            m_equal = other.m_equal;
+            copy_from(other);
+        }
+
+        return *this;
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>&
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::operator=(Hash_Table&& other) noexcept
+    {
+        if (this != &other) {
+            release();
+            m_hash = std::move(other.m_hash);
+            m_equal = std::move(other.m_equal);
+            m_allocator = other.m_allocator;
+            take_from(other);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////
+    // Capacity Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    void Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::reserve(size_type count)
+    {
+        if (count > m_size + m_growth_left) {
+            rehash(count + (count + 6) / 7);
+        }
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    void Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::rehash(size_type count)
+    {
+        // Smallest power of two that holds count slots and keeps the current elements under the load limit
+        size_type required = count > m_size + m_size / 7 ? count : m_size + m_size / 7 + 1;
+        size_type new_capacity = GROUP_WIDTH;
+        while (new_capacity < required || capacity_to_growth(new_capacity) < m_size) {
+            new_capacity *= 2;
+        }
+
+        if (m_size == 0 && count == 0) {
+            release();
+            return;
+        }
+
+        resize(new_capacity);
+    }
+
+    /////////////////////////////////////////////////////////
+    // Lookup Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    typename Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::iterator
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::find(const Key& key)
+    {
+        size_type index = find_index(key);
+        return index == NOT_FOUND ? end() : iterator_at(index);
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    typename Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::const_iterator
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::find(const Key& key) const
+    {
+        size_type index = find_index(key);
+        return index == NOT_FOUND ? end() : const_iterator(m_ctrl + index, m_slots + index, m_ctrl + m_capacity);
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    typename Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::size_type
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::find_index(const Key& key) const
+    {
+        if (m_size == 0) {
+            return NOT_FOUND;
+        }
+
+        size_type hash = hash_of(key);
+        ds_i8 h2 = H2(hash);
+        Probe_Sequence probe(H1(hash), m_capacity - 1);
+
+        while (true) {
+            Hash_Group group(m_ctrl + probe.offset);
+
+            for (auto match = group.Match(h2); match; match.Clear_Lowest()) {
+                size_type index = probe.Slot_At(match.Lowest());
+                if (m_equal(Key_Of()(m_slots[index]), key)) {
+                    return index;
+                }
+            }
+
+            // An empty slot ends every probe sequence that could have placed the key further on
+            if (group.Match_Empty()) {
+                return NOT_FOUND;
+            }
+
+            probe.Next();
+        }
+    }
+
+    /////////////////////////////////////////////////////////
+    // Modifier Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    void Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::clear() noexcept
+    {
+        if (m_capacity == 0) {
+            return;
+        }
+
+        destroy_slots();
+        memory::Memory::Memset(m_ctrl, static_cast<ds_u8>(HASH_CONTROL_EMPTY), m_capacity + GROUP_WIDTH);
+        m_size = 0;
+        m_growth_left = capacity_to_growth(m_capacity);
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    std::pair<typename Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::iterator, bool>
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::insert(const value_type& value)
+    {
+        auto [index, inserted] = find_or_prepare_insert(Key_Of()(value));
+        if (inserted) {
+            allocator_traits::construct(m_allocator, m_slots + index, value);
+        }
+
+        return { iterator_at(index), inserted };
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    std::pair<typename Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::iterator, bool>
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::insert(value_type&& value)
+    {
+        auto [index, inserted] = find_or_prepare_insert(Key_Of()(value));
+        if (inserted) {
+            allocator_traits::construct(m_allocator, m_slots + index, std::move(value));
+        }
+
+        return { iterator_at(index), inserted };
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    template <typename... Args>
+    std::pair<typename Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::iterator, bool>
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::emplace(Args&&... args)
+    {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    typename Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::iterator
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::erase(const_iterator pos)
+    {
+        size_type index = static_cast<size_type>(pos.m_ctrl - m_ctrl);
+        DS_ASSERT(index < m_capacity && m_ctrl[index] >= 0, "Hash_Table::erase - Iterator does not point to an element");
+
+        allocator_traits::destroy(m_allocator, m_slots + index);
+
+        // Leave a tombstone so probe sequences passing through this slot keep going
+        set_ctrl(index, HASH_CONTROL_DELETED);
+        --m_size;
+
+        return iterator_at(index + 1);
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    typename Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::size_type
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::erase(const Key& key)
+    {
+        size_type index = find_index(key);
+        if (index == NOT_FOUND) {
+            return 0;
+        }
+
+        erase(const_iterator(m_ctrl + index, m_slots + index, m_ctrl + m_capacity));
+        return 1;
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    void Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::swap(Hash_Table& other) noexcept
+    {
+        std::swap(m_slots, other.m_slots);
+        std::swap(m_ctrl, other.m_ctrl);
+        std::swap(m_size, other.m_size);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_growth_left, other.m_growth_left);
+        std::swap(m_hash, other.m_hash);
+        std::swap(m_equal, other.m_equal);
+        std::swap(m_allocator, other.m_allocator);
+    }
+
+    /////////////////////////////////////////////////////////
+    // Helper Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    std::pair<typename Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::size_type, bool>
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::find_or_prepare_insert(const Key& key)
+    {
+        size_type index = find_index(key);
+        if (index != NOT_FOUND) {
+            return { index, false };
+        }
+
+        return { prepare_insert(hash_of(key)), true };
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    typename Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::size_type
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::find_first_non_full(size_type hash) const
+    {
+        Probe_Sequence probe(H1(hash), m_capacity - 1);
+
+        while (true) {
+            auto mask = Hash_Group(m_ctrl + probe.offset).Match_Empty_Or_Deleted();
+            if (mask) {
+                return probe.Slot_At(mask.Lowest());
+            }
+
+            probe.Next();
+        }
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    typename Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::size_type
+        Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::prepare_insert(size_type hash)
+    {
+        size_type index = m_capacity == 0 ? 0 : find_first_non_full(hash);
+
+        // Reusing a tombstone is always fine, taking an empty slot needs growth budget
+        if (m_capacity == 0 || (m_growth_left == 0 && m_ctrl[index] != HASH_CONTROL_DELETED)) {
+            // Mostly tombstones: rebuild at the same size, otherwise double
+            if (m_capacity > GROUP_WIDTH && m_size * 32 <= m_capacity * 25) {
+                resize(m_capacity);
+            }
+            else {
+                resize(m_capacity == 0 ? GROUP_WIDTH : m_capacity * 2);
+            }
+
+            index = find_first_non_full(hash);
+        }
+
+        if (m_ctrl[index] == HASH_CONTROL_EMPTY) {
+            --m_growth_left;
+        }
+
+        set_ctrl(index, H2(hash));
+        ++m_size;
+        return index;
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    void Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::resize(size_type new_capacity)
+    {
+        Slot* old_slots = m_slots;
+        ds_i8* old_ctrl = m_ctrl;
+        size_type old_capacity = m_capacity;
+
+        m_slots = m_allocator.allocate(allocation_count(new_capacity));
+        DS_ASSERT(m_slots, "Hash_Table - Failed to allocate table storage");
+        m_ctrl = reinterpret_cast<ds_i8*>(m_slots + new_capacity);
+        m_capacity = new_capacity;
+        memory::Memory::Memset(m_ctrl, static_cast<ds_u8>(HASH_CONTROL_EMPTY), new_capacity + GROUP_WIDTH);
+
+        // Move every element to its slot in the new table, tombstones are left behind
+        for (size_type i = 0; i < old_capacity; ++i) {
+            if (old_ctrl[i] < 0) {
+                continue;
+            }
+
+            size_type hash = hash_of(Key_Of()(old_slots[i]));
+            size_type index = find_first_non_full(hash);
+            set_ctrl(index, H2(hash));
+
+            if constexpr (IS_RELOCATABLE) {
+                memory::Memory::Memcpy(static_cast<void*>(m_slots + index), static_cast<const void*>(old_slots + i), sizeof(Slot));
+            }
+            else {
+                allocator_traits::construct(m_allocator, m_slots + index, std::move(old_slots[i]));
+                allocator_traits::destroy(m_allocator, old_slots + i);
+            }
+        }
+
+        m_growth_left = capacity_to_growth(new_capacity) - m_size;
+
+        if (old_slots) {
+            m_allocator.deallocate(old_slots, allocation_count(old_capacity));
+        }
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    void Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::destroy_slots() noexcept
+    {
+        if constexpr (!IS_TRIVIALLY_DESTRUCTIBLE) {
+            for (size_type i = 0; i < m_capacity; ++i) {
+                if (m_ctrl[i] >= 0) {
+                    allocator_traits::destroy(m_allocator, m_slots + i);
+                }
+            }
+        }
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    void Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::release() noexcept
+    {
+        if (m_slots) {
+            destroy_slots();
+            m_allocator.deallocate(m_slots, allocation_count(m_capacity));
+        }
+
+        m_slots = nullptr;
+        m_ctrl = nullptr;
+        m_size = 0;
+        m_capacity = 0;
+        m_growth_left = 0;
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    void Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::copy_from(const Hash_Table& other)
+    {
+        reserve(other.m_size);
+
+        for (size_type i = 0; i < other.m_capacity; ++i) {
+            if (other.m_ctrl[i] >= 0) {
+                size_type index = prepare_insert(hash_of(Key_Of()(other.m_slots[i])));
+                allocator_traits::construct(m_allocator, m_slots + index, other.m_slots[i]);
+            }
+        }
+    }
+
+    template <typename Key, typename Slot, typename Key_Of, typename Hash, typename Equal, typename Allocator>
+    void Hash_Table<Key, Slot, Key_Of, Hash, Equal, Allocator>::take_from(Hash_Table& other) noexcept
+    {
+        m_slots = other.m_slots;
+        m_ctrl = other.m_ctrl;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        m_growth_left = other.m_growth_left;
+
+        other.m_slots = nullptr;
+        other.m_ctrl = nullptr;
+        other.m_size = 0;
+        other.m_capacity = 0;
+        other.m_growth_left = 0;
+    }
+
+} // namespace ds::core::containers
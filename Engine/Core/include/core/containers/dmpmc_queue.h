@@ -0,0 +1,220 @@
+#pragma once
+#include <core/memory/allocator_interface.h>
+#include <core/memory/allocator_adapters.h>
+#include <core/memory/memory.h>
+#include <core/defines.h>
+#include <atomic>
+
+namespace ds::core::containers
+{
+	/**
+	 * DMPMC_Queue - Bounded lock-free multi producer, multi consumer queue
+	 *
+	 * Every cell carries a sequence number telling whether it is ready to be written or read
+	 * for a given lap around the buffer. Producers and consumers claim positions with a
+	 * compare-exchange on their own padded index, then hand the cell over by publishing its
+	 * next sequence, so a slow thread only ever holds up the single cell it claimed.
+	 *
+	 * Capacity is rounded up to a power of two. Cells come from Allocator, rebound to the
+	 * internal cell type, once at construction.
+	 *
+	 * @tparam T Type of the elements
+	 * @tparam Allocator Allocator for T, must model memory::Ds_Allocator and be rebindable
+	 *                   with memory::Rebind_Allocator
+	 */
+	template <typename T, typename Allocator = memory::Default_Allocator<T>>
+	class DMPMC_Queue
+	{
+		static_assert(memory::Ds_Allocator<Allocator>, "DMPMC_Queue requires an allocator that models Ds_Allocator");
+
+	public:
+		using value_type     = T;
+		using allocator_type = Allocator;
+		using size_type      = ds_u64;
+
+		/**
+		 * Create a queue
+		 * @param capacity Minimum number of elements the queue holds, at least 2
+		 * @param alloc Allocator for the cells
+		 */
+		explicit DMPMC_Queue(size_type capacity, const allocator_type& alloc = allocator_type());
+		~DMPMC_Queue();
+
+		DMPMC_Queue(const DMPMC_Queue&) = delete;
+		DMPMC_Queue& operator=(const DMPMC_Queue&) = delete;
+
+		/**
+		 * Construct an element at the back of the queue, from any thread
+		 * @return False if the queue is full, nothing is constructed then
+		 */
+		template <typename... Args>
+		bool try_emplace(Args&&... args);
+
+		bool try_push(const T& value) { return try_emplace(value); }
+		bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+		/**
+		 * Move the front element out of the queue, from any thread
+		 * @param out Receives the element
+		 * @return False if the queue is empty
+		 */
+		bool try_pop(T& out);
+
+		/**
+		 * Get the approximate number of elements, exact only while no other thread is
+		 * pushing or popping
+		 */
+		size_type size_approx() const noexcept
+		{
+			size_type enqueue = m_enqueue_index.load(std::memory_order_relaxed);
+			size_type dequeue = m_dequeue_index.load(std::memory_order_relaxed);
+			return enqueue > dequeue ? enqueue - dequeue : 0;
+		}
+
+		size_type capacity() const noexcept { return m_mask + 1; }
+
+	private:
+		struct Cell
+		{
+			std::atomic<size_type> sequence;
+			alignas(T) ds_u8 storage[sizeof(T)];
+
+			T* value() noexcept { return reinterpret_cast<T*>(storage); }
+		};
+
+		using Cell_Allocator = memory::Rebind_Allocator<Allocator, Cell>;
+
+		static size_type round_up_capacity(size_type capacity) noexcept
+		{
+			size_type result = 2;
+			while (result < capacity) {
+				result <<= 1;
+			}
+			return result;
+		}
+
+		// Claimed by producers
+		alignas(memory::CACHE_LINE_SIZE) std::atomic<size_type> m_enqueue_index{ 0 };
+
+		// Claimed by consumers
+		alignas(memory::CACHE_LINE_SIZE) std::atomic<size_type> m_dequeue_index{ 0 };
+
+		// Shared read-only state
+		alignas(memory::CACHE_LINE_SIZE) Cell* m_cells = nullptr;
+		size_type m_mask = 0;
+		DS_NO_UNIQUE_ADDRESS Cell_Allocator m_allocator;
+	};
+
+
+    // *********************************************************************** //
+    // ************************** IMPLEMENTATION ***************************** //
+    // *********************************************************************** //
+
+
+    /////////////////////////////////////////////////////////
+    // Constructors and Destructor
+    /////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    DMPMC_Queue<T, Allocator>::DMPMC_Queue(size_type capacity, const allocator_type& alloc)
+        : m_mask(round_up_capacity(capacity) - 1), m_allocator(alloc)
+    {
+        m_cells = m_allocator.allocate(m_mask + 1);
+        DS_ASSERT(m_cells, "DMPMC_Queue - Failed to allocate queue cells");
+
+        // Cell i is first written at position i
+        for (size_type i = 0; i <= m_mask; ++i) {
+            new (&m_cells[i].sequence) std::atomic<size_type>(i);
+        }
+    }
+
+    template <typename T, typename Allocator>
+    DMPMC_Queue<T, Allocator>::~DMPMC_Queue()
+    {
+        if (!m_cells) {
+            return;
+        }
+
+        size_type dequeue = m_dequeue_index.load(std::memory_order_relaxed);
+        size_type enqueue = m_enqueue_index.load(std::memory_order_relaxed);
+        for (; dequeue != enqueue; ++dequeue) {
+            m_cells[dequeue & m_mask].value()->~T();
+        }
+
+        m_allocator.deallocate(m_cells, m_mask + 1);
+    }
+
+    /////////////////////////////////////////////////////////
+    // Queue Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    template <typename... Args>
+    bool DMPMC_Queue<T, Allocator>::try_emplace(Args&&... args)
+    {
+        size_type position = m_enqueue_index.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        while (true) {
+            cell = &m_cells[position & m_mask];
+            size_type sequence = cell->sequence.load(std::memory_order_acquire);
+            ds_i64 difference = static_cast<ds_i64>(sequence) - static_cast<ds_i64>(position);
+
+            if (difference == 0) {
+                // The cell is free for this lap, try to claim the position
+                if (m_enqueue_index.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (difference < 0) {
+                // The cell still holds the element from the previous lap
+                return false;
+            }
+            else {
+                // Another producer claimed this position first
+                position = m_enqueue_index.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (cell->value()) T(std::forward<Args>(args)...);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, typename Allocator>
+    bool DMPMC_Queue<T, Allocator>::try_pop(T& out)
+    {
+        size_type position = m_dequeue_index.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        while (true) {
+            cell = &m_cells[position & m_mask];
+            size_type sequence = cell->sequence.load(std::memory_order_acquire);
+            ds_i64 difference = static_cast<ds_i64>(sequence) - static_cast<ds_i64>(position + 1);
+
+            if (difference == 0) {
+                // The cell was published for this position, try to claim it
+                if (m_dequeue_index.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (difference < 0) {
+                // Nothing has been published here yet
+                return false;
+            }
+            else {
+                // Another consumer took this position first
+                position = m_dequeue_index.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* value = cell->value();
+        out = std::move(*value);
+        value->~T();
+
+        // Free the cell for the producer one lap ahead
+        cell->sequence.store(position + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+} // namespace ds::core::containers
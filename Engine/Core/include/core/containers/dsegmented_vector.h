@@ -0,0 +1,420 @@
+#pragma once
+#include <core/containers/dvector.h>
+#include <core/memory/allocator_interface.h>
+#include <core/memory/allocator_adapters.h>
+#include <core/defines.h>
+#include <bit>
+#include <iterator>
+#include <span>
+
+namespace ds::core::containers
+{
+	/**
+	 * Default number of elements per DSegmented_Vector chunk
+	 * The largest power of two that keeps a chunk within 16 KiB, four 4 KiB pages
+	 */
+	template <typename T>
+	inline constexpr ds_u64 SEGMENTED_VECTOR_DEFAULT_CHUNK_SIZE =
+		std::bit_floor(sizeof(T) >= 16384 ? ds_u64(1) : ds_u64(16384 / sizeof(T)));
+
+	/**
+	 * DSegmented_Vector - Dynamic array whose elements never move
+	 *
+	 * Elements are stored in fixed size chunks. Growing appends a chunk instead of reallocating,
+	 * so there is no copy or 2x memory spike, and pointers and references to elements stay valid
+	 * until the element itself is removed. Element i lives at chunk i >> log2(CHUNK_SIZE), offset
+	 * i & (CHUNK_SIZE - 1).
+	 *
+	 * Each chunk is a single allocate(1) of a chunk sized object from Allocator rebound to the
+	 * chunk type, which suits Pool_Allocator_Adapter (block size >= chunk size) and
+	 * Page_Allocator_Adapter. The small table of chunk pointers uses the default allocator.
+	 *
+	 * chunk_count() and chunk() give direct access to each chunk's live elements, so work can
+	 * be split per chunk across threads.
+	 *
+	 * @tparam T Type of the elements
+	 * @tparam CHUNK_SIZE Elements per chunk, a power of two
+	 * @tparam Allocator Allocator family for the chunks, must be rebindable with memory::Rebind_Allocator
+	 */
+	template <typename T, ds_u64 CHUNK_SIZE = SEGMENTED_VECTOR_DEFAULT_CHUNK_SIZE<T>, typename Allocator = memory::Default_Allocator<T>>
+	class DSegmented_Vector
+	{
+		static_assert(CHUNK_SIZE > 0 && (CHUNK_SIZE & (CHUNK_SIZE - 1)) == 0, "DSegmented_Vector chunk size must be a power of two");
+
+		// Raw storage for one chunk
+		struct Chunk
+		{
+			alignas(T) ds_u8 storage[sizeof(T) * CHUNK_SIZE];
+
+			T* data() noexcept { return reinterpret_cast<T*>(storage); }
+			const T* data() const noexcept { return reinterpret_cast<const T*>(storage); }
+		};
+
+	public:
+		using value_type      = T;
+		using allocator_type  = Allocator;
+		using size_type       = ds_u64;
+		using difference_type = ds_i64;
+		using reference       = T&;
+		using const_reference = const T&;
+
+		static constexpr size_type CHUNK_SHIFT = static_cast<size_type>(std::countr_zero(CHUNK_SIZE));
+		static constexpr size_type CHUNK_MASK = CHUNK_SIZE - 1;
+
+		/**
+		 * Random access iterator, walks elements in index order across chunks
+		 */
+		template <bool IS_CONST>
+		class Segment_Iterator
+		{
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type        = T;
+			using difference_type   = ds_i64;
+			using pointer           = std::conditional_t<IS_CONST, const T*, T*>;
+			using reference         = std::conditional_t<IS_CONST, const T&, T&>;
+			using container_type    = std::conditional_t<IS_CONST, const DSegmented_Vector, DSegmented_Vector>;
+
+			Segment_Iterator() noexcept = default;
+			Segment_Iterator(container_type* container, size_type index) noexcept : m_container(container), m_index(index) {}
+
+			// Const iterators can be made from mutable ones
+			template <bool OTHER_CONST, typename = std::enable_if_t<IS_CONST && !OTHER_CONST>>
+			Segment_Iterator(const Segment_Iterator<OTHER_CONST>& other) noexcept
+				: m_container(other.m_container), m_index(other.m_index) {}
+
+			reference operator*() const { return (*m_container)[m_index]; }
+			pointer operator->() const { return &(*m_container)[m_index]; }
+			reference operator[](difference_type n) const { return (*m_container)[m_index + n]; }
+
+			Segment_Iterator& operator++() { ++m_index; return *this; }
+			Segment_Iterator operator++(int) { Segment_Iterator tmp = *this; ++m_index; return tmp; }
+			Segment_Iterator& operator--() { --m_index; return *this; }
+			Segment_Iterator operator--(int) { Segment_Iterator tmp = *this; --m_index; return tmp; }
+
+			Segment_Iterator& operator+=(difference_type n) { m_index += n; return *this; }
+			Segment_Iterator& operator-=(difference_type n) { m_index -= n; return *this; }
+			Segment_Iterator operator+(difference_type n) const { return Segment_Iterator(m_container, m_index + n); }
+			Segment_Iterator operator-(difference_type n) const { return Segment_Iterator(m_container, m_index - n); }
+			friend Segment_Iterator operator+(difference_type n, const Segment_Iterator& it) { return it + n; }
+			difference_type operator-(const Segment_Iterator& other) const
+			{
+				return static_cast<difference_type>(m_index) - static_cast<difference_type>(other.m_index);
+			}
+
+			bool operator==(const Segment_Iterator& other) const { return m_index == other.m_index; }
+			auto operator<=>(const Segment_Iterator& other) const { return m_index <=> other.m_index; }
+
+		private:
+			container_type* m_container = nullptr;
+			size_type m_index = 0;
+
+			template <bool> friend class Segment_Iterator;
+		};
+
+		using iterator       = Segment_Iterator<false>;
+		using const_iterator = Segment_Iterator<true>;
+
+		//====================
+		// Constructors/Destructor
+		//====================
+
+		DSegmented_Vector() = default;
+		explicit DSegmented_Vector(const allocator_type& alloc) : m_allocator(alloc) {}
+		DSegmented_Vector(const DSegmented_Vector& other);
+		DSegmented_Vector(DSegmented_Vector&& other) noexcept;
+		~DSegmented_Vector();
+
+		DSegmented_Vector& operator=(const DSegmented_Vector& other);
+		DSegmented_Vector& operator=(DSegmented_Vector&& other) noexcept;
+
+		//====================
+		// Element Access
+		//====================
+
+		reference operator[](size_type pos) noexcept { return m_chunks[pos >> CHUNK_SHIFT]->data()[pos & CHUNK_MASK]; }
+		const_reference operator[](size_type pos) const noexcept { return m_chunks[pos >> CHUNK_SHIFT]->data()[pos & CHUNK_MASK]; }
+
+		/**
+		 * Access element with bounds checking
+		 * @throws std::out_of_range if pos >= size()
+		 */
+		reference at(size_type pos);
+		const_reference at(size_type pos) const;
+
+		reference front() noexcept { return (*this)[0]; }
+		const_reference front() const noexcept { return (*this)[0]; }
+		reference back() noexcept { return (*this)[m_size - 1]; }
+		const_reference back() const noexcept { return (*this)[m_size - 1]; }
+
+		//====================
+		// Chunk Access
+		//====================
+
+		/**
+		 * Get the number of chunks holding elements
+		 */
+		size_type chunk_count() const noexcept { return (m_size + CHUNK_MASK) >> CHUNK_SHIFT; }
+
+		/**
+		 * Get the live elements of one chunk
+		 * @param index Chunk index in [0, chunk_count())
+		 * @return Span over the chunk's elements, CHUNK_SIZE long except for the last chunk
+		 */
+		std::span<T> chunk(size_type index) noexcept;
+		std::span<const T> chunk(size_type index) const noexcept;
+
+		//====================
+		// Iterators
+		//====================
+
+		iterator begin() noexcept { return iterator(this, 0); }
+		const_iterator begin() const noexcept { return const_iterator(this, 0); }
+		const_iterator cbegin() const noexcept { return begin(); }
+		iterator end() noexcept { return iterator(this, m_size); }
+		const_iterator end() const noexcept { return const_iterator(this, m_size); }
+		const_iterator cend() const noexcept { return end(); }
+
+		//====================
+		// Capacity
+		//====================
+
+		[[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+		size_type size() const noexcept { return m_size; }
+		size_type capacity() const noexcept { return m_chunks.size() * CHUNK_SIZE; }
+
+		/**
+		 * Allocate chunks up front for new_cap elements
+		 */
+		void reserve(size_type new_cap);
+
+		/**
+		 * Free chunks past the last element
+		 */
+		void shrink_to_fit();
+
+		//====================
+		// Modifiers
+		//====================
+
+		void clear() noexcept;
+		void push_back(const T& value) { emplace_back(value); }
+		void push_back(T&& value) { emplace_back(std::move(value)); }
+
+		template <typename... Args>
+		reference emplace_back(Args&&... args);
+
+		void pop_back();
+		void resize(size_type count);
+		void swap(DSegmented_Vector& other) noexcept;
+
+	private:
+		using Chunk_Allocator = memory::Rebind_Allocator<Allocator, Chunk>;
+
+		void release() noexcept;
+
+		DVector<Chunk*> m_chunks;                           ///< Chunk table, only ever grows or shrinks at the end
+		size_type m_size = 0;                               ///< Number of elements
+		DS_NO_UNIQUE_ADDRESS Chunk_Allocator m_allocator;   ///< Allocator for the chunks
+	};
+
+
+    // *********************************************************************** //
+    // ************************** IMPLEMENTATION ***************************** //
+    // *********************************************************************** //
+
+
+    /////////////////////////////////////////////////////////
+    // Constructors and Destructor
+    /////////////////////////////////////////////////////////
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    DSegmented_Vector<T, CHUNK_SIZE, Allocator>::DSegmented_Vector(const DSegmented_Vector& other)
+        : m_allocator(other.m_allocator)
+    {
+        reserve(other.m_size);
+        for (const T& value : other) {
+            emplace_back(value);
+        }
+    }
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    DSegmented_Vector<T, CHUNK_SIZE, Allocator>::DSegmented_Vector(DSegmented_Vector&& other) noexcept
+        : m_chunks(std::move(other.m_chunks)), m_size(other.m_size), m_allocator(other.m_allocator)
+    {
+        other.m_size = 0;
+    }
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    DSegmented_Vector<T, CHUNK_SIZE, Allocator>::~DSegmented_Vector()
+    {
+        release();
+    }
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    DSegmented_Vector<T, CHUNK_SIZE, Allocator>&
+        DSegmented_Vector<T, CHUNK_SIZE, Allocator>::operator=(const DSegmented_Vector& other)
+    {
+        if (this != &other) {
+            DSegmented_Vector copy(other);
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    DSegmented_Vector<T, CHUNK_SIZE, Allocator>&
+        DSegmented_Vector<T, CHUNK_SIZE, Allocator>::operator=(DSegmented_Vector&& other) noexcept
+    {
+        if (this != &other) {
+            release();
+            swap(other);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////
+    // Element and Chunk Access Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    typename DSegmented_Vector<T, CHUNK_SIZE, Allocator>::reference DSegmented_Vector<T, CHUNK_SIZE, Allocator>::at(size_type pos)
+    {
+        if (pos >= m_size) {
+            throw std::out_of_range("DSegmented_Vector::at - Index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    typename DSegmented_Vector<T, CHUNK_SIZE, Allocator>::const_reference DSegmented_Vector<T, CHUNK_SIZE, Allocator>::at(size_type pos) const
+    {
+        if (pos >= m_size) {
+            throw std::out_of_range("DSegmented_Vector::at - Index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    std::span<T> DSegmented_Vector<T, CHUNK_SIZE, Allocator>::chunk(size_type index) noexcept
+    {
+        size_type first = index << CHUNK_SHIFT;
+        size_type count = m_size - first < CHUNK_SIZE ? m_size - first : CHUNK_SIZE;
+        return { m_chunks[index]->data(), count };
+    }
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    std::span<const T> DSegmented_Vector<T, CHUNK_SIZE, Allocator>::chunk(size_type index) const noexcept
+    {
+        size_type first = index << CHUNK_SHIFT;
+        size_type count = m_size - first < CHUNK_SIZE ? m_size - first : CHUNK_SIZE;
+        return { m_chunks[index]->data(), count };
+    }
+
+    /////////////////////////////////////////////////////////
+    // Capacity Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    void DSegmented_Vector<T, CHUNK_SIZE, Allocator>::reserve(size_type new_cap)
+    {
+        size_type needed = (new_cap + CHUNK_MASK) >> CHUNK_SHIFT;
+        m_chunks.reserve(needed);
+
+        while (m_chunks.size() < needed) {
+            Chunk* chunk = m_allocator.allocate(1);
+            DS_ASSERT(chunk, "DSegmented_Vector - Failed to allocate chunk");
+            m_chunks.push_back(chunk);
+        }
+    }
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    void DSegmented_Vector<T, CHUNK_SIZE, Allocator>::shrink_to_fit()
+    {
+        size_type used = chunk_count();
+        while (m_chunks.size() > used) {
+            m_allocator.deallocate(m_chunks.back(), 1);
+            m_chunks.pop_back();
+        }
+        m_chunks.shrink_to_fit();
+    }
+
+    /////////////////////////////////////////////////////////
+    // Modifier Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    void DSegmented_Vector<T, CHUNK_SIZE, Allocator>::clear() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_type i = 0; i < m_size; ++i) {
+                (*this)[i].~T();
+            }
+        }
+        m_size = 0;
+    }
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    template <typename... Args>
+    typename DSegmented_Vector<T, CHUNK_SIZE, Allocator>::reference DSegmented_Vector<T, CHUNK_SIZE, Allocator>::emplace_back(Args&&... args)
+    {
+        // Only a new chunk is allocated, existing elements stay where they are
+        if (m_size == capacity()) {
+            Chunk* chunk = m_allocator.allocate(1);
+            DS_ASSERT(chunk, "DSegmented_Vector - Failed to allocate chunk");
+            m_chunks.push_back(chunk);
+        }
+
+        T* slot = m_chunks[m_size >> CHUNK_SHIFT]->data() + (m_size & CHUNK_MASK);
+        new (slot) T(std::forward<Args>(args)...);
+        ++m_size;
+        return *slot;
+    }
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    void DSegmented_Vector<T, CHUNK_SIZE, Allocator>::pop_back()
+    {
+        DS_ASSERT(m_size > 0, "DSegmented_Vector::pop_back - Vector is empty");
+        --m_size;
+        (*this)[m_size].~T();
+    }
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    void DSegmented_Vector<T, CHUNK_SIZE, Allocator>::resize(size_type count)
+    {
+        while (m_size > count) {
+            pop_back();
+        }
+
+        reserve(count);
+        while (m_size < count) {
+            emplace_back();
+        }
+    }
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    void DSegmented_Vector<T, CHUNK_SIZE, Allocator>::swap(DSegmented_Vector& other) noexcept
+    {
+        m_chunks.swap(other.m_chunks);
+        std::swap(m_size, other.m_size);
+        std::swap(m_allocator, other.m_allocator);
+    }
+
+    /////////////////////////////////////////////////////////
+    // Helper Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename T, ds_u64 CHUNK_SIZE, typename Allocator>
+    void DSegmented_Vector<T, CHUNK_SIZE, Allocator>::release() noexcept
+    {
+        clear();
+        for (Chunk* chunk : m_chunks) {
+            m_allocator.deallocate(chunk, 1);
+        }
+        m_chunks.clear();
+        m_chunks.shrink_to_fit();
+    }
+
+} // namespace ds::core::containers
@@ -0,0 +1,313 @@
+#pragma once
+#include <core/containers/dvector.h>
+#include <core/memory/allocator_interface.h>
+#include <core/memory/allocator_adapters.h>
+#include <core/defines.h>
+
+namespace ds::core::containers
+{
+	/**
+	 * DSlot_Map - Dense storage addressed through generational handles
+	 *
+	 * Elements live contiguously in a DVector, so iteration is a linear walk. A handle holds a
+	 * 32 bit slot index and the slot's generation; the slot records where the element currently
+	 * sits in the dense array. Insert, erase and lookup are O(1). Erasing moves the last element
+	 * into the hole and bumps the slot's generation, so stale handles fail to resolve instead
+	 * of reaching whatever reused the slot.
+	 *
+	 * Pointers and iterators into the map are invalidated by insert and erase like those of a
+	 * DVector; handles stay valid until their own element is erased.
+	 *
+	 * @tparam T Type of the elements
+	 * @tparam Allocator Allocator for T, must model memory::Ds_Allocator and be rebindable
+	 *                   with memory::Rebind_Allocator for the slot arrays
+	 */
+	template <typename T, typename Allocator = memory::Default_Allocator<T>>
+	class DSlot_Map
+	{
+	public:
+		/**
+		 * Handle to an element of the map
+		 * Default constructed handles are invalid and never resolve
+		 */
+		struct Handle
+		{
+			ds_u32 index = 0;        // Slot index
+			ds_u32 generation = 0;   // Generation of the slot when the handle was issued
+
+			bool IsValid() const { return generation != 0; }
+
+			bool operator==(const Handle& other) const = default;
+		};
+
+		using value_type      = T;
+		using allocator_type  = Allocator;
+		using size_type       = ds_u64;
+		using reference       = T&;
+		using const_reference = const T&;
+		using iterator        = typename DVector<T, Allocator>::iterator;
+		using const_iterator  = typename DVector<T, Allocator>::const_iterator;
+
+		//====================
+		// Constructors
+		//====================
+
+		DSlot_Map() = default;
+		explicit DSlot_Map(const allocator_type& alloc)
+			: m_values(alloc), m_slots(Slot_Allocator(alloc)), m_dense_to_slot(Index_Allocator(alloc)) {}
+
+		//====================
+		// Iterators over the dense elements
+		//====================
+
+		iterator begin() noexcept { return m_values.begin(); }
+		const_iterator begin() const noexcept { return m_values.begin(); }
+		iterator end() noexcept { return m_values.end(); }
+		const_iterator end() const noexcept { return m_values.end(); }
+
+		T* data() noexcept { return m_values.data(); }
+		const T* data() const noexcept { return m_values.data(); }
+
+		//====================
+		// Capacity
+		//====================
+
+		[[nodiscard]] bool empty() const noexcept { return m_values.empty(); }
+		size_type size() const noexcept { return m_values.size(); }
+		size_type capacity() const noexcept { return m_values.capacity(); }
+
+		/**
+		 * Make room for count elements without reallocating
+		 * @param count Number of elements to hold
+		 */
+		void reserve(size_type count);
+
+		//====================
+		// Lookup
+		//====================
+
+		/**
+		 * Resolve a handle
+		 * @param handle Handle to resolve
+		 * @return Pointer to the element, or nullptr if the handle is invalid or stale
+		 */
+		T* get(Handle handle);
+		const T* get(Handle handle) const;
+
+		bool contains(Handle handle) const { return get(handle) != nullptr; }
+
+		/**
+		 * Resolve a handle that is known to be live
+		 * @param handle Handle to a live element
+		 * @return Reference to the element
+		 */
+		T& operator[](Handle handle);
+		const T& operator[](Handle handle) const;
+
+		/**
+		 * Get the handle of the element at a dense position, for use while iterating
+		 * @param dense_index Position in [0, size())
+		 * @return Handle to that element
+		 */
+		Handle handle_at(size_type dense_index) const;
+
+		//====================
+		// Modifiers
+		//====================
+
+		Handle insert(const T& value) { return emplace(value); }
+		Handle insert(T&& value) { return emplace(std::move(value)); }
+
+		/**
+		 * Construct an element at the end of the dense array
+		 * @return Handle to the new element
+		 */
+		template <typename... Args>
+		Handle emplace(Args&&... args);
+
+		/**
+		 * Erase the element a handle refers to
+		 * The last element is moved into its place
+		 * @param handle Handle to erase
+		 * @return True if the handle was live
+		 */
+		bool erase(Handle handle);
+
+		/**
+		 * Erase every element, all outstanding handles become stale
+		 */
+		void clear() noexcept;
+
+	private:
+		// Slot entry, dense_index doubles as the next free slot while the slot is unused
+		struct Slot
+		{
+			ds_u32 dense_index;
+			ds_u32 generation;
+		};
+
+		using Slot_Allocator  = memory::Rebind_Allocator<Allocator, Slot>;
+		using Index_Allocator = memory::Rebind_Allocator<Allocator, ds_u32>;
+
+		static constexpr ds_u32 NO_FREE_SLOT = ~ds_u32(0);
+
+		// Generation 0 is reserved for invalid handles
+		static ds_u32 next_generation(ds_u32 generation) noexcept
+		{
+			return generation + 1 == 0 ? 1 : generation + 1;
+		}
+
+		ds_u32 find_dense_index(Handle handle) const;
+
+		DVector<T, Allocator> m_values;                     ///< Dense element storage
+		DVector<Slot, Slot_Allocator> m_slots;              ///< Slots addressed by handle index
+		DVector<ds_u32, Index_Allocator> m_dense_to_slot;   ///< Owning slot of each dense element
+		ds_u32 m_free_head = NO_FREE_SLOT;                  ///< First unused slot
+	};
+
+
+    // *********************************************************************** //
+    // ************************** IMPLEMENTATION ***************************** //
+    // *********************************************************************** //
+
+
+    /////////////////////////////////////////////////////////
+    // Capacity Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    void DSlot_Map<T, Allocator>::reserve(size_type count)
+    {
+        m_values.reserve(count);
+        m_dense_to_slot.reserve(count);
+        m_slots.reserve(count);
+    }
+
+    /////////////////////////////////////////////////////////
+    // Lookup Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    ds_u32 DSlot_Map<T, Allocator>::find_dense_index(Handle handle) const
+    {
+        if (handle.index >= m_slots.size()) {
+            return NO_FREE_SLOT;
+        }
+
+        // Erasing bumps the generation, so only the live element's handle still matches
+        const Slot& slot = m_slots[handle.index];
+        return slot.generation == handle.generation ? slot.dense_index : NO_FREE_SLOT;
+    }
+
+    template <typename T, typename Allocator>
+    T* DSlot_Map<T, Allocator>::get(Handle handle)
+    {
+        ds_u32 dense_index = find_dense_index(handle);
+        return dense_index == NO_FREE_SLOT ? nullptr : m_values.data() + dense_index;
+    }
+
+    template <typename T, typename Allocator>
+    const T* DSlot_Map<T, Allocator>::get(Handle handle) const
+    {
+        ds_u32 dense_index = find_dense_index(handle);
+        return dense_index == NO_FREE_SLOT ? nullptr : m_values.data() + dense_index;
+    }
+
+    template <typename T, typename Allocator>
+    T& DSlot_Map<T, Allocator>::operator[](Handle handle)
+    {
+        T* value = get(handle);
+        DS_ASSERT(value, "DSlot_Map::operator[] - Handle is invalid or stale");
+        return *value;
+    }
+
+    template <typename T, typename Allocator>
+    const T& DSlot_Map<T, Allocator>::operator[](Handle handle) const
+    {
+        const T* value = get(handle);
+        DS_ASSERT(value, "DSlot_Map::operator[] - Handle is invalid or stale");
+        return *value;
+    }
+
+    template <typename T, typename Allocator>
+    typename DSlot_Map<T, Allocator>::Handle DSlot_Map<T, Allocator>::handle_at(size_type dense_index) const
+    {
+        DS_ASSERT(dense_index < m_values.size(), "DSlot_Map::handle_at - Index out of range");
+        ds_u32 slot_index = m_dense_to_slot[dense_index];
+        return Handle{ slot_index, m_slots[slot_index].generation };
+    }
+
+    /////////////////////////////////////////////////////////
+    // Modifier Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    template <typename... Args>
+    typename DSlot_Map<T, Allocator>::Handle DSlot_Map<T, Allocator>::emplace(Args&&... args)
+    {
+        DS_ASSERT(m_values.size() < NO_FREE_SLOT, "DSlot_Map::emplace - Handle index space exhausted");
+
+        ds_u32 dense_index = static_cast<ds_u32>(m_values.size());
+        m_values.emplace_back(std::forward<Args>(args)...);
+
+        // Reuse a free slot before growing the slot array
+        ds_u32 slot_index;
+        if (m_free_head != NO_FREE_SLOT) {
+            slot_index = m_free_head;
+            m_free_head = m_slots[slot_index].dense_index;
+            m_slots[slot_index].dense_index = dense_index;
+        }
+        else {
+            slot_index = static_cast<ds_u32>(m_slots.size());
+            m_slots.push_back(Slot{ dense_index, 1 });
+        }
+
+        m_dense_to_slot.push_back(slot_index);
+        return Handle{ slot_index, m_slots[slot_index].generation };
+    }
+
+    template <typename T, typename Allocator>
+    bool DSlot_Map<T, Allocator>::erase(Handle handle)
+    {
+        ds_u32 dense_index = find_dense_index(handle);
+        if (dense_index == NO_FREE_SLOT) {
+            return false;
+        }
+
+        // Fill the hole with the last element and repoint its slot
+        ds_u32 last_index = static_cast<ds_u32>(m_values.size() - 1);
+        if (dense_index != last_index) {
+            m_values[dense_index] = std::move(m_values[last_index]);
+            ds_u32 moved_slot = m_dense_to_slot[last_index];
+            m_dense_to_slot[dense_index] = moved_slot;
+            m_slots[moved_slot].dense_index = dense_index;
+        }
+
+        m_values.pop_back();
+        m_dense_to_slot.pop_back();
+
+        Slot& slot = m_slots[handle.index];
+        slot.generation = next_generation(slot.generation);
+        slot.dense_index = m_free_head;
+        m_free_head = handle.index;
+
+        return true;
+    }
+
+    template <typename T, typename Allocator>
+    void DSlot_Map<T, Allocator>::clear() noexcept
+    {
+        m_values.clear();
+        m_dense_to_slot.clear();
+
+        // Retire every slot and chain them all into the free list
+        m_free_head = NO_FREE_SLOT;
+        for (size_type i = m_slots.size(); i-- > 0;) {
+            Slot& slot = m_slots[i];
+            slot.generation = next_generation(slot.generation);
+            slot.dense_index = m_free_head;
+            m_free_head = static_cast<ds_u32>(i);
+        }
+    }
+
+} // namespace ds::core::containers
@@ -0,0 +1,479 @@
+#pragma once
+#include <core/containers/dvector.h>
+#include <core/memory/allocator_interface.h>
+#include <core/defines.h>
+
+namespace ds::core::containers
+{
+	/**
+	 * Small_Buffer_Allocator - Allocator with inline storage for N elements
+	 *
+	 * Hands out its inline buffer for requests of up to N elements while the buffer is unused
+	 * and forwards everything else to the fallback allocator. Growth inside the buffer happens
+	 * in place through try_expand.
+	 *
+	 * Copies share the fallback allocator but start with their own empty buffer, so an
+	 * allocator copied along with a container never aliases the source's storage.
+	 *
+	 * @tparam T Type of the elements
+	 * @tparam N Number of elements stored inline
+	 * @tparam Allocator Fallback allocator used past N elements
+	 */
+	template <typename T, ds_u64 N, typename Allocator>
+	class Small_Buffer_Allocator
+	{
+		static_assert(N > 0, "Small_Buffer_Allocator needs room for at least one element");
+		static_assert(memory::Ds_Allocator<Allocator>, "Small_Buffer_Allocator requires a fallback allocator that models Ds_Allocator");
+
+	public:
+		using value_type = T;
+
+		Small_Buffer_Allocator() = default;
+		explicit Small_Buffer_Allocator(const Allocator& fallback) : m_fallback(fallback) {}
+
+		Small_Buffer_Allocator(const Small_Buffer_Allocator& other) : m_fallback(other.m_fallback) {}
+
+		Small_Buffer_Allocator& operator=(const Small_Buffer_Allocator& other)
+		{
+			// Only the fallback is shared, the buffer stays with whoever is using it
+			m_fallback = other.m_fallback;
+			return *this;
+		}
+
+		T* allocate(ds_u64 n)
+		{
+			if (n <= N && !m_buffer_in_use) {
+				m_buffer_in_use = true;
+				return inline_data();
+			}
+
+			return m_fallback.allocate(n);
+		}
+
+		void deallocate(T* p, ds_u64 n)
+		{
+			if (p == inline_data()) {
+				m_buffer_in_use = false;
+				return;
+			}
+
+			m_fallback.deallocate(p, n);
+		}
+
+		ds_bool try_expand(T* p, ds_u64 old_n, ds_u64 new_n)
+		{
+			if (p == inline_data()) {
+				return new_n <= N;
+			}
+
+			return memory::Allocator_Traits<Allocator>::try_expand(m_fallback, p, old_n, new_n);
+		}
+
+		/**
+		 * Check if a pointer refers to the inline buffer
+		 * @param p Pointer returned by allocate
+		 * @return true if p is the inline buffer
+		 */
+		bool is_inline(const T* p) const noexcept { return p == inline_data(); }
+
+		/**
+		 * Get the fallback allocator
+		 * @return Allocator used past N elements
+		 */
+		const Allocator& get_fallback() const noexcept { return m_fallback; }
+
+	private:
+		T* inline_data() noexcept { return reinterpret_cast<T*>(m_buffer); }
+		const T* inline_data() const noexcept { return reinterpret_cast<const T*>(m_buffer); }
+
+		alignas(T) ds_u8 m_buffer[sizeof(T) * N];          ///< Inline element storage
+		bool m_buffer_in_use = false;                      ///< Whether the buffer was handed out
+		DS_NO_UNIQUE_ADDRESS Allocator m_fallback;        ///< Allocator for storage past N elements
+	};
+
+	/**
+	 * DSmall_Vector - DVector with inline storage for small sizes
+	 *
+	 * Keeps up to N elements inside the object and only allocates from the fallback
+	 * allocator once it grows past N. Offers DVector's interface and iterators, but is
+	 * not a DVector: DVector's move and swap would take over a pointer into the inline
+	 * buffer, so the base is private and only the element API is forwarded.
+	 *
+	 * @tparam T Type of the elements
+	 * @tparam N Number of elements stored inline
+	 * @tparam Allocator Allocator used past N elements, must model memory::Ds_Allocator
+	 */
+	template <typename T, ds_u64 N, typename Allocator = memory::Default_Allocator<T>>
+	class DSmall_Vector : private DVector<T, Small_Buffer_Allocator<T, N, Allocator>>
+	{
+		using base_type = DVector<T, Small_Buffer_Allocator<T, N, Allocator>>;
+
+	public:
+		using typename base_type::value_type;
+		using typename base_type::allocator_type;
+		using typename base_type::size_type;
+		using typename base_type::difference_type;
+		using typename base_type::reference;
+		using typename base_type::const_reference;
+		using typename base_type::pointer;
+		using typename base_type::const_pointer;
+		using typename base_type::iterator;
+		using typename base_type::const_iterator;
+		using typename base_type::reverse_iterator;
+		using typename base_type::const_reverse_iterator;
+		using fallback_allocator_type = Allocator;
+
+		static constexpr size_type INLINE_CAPACITY = N;
+
+		//====================
+		// Constructors/Destructor
+		//====================
+
+		/**
+		 * Default constructor - creates an empty vector using the inline buffer
+		 */
+		DSmall_Vector();
+
+		/**
+		 * Constructor with fallback allocator
+		 * @param alloc Allocator used past N elements
+		 */
+		explicit DSmall_Vector(const Allocator& alloc);
+
+		/**
+		 * Fill constructor - creates a vector with count copies of value
+		 * @param count Number of elements
+		 * @param value Value to initialize elements with
+		 * @param alloc Allocator used past N elements
+		 */
+		explicit DSmall_Vector(size_type count, const T& value = T(), const Allocator& alloc = Allocator());
+
+		/**
+		 * Initializer list constructor
+		 * @param init Initializer list to copy elements from
+		 * @param alloc Allocator used past N elements
+		 */
+		DSmall_Vector(std::initializer_list<T> init, const Allocator& alloc = Allocator());
+
+		/**
+		 * Copy constructor
+		 * @param other DSmall_Vector to copy from
+		 */
+		DSmall_Vector(const DSmall_Vector& other);
+
+		/**
+		 * Move constructor
+		 * Elements held inline are moved one by one, heap storage is taken over
+		 * @param other DSmall_Vector to move from
+		 */
+		DSmall_Vector(DSmall_Vector&& other) noexcept;
+
+		~DSmall_Vector() = default;
+
+		//====================
+		// Assignment operators
+		//====================
+
+		DSmall_Vector& operator=(const DSmall_Vector& other);
+		DSmall_Vector& operator=(DSmall_Vector&& other) noexcept;
+		DSmall_Vector& operator=(std::initializer_list<T> ilist);
+
+		//====================
+		// DVector interface
+		//====================
+
+		using base_type::at;
+		using base_type::operator[];
+		using base_type::front;
+		using base_type::back;
+		using base_type::data;
+
+		using base_type::begin;
+		using base_type::cbegin;
+		using base_type::end;
+		using base_type::cend;
+		using base_type::rbegin;
+		using base_type::crbegin;
+		using base_type::rend;
+		using base_type::crend;
+
+		using base_type::empty;
+		using base_type::size;
+		using base_type::max_size;
+		using base_type::reserve;
+		using base_type::capacity;
+		using base_type::shrink_to_fit;
+
+		using base_type::clear;
+		using base_type::insert;
+		using base_type::emplace;
+		using base_type::erase;
+		using base_type::push_back;
+		using base_type::emplace_back;
+		using base_type::pop_back;
+		using base_type::resize;
+
+		//====================
+		// Small buffer
+		//====================
+
+		/**
+		 * Check if the elements are stored in the inline buffer
+		 * @return true if no fallback allocation is in use
+		 */
+		bool is_inline() const noexcept;
+
+		/**
+		 * Swap contents with another small vector
+		 * @param other DSmall_Vector to swap with
+		 */
+		void swap(DSmall_Vector& other) noexcept;
+
+	private:
+		/**
+		 * Point the empty vector at the inline buffer with its full capacity
+		 */
+		void use_inline_buffer() noexcept;
+
+		/**
+		 * Release any storage and take over the elements of other, leaving other empty
+		 * @param other DSmall_Vector to take the elements from
+		 */
+		void take_from(DSmall_Vector& other) noexcept;
+
+		using typename base_type::allocator_traits;
+	};
+
+	template <typename T, ds_u64 N, typename Allocator>
+	bool operator==(const DSmall_Vector<T, N, Allocator>& lhs, const DSmall_Vector<T, N, Allocator>& rhs);
+
+	template <typename T, ds_u64 N, typename Allocator>
+	bool operator!=(const DSmall_Vector<T, N, Allocator>& lhs, const DSmall_Vector<T, N, Allocator>& rhs);
+
+	template <typename T, ds_u64 N, typename Allocator>
+	bool operator<(const DSmall_Vector<T, N, Allocator>& lhs, const DSmall_Vector<T, N, Allocator>& rhs);
+
+	template <typename T, ds_u64 N, typename Allocator>
+	bool operator>(const DSmall_Vector<T, N, Allocator>& lhs, const DSmall_Vector<T, N, Allocator>& rhs);
+
+	template <typename T, ds_u64 N, typename Allocator>
+	bool operator<=(const DSmall_Vector<T, N, Allocator>& lhs, const DSmall_Vector<T, N, Allocator>& rhs);
+
+	template <typename T, ds_u64 N, typename Allocator>
+	bool operator>=(const DSmall_Vector<T, N, Allocator>& lhs, const DSmall_Vector<T, N, Allocator>& rhs);
+
+	template <typename T, ds_u64 N, typename Allocator>
+	void swap(DSmall_Vector<T, N, Allocator>& lhs, DSmall_Vector<T, N, Allocator>& rhs) noexcept;
+
+
+    // *********************************************************************** //
+    // ************************** IMPLEMENTATION ***************************** //
+    // *********************************************************************** //
+
+
+    /////////////////////////////////////////////////////////
+    // Constructors
+    /////////////////////////////////////////////////////////
+    template <typename T, ds_u64 N, typename Allocator>
+    DSmall_Vector<T, N, Allocator>::DSmall_Vector()
+        : base_type()
+    {
+        use_inline_buffer();
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    DSmall_Vector<T, N, Allocator>::DSmall_Vector(const Allocator& alloc)
+        : base_type(allocator_type(alloc))
+    {
+        use_inline_buffer();
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    DSmall_Vector<T, N, Allocator>::DSmall_Vector(size_type count, const T& value, const Allocator& alloc)
+        : base_type(allocator_type(alloc))
+    {
+        use_inline_buffer();
+        this->resize(count, value);
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    DSmall_Vector<T, N, Allocator>::DSmall_Vector(std::initializer_list<T> init, const Allocator& alloc)
+        : base_type(allocator_type(alloc))
+    {
+        use_inline_buffer();
+        base_type::operator=(init);
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    DSmall_Vector<T, N, Allocator>::DSmall_Vector(const DSmall_Vector& other)
+        : base_type(other.m_allocator)
+    {
+        use_inline_buffer();
+        base_type::operator=(other);
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    DSmall_Vector<T, N, Allocator>::DSmall_Vector(DSmall_Vector&& other) noexcept
+        : base_type(other.m_allocator)
+    {
+        take_from(other);
+    }
+
+    /////////////////////////////////////////////////////////
+    // Assignment Operators
+    /////////////////////////////////////////////////////////
+
+    template <typename T, ds_u64 N, typename Allocator>
+    DSmall_Vector<T, N, Allocator>& DSmall_Vector<T, N, Allocator>::operator=(const DSmall_Vector& other)
+    {
+        // Storage stays where it is unless it is too small for other's elements
+        base_type::operator=(other);
+        return *this;
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    DSmall_Vector<T, N, Allocator>& DSmall_Vector<T, N, Allocator>::operator=(DSmall_Vector&& other) noexcept
+    {
+        if (this != &other) {
+            take_from(other);
+        }
+
+        return *this;
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    DSmall_Vector<T, N, Allocator>& DSmall_Vector<T, N, Allocator>::operator=(std::initializer_list<T> ilist)
+    {
+        base_type::operator=(ilist);
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////
+    // Small Buffer Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename T, ds_u64 N, typename Allocator>
+    bool DSmall_Vector<T, N, Allocator>::is_inline() const noexcept
+    {
+        return this->m_data == nullptr || this->m_allocator.is_inline(this->m_data);
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    void DSmall_Vector<T, N, Allocator>::swap(DSmall_Vector& other) noexcept
+    {
+        if (this == &other) {
+            return;
+        }
+
+        // Inline elements can't trade places by pointer, so go through a temporary
+        DSmall_Vector temp(std::move(other));
+        other.take_from(*this);
+        take_from(temp);
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    void DSmall_Vector<T, N, Allocator>::use_inline_buffer() noexcept
+    {
+        // The buffer is free whenever the vector holds no storage, so this always returns it
+        this->m_data = this->m_allocator.allocate(N);
+        this->m_capacity = N;
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    void DSmall_Vector<T, N, Allocator>::take_from(DSmall_Vector& other) noexcept
+    {
+        // Drop our own elements and heap storage
+        this->clear();
+        if (this->m_data && !this->m_allocator.is_inline(this->m_data)) {
+            this->m_allocator.deallocate(this->m_data, this->m_capacity);
+            this->m_data = nullptr;
+            this->m_capacity = 0;
+        }
+
+        this->m_allocator = other.m_allocator;
+
+        if (other.is_inline()) {
+            // Elements live inside other, move them into our own buffer
+            if (!this->m_data) {
+                use_inline_buffer();
+            }
+
+            if constexpr (base_type::IS_RELOCATABLE) {
+                if (other.m_size > 0) {
+                    memory::Memory::Memcpy(static_cast<void*>(this->m_data), static_cast<const void*>(other.m_data), other.m_size * sizeof(T));
+                }
+            }
+            else {
+                for (size_type i = 0; i < other.m_size; ++i) {
+                    allocator_traits::construct(this->m_allocator, this->m_data + i, std::move(other.m_data[i]));
+                    allocator_traits::destroy(other.m_allocator, other.m_data + i);
+                }
+            }
+
+            this->m_size = other.m_size;
+            other.m_size = 0;
+        }
+        else {
+            // Heap storage changes hands, other goes back to its inline buffer
+            if (this->m_data) {
+                this->m_allocator.deallocate(this->m_data, this->m_capacity);
+            }
+
+            this->m_data = other.m_data;
+            this->m_size = other.m_size;
+            this->m_capacity = other.m_capacity;
+
+            other.m_data = nullptr;
+            other.m_size = 0;
+            other.m_capacity = 0;
+            other.use_inline_buffer();
+        }
+    }
+
+    /////////////////////////////////////////////////////////
+    // Non-member functions
+    /////////////////////////////////////////////////////////
+
+    template <typename T, ds_u64 N, typename Allocator>
+    bool operator==(const DSmall_Vector<T, N, Allocator>& lhs, const DSmall_Vector<T, N, Allocator>& rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    bool operator!=(const DSmall_Vector<T, N, Allocator>& lhs, const DSmall_Vector<T, N, Allocator>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    bool operator<(const DSmall_Vector<T, N, Allocator>& lhs, const DSmall_Vector<T, N, Allocator>& rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    bool operator>(const DSmall_Vector<T, N, Allocator>& lhs, const DSmall_Vector<T, N, Allocator>& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    bool operator<=(const DSmall_Vector<T, N, Allocator>& lhs, const DSmall_Vector<T, N, Allocator>& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    bool operator>=(const DSmall_Vector<T, N, Allocator>& lhs, const DSmall_Vector<T, N, Allocator>& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename T, ds_u64 N, typename Allocator>
+    void swap(DSmall_Vector<T, N, Allocator>& lhs, DSmall_Vector<T, N, Allocator>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+} // namespace ds::core::containers
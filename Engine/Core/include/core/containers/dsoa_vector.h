@@ -0,0 +1,457 @@
+#pragma once
+#include <core/containers/container_traits.h>
+#include <core/memory/allocator_interface.h>
+#include <core/memory/allocator_adapters.h>
+#include <core/memory/memory.h>
+#include <core/defines.h>
+#include <algorithm>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace ds::core::containers
+{
+	/**
+	 * Basic_SoA_Vector - Dynamic array storing each field in its own column
+	 *
+	 * Element i is the tuple of the i-th entries of every column. Each column is a contiguous,
+	 * SIMD_ALIGNMENT aligned array, so a loop over one or two fields only streams the memory it
+	 * uses and can be vectorized. All columns share a single allocation made through Allocator,
+	 * rebound to an internal SIMD_ALIGNMENT sized block type.
+	 *
+	 * Growth reallocates every column, so spans and references are invalidated like DVector's.
+	 *
+	 * @tparam Allocator Allocator family for the storage, any element type, must be rebindable
+	 *                   with memory::Rebind_Allocator
+	 * @tparam Ts Column types
+	 */
+	template <typename Allocator, typename... Ts>
+	class Basic_SoA_Vector
+	{
+		static_assert(sizeof...(Ts) > 0, "Basic_SoA_Vector needs at least one column");
+
+	public:
+		using value_type      = std::tuple<Ts...>;
+		using reference       = std::tuple<Ts&...>;
+		using const_reference = std::tuple<const Ts&...>;
+		using allocator_type  = Allocator;
+		using size_type       = ds_u64;
+
+		static constexpr size_type COLUMN_COUNT = sizeof...(Ts);
+
+		template <size_type I>
+		using column_type = std::tuple_element_t<I, value_type>;
+
+		//====================
+		// Constructors/Destructor
+		//====================
+
+		Basic_SoA_Vector() = default;
+		explicit Basic_SoA_Vector(const allocator_type& alloc) : m_allocator(alloc) {}
+		Basic_SoA_Vector(const Basic_SoA_Vector& other);
+		Basic_SoA_Vector(Basic_SoA_Vector&& other) noexcept;
+		~Basic_SoA_Vector();
+
+		Basic_SoA_Vector& operator=(const Basic_SoA_Vector& other);
+		Basic_SoA_Vector& operator=(Basic_SoA_Vector&& other) noexcept;
+
+		//====================
+		// Element Access
+		//====================
+
+		/**
+		 * Get one column as a span
+		 * @tparam I Column index
+		 * @return Span over size() entries of column I
+		 */
+		template <size_type I>
+		std::span<column_type<I>> column() noexcept { return { std::get<I>(m_columns), m_size }; }
+
+		template <size_type I>
+		std::span<const column_type<I>> column() const noexcept { return { std::get<I>(m_columns), m_size }; }
+
+		/**
+		 * Access element pos as a tuple of references into every column
+		 */
+		reference operator[](size_type pos) noexcept;
+		const_reference operator[](size_type pos) const noexcept;
+
+		reference back() noexcept { return (*this)[m_size - 1]; }
+		const_reference back() const noexcept { return (*this)[m_size - 1]; }
+
+		//====================
+		// Capacity
+		//====================
+
+		[[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+		size_type size() const noexcept { return m_size; }
+		size_type capacity() const noexcept { return m_capacity; }
+		void reserve(size_type new_cap);
+		void shrink_to_fit();
+
+		//====================
+		// Modifiers
+		//====================
+
+		void clear() noexcept;
+
+		void push_back(const value_type& value);
+		void push_back(value_type&& value);
+
+		/**
+		 * Append an element, one constructor argument per column
+		 */
+		template <typename... Args>
+		void emplace_back(Args&&... args);
+
+		void pop_back();
+
+		/**
+		 * Remove element pos by moving the last element into its place
+		 * O(1), but does not keep the order of the elements
+		 */
+		void swap_remove(size_type pos);
+
+		/**
+		 * Resize to count elements, new entries are value initialized
+		 */
+		void resize(size_type count);
+
+		void swap(Basic_SoA_Vector& other) noexcept;
+
+	private:
+		// Allocation granule, keeps every column start SIMD aligned
+		struct alignas(memory::SIMD_ALIGNMENT) Block
+		{
+			ds_u8 bytes[memory::SIMD_ALIGNMENT];
+		};
+
+		using Block_Allocator = memory::Rebind_Allocator<Allocator, Block>;
+		using Indices = std::index_sequence_for<Ts...>;
+
+		static constexpr size_type COLUMN_ALIGNMENT = std::max({ memory::SIMD_ALIGNMENT, static_cast<ds_u64>(alignof(Ts))... });
+		static_assert(COLUMN_ALIGNMENT == memory::SIMD_ALIGNMENT, "Basic_SoA_Vector columns can't be over-aligned past SIMD_ALIGNMENT");
+
+		static size_type block_count(size_type capacity) noexcept
+		{
+			size_type bytes = 0;
+			((bytes += memory::Memory::Align_Size(sizeof(Ts) * capacity, memory::SIMD_ALIGNMENT)), ...);
+			return bytes / sizeof(Block);
+		}
+
+		template <std::size_t... Is>
+		void point_columns(Block* blocks, size_type capacity, std::index_sequence<Is...>) noexcept;
+
+		template <std::size_t... Is, typename Tuple>
+		void construct_back(Tuple&& values, std::index_sequence<Is...>);
+
+		template <std::size_t... Is>
+		void move_columns_to(std::tuple<Ts*...>& destination, std::index_sequence<Is...>);
+
+		void destroy_range(size_type first, size_type last) noexcept;
+		void reallocate(size_type new_capacity);
+		void release() noexcept;
+
+		Block* m_blocks = nullptr;            ///< The single allocation backing every column
+		std::tuple<Ts*...> m_columns{};       ///< Start of each column inside m_blocks
+		size_type m_size = 0;                 ///< Number of elements
+		size_type m_capacity = 0;             ///< Elements each column has room for
+		DS_NO_UNIQUE_ADDRESS Block_Allocator m_allocator;
+	};
+
+	/**
+	 * DSoA_Vector - Basic_SoA_Vector on the default engine allocator
+	 * @tparam Ts Column types
+	 */
+	template <typename... Ts>
+	using DSoA_Vector = Basic_SoA_Vector<memory::Default_Allocator<ds_u8>, Ts...>;
+
+
+    // *********************************************************************** //
+    // ************************** IMPLEMENTATION ***************************** //
+    // *********************************************************************** //
+
+
+    /////////////////////////////////////////////////////////
+    // Constructors and Destructor
+    /////////////////////////////////////////////////////////
+
+    template <typename Allocator, typename... Ts>
+    Basic_SoA_Vector<Allocator, Ts...>::Basic_SoA_Vector(const Basic_SoA_Vector& other)
+        : m_allocator(other.m_allocator)
+    {
+        reserve(other.m_size);
+        for (size_type i = 0; i < other.m_size; ++i) {
+            construct_back(other[i], Indices{});
+            ++m_size;
+        }
+    }
+
+    template <typename Allocator, typename... Ts>
+    Basic_SoA_Vector<Allocator, Ts...>::Basic_SoA_Vector(Basic_SoA_Vector&& other) noexcept
+        : m_blocks(other.m_blocks), m_columns(other.m_columns), m_size(other.m_size),
+          m_capacity(other.m_capacity), m_allocator(other.m_allocator)
+    {
+        other.m_blocks = nullptr;
+        other.m_columns = {};
+        other.m_size = 0;
+        other.m_capacity = 0;
+    }
+
+    template <typename Allocator, typename... Ts>
+    Basic_SoA_Vector<Allocator, Ts...>::~Basic_SoA_Vector()
+    {
+        release();
+    }
+
+    template <typename Allocator, typename... Ts>
+    Basic_SoA_Vector<Allocator, Ts...>& Basic_SoA_Vector<Allocator, Ts...>::operator=(const Basic_SoA_Vector& other)
+    {
+        if (this != &other) {
+            Basic_SoA_Vector copy(other);
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    template <typename Allocator, typename... Ts>
+    Basic_SoA_Vector<Allocator, Ts...>& Basic_SoA_Vector<Allocator, Ts...>::operator=(Basic_SoA_Vector&& other) noexcept
+    {
+        if (this != &other) {
+            release();
+            swap(other);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////
+    // Element Access Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename Allocator, typename... Ts>
+    typename Basic_SoA_Vector<Allocator, Ts...>::reference Basic_SoA_Vector<Allocator, Ts...>::operator[](size_type pos) noexcept
+    {
+        return std::apply([pos](Ts*... columns) { return reference(columns[pos]...); }, m_columns);
+    }
+
+    template <typename Allocator, typename... Ts>
+    typename Basic_SoA_Vector<Allocator, Ts...>::const_reference Basic_SoA_Vector<Allocator, Ts...>::operator[](size_type pos) const noexcept
+    {
+        return std::apply([pos](Ts*... columns) { return const_reference(columns[pos]...); }, m_columns);
+    }
+
+    /////////////////////////////////////////////////////////
+    // Capacity Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename Allocator, typename... Ts>
+    void Basic_SoA_Vector<Allocator, Ts...>::reserve(size_type new_cap)
+    {
+        if (new_cap > m_capacity) {
+            reallocate(new_cap);
+        }
+    }
+
+    template <typename Allocator, typename... Ts>
+    void Basic_SoA_Vector<Allocator, Ts...>::shrink_to_fit()
+    {
+        if (m_size == 0) {
+            release();
+        }
+        else if (m_size < m_capacity) {
+            reallocate(m_size);
+        }
+    }
+
+    /////////////////////////////////////////////////////////
+    // Modifier Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename Allocator, typename... Ts>
+    void Basic_SoA_Vector<Allocator, Ts...>::clear() noexcept
+    {
+        destroy_range(0, m_size);
+        m_size = 0;
+    }
+
+    template <typename Allocator, typename... Ts>
+    void Basic_SoA_Vector<Allocator, Ts...>::push_back(const value_type& value)
+    {
+        if (m_size == m_capacity) {
+            reallocate(m_capacity == 0 ? 8 : m_capacity * 2);
+        }
+
+        construct_back(value, Indices{});
+        ++m_size;
+    }
+
+    template <typename Allocator, typename... Ts>
+    void Basic_SoA_Vector<Allocator, Ts...>::push_back(value_type&& value)
+    {
+        if (m_size == m_capacity) {
+            reallocate(m_capacity == 0 ? 8 : m_capacity * 2);
+        }
+
+        construct_back(std::move(value), Indices{});
+        ++m_size;
+    }
+
+    template <typename Allocator, typename... Ts>
+    template <typename... Args>
+    void Basic_SoA_Vector<Allocator, Ts...>::emplace_back(Args&&... args)
+    {
+        static_assert(sizeof...(Args) == sizeof...(Ts), "Basic_SoA_Vector::emplace_back takes one argument per column");
+
+        if (m_size == m_capacity) {
+            reallocate(m_capacity == 0 ? 8 : m_capacity * 2);
+        }
+
+        construct_back(std::forward_as_tuple(std::forward<Args>(args)...), Indices{});
+        ++m_size;
+    }
+
+    template <typename Allocator, typename... Ts>
+    void Basic_SoA_Vector<Allocator, Ts...>::pop_back()
+    {
+        DS_ASSERT(m_size > 0, "Basic_SoA_Vector::pop_back - Vector is empty");
+        destroy_range(m_size - 1, m_size);
+        --m_size;
+    }
+
+    template <typename Allocator, typename... Ts>
+    void Basic_SoA_Vector<Allocator, Ts...>::swap_remove(size_type pos)
+    {
+        DS_ASSERT(pos < m_size, "Basic_SoA_Vector::swap_remove - Index out of range");
+
+        if (pos != m_size - 1) {
+            (*this)[pos] = std::apply([](auto&... last) { return std::forward_as_tuple(std::move(last)...); }, back());
+        }
+
+        pop_back();
+    }
+
+    template <typename Allocator, typename... Ts>
+    void Basic_SoA_Vector<Allocator, Ts...>::resize(size_type count)
+    {
+        if (count < m_size) {
+            destroy_range(count, m_size);
+            m_size = count;
+            return;
+        }
+
+        reserve(count);
+        while (m_size < count) {
+            construct_back(value_type{}, Indices{});
+            ++m_size;
+        }
+    }
+
+    template <typename Allocator, typename... Ts>
+    void Basic_SoA_Vector<Allocator, Ts...>::swap(Basic_SoA_Vector& other) noexcept
+    {
+        std::swap(m_blocks, other.m_blocks);
+        std::swap(m_columns, other.m_columns);
+        std::swap(m_size, other.m_size);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_allocator, other.m_allocator);
+    }
+
+    /////////////////////////////////////////////////////////
+    // Helper Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename Allocator, typename... Ts>
+    template <std::size_t... Is>
+    void Basic_SoA_Vector<Allocator, Ts...>::point_columns(Block* blocks, size_type capacity, std::index_sequence<Is...>) noexcept
+    {
+        // Columns are laid out back to back, each padded to the SIMD alignment
+        ds_u8* cursor = reinterpret_cast<ds_u8*>(blocks);
+        ((std::get<Is>(m_columns) = reinterpret_cast<column_type<Is>*>(cursor),
+          cursor += memory::Memory::Align_Size(sizeof(column_type<Is>) * capacity, memory::SIMD_ALIGNMENT)), ...);
+    }
+
+    template <typename Allocator, typename... Ts>
+    template <std::size_t... Is, typename Tuple>
+    void Basic_SoA_Vector<Allocator, Ts...>::construct_back(Tuple&& values, std::index_sequence<Is...>)
+    {
+        (new (std::get<Is>(m_columns) + m_size) column_type<Is>(std::get<Is>(std::forward<Tuple>(values))), ...);
+    }
+
+    template <typename Allocator, typename... Ts>
+    template <std::size_t... Is>
+    void Basic_SoA_Vector<Allocator, Ts...>::move_columns_to(std::tuple<Ts*...>& destination, std::index_sequence<Is...>)
+    {
+        auto move_column = [this](auto* source, auto* target) {
+            using T = std::remove_pointer_t<decltype(source)>;
+            if constexpr (ds_is_trivially_relocatable_v<T>) {
+                if (m_size > 0) {
+                    memory::Memory::Memcpy(static_cast<void*>(target), static_cast<const void*>(source), sizeof(T) * m_size);
+                }
+            }
+            else {
+                for (size_type i = 0; i < m_size; ++i) {
+                    new (target + i) T(std::move(source[i]));
+                    source[i].~T();
+                }
+            }
+        };
+
+        (move_column(std::get<Is>(m_columns), std::get<Is>(destination)), ...);
+    }
+
+    template <typename Allocator, typename... Ts>
+    void Basic_SoA_Vector<Allocator, Ts...>::destroy_range(size_type first, size_type last) noexcept
+    {
+        std::apply([first, last](Ts*... columns) {
+            auto destroy_column = [first, last](auto* column) {
+                using T = std::remove_pointer_t<decltype(column)>;
+                if constexpr (!std::is_trivially_destructible_v<T>) {
+                    for (size_type i = first; i < last; ++i) {
+                        column[i].~T();
+                    }
+                }
+            };
+            (destroy_column(columns), ...);
+        }, m_columns);
+    }
+
+    template <typename Allocator, typename... Ts>
+    void Basic_SoA_Vector<Allocator, Ts...>::reallocate(size_type new_capacity)
+    {
+        Block* new_blocks = m_allocator.allocate(block_count(new_capacity));
+        DS_ASSERT(new_blocks, "Basic_SoA_Vector - Failed to allocate column storage");
+
+        std::tuple<Ts*...> old_columns = m_columns;
+        point_columns(new_blocks, new_capacity, Indices{});
+
+        // Relocate every column from the old allocation into the new one
+        std::tuple<Ts*...> new_columns = m_columns;
+        m_columns = old_columns;
+        move_columns_to(new_columns, Indices{});
+        m_columns = new_columns;
+
+        if (m_blocks) {
+            m_allocator.deallocate(m_blocks, block_count(m_capacity));
+        }
+
+        m_blocks = new_blocks;
+        m_capacity = new_capacity;
+    }
+
+    template <typename Allocator, typename... Ts>
+    void Basic_SoA_Vector<Allocator, Ts...>::release() noexcept
+    {
+        if (m_blocks) {
+            destroy_range(0, m_size);
+            m_allocator.deallocate(m_blocks, block_count(m_capacity));
+        }
+
+        m_blocks = nullptr;
+        m_columns = {};
+        m_size = 0;
+        m_capacity = 0;
+    }
+
+} // namespace ds::core::containers
@@ -0,0 +1,222 @@
+#pragma once
+#include <core/memory/allocator_interface.h>
+#include <core/memory/allocator_adapters.h>
+#include <core/memory/memory.h>
+#include <core/defines.h>
+#include <atomic>
+
+namespace ds::core::containers
+{
+	/**
+	 * DSPSC_Ring - Bounded lock-free single producer, single consumer ring buffer
+	 *
+	 * One thread pushes and one thread pops, without locks. The read and write indices sit on
+	 * their own cache lines, and each side keeps a cached copy of the other side's index so it
+	 * only touches the shared line when the ring looks full or empty.
+	 *
+	 * Capacity is rounded up to a power of two. Storage comes from Allocator once, at
+	 * construction.
+	 *
+	 * @tparam T Type of the elements
+	 * @tparam Allocator Allocator for T, must model memory::Ds_Allocator
+	 */
+	template <typename T, typename Allocator = memory::Default_Allocator<T>>
+	class DSPSC_Ring
+	{
+		static_assert(memory::Ds_Allocator<Allocator>, "DSPSC_Ring requires an allocator that models Ds_Allocator");
+
+	public:
+		using value_type     = T;
+		using allocator_type = Allocator;
+		using size_type      = ds_u64;
+
+		/**
+		 * Create a ring
+		 * @param capacity Minimum number of elements the ring holds
+		 * @param alloc Allocator for the element storage
+		 */
+		explicit DSPSC_Ring(size_type capacity, const allocator_type& alloc = allocator_type());
+		~DSPSC_Ring();
+
+		DSPSC_Ring(const DSPSC_Ring&) = delete;
+		DSPSC_Ring& operator=(const DSPSC_Ring&) = delete;
+
+		//====================
+		// Producer side
+		//====================
+
+		/**
+		 * Construct an element at the back of the ring
+		 * @return False if the ring is full, nothing is constructed then
+		 */
+		template <typename... Args>
+		bool try_emplace(Args&&... args);
+
+		bool try_push(const T& value) { return try_emplace(value); }
+		bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+		//====================
+		// Consumer side
+		//====================
+
+		/**
+		 * Move the front element out of the ring
+		 * @param out Receives the element
+		 * @return False if the ring is empty
+		 */
+		bool try_pop(T& out);
+
+		/**
+		 * Peek at the front element without removing it
+		 * @return Pointer to the element, or nullptr if the ring is empty
+		 */
+		T* front();
+
+		/**
+		 * Remove the front element, the ring must not be empty
+		 */
+		void pop();
+
+		//====================
+		// Capacity
+		//====================
+
+		/**
+		 * Get the number of elements, exact only when called from the producer or consumer
+		 * while the other side is idle
+		 */
+		size_type size() const noexcept
+		{
+			return m_write_index.load(std::memory_order_acquire) - m_read_index.load(std::memory_order_acquire);
+		}
+
+		[[nodiscard]] bool empty() const noexcept { return size() == 0; }
+		size_type capacity() const noexcept { return m_mask + 1; }
+
+	private:
+		static size_type round_up_capacity(size_type capacity) noexcept
+		{
+			size_type result = 1;
+			while (result < capacity) {
+				result <<= 1;
+			}
+			return result;
+		}
+
+		using allocator_traits = memory::Allocator_Traits<Allocator>;
+
+		// Written by the consumer, read by the producer
+		alignas(memory::CACHE_LINE_SIZE) std::atomic<size_type> m_read_index{ 0 };
+		size_type m_cached_write_index = 0;    ///< Consumer's last view of m_write_index
+
+		// Written by the producer, read by the consumer
+		alignas(memory::CACHE_LINE_SIZE) std::atomic<size_type> m_write_index{ 0 };
+		size_type m_cached_read_index = 0;     ///< Producer's last view of m_read_index
+
+		// Shared read-only state
+		alignas(memory::CACHE_LINE_SIZE) T* m_data = nullptr;
+		size_type m_mask = 0;
+		DS_NO_UNIQUE_ADDRESS allocator_type m_allocator;
+	};
+
+
+    // *********************************************************************** //
+    // ************************** IMPLEMENTATION ***************************** //
+    // *********************************************************************** //
+
+
+    /////////////////////////////////////////////////////////
+    // Constructors and Destructor
+    /////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    DSPSC_Ring<T, Allocator>::DSPSC_Ring(size_type capacity, const allocator_type& alloc)
+        : m_mask(round_up_capacity(capacity > 0 ? capacity : 1) - 1), m_allocator(alloc)
+    {
+        m_data = m_allocator.allocate(m_mask + 1);
+        DS_ASSERT(m_data, "DSPSC_Ring - Failed to allocate ring storage");
+    }
+
+    template <typename T, typename Allocator>
+    DSPSC_Ring<T, Allocator>::~DSPSC_Ring()
+    {
+        if (!m_data) {
+            return;
+        }
+
+        size_type read = m_read_index.load(std::memory_order_relaxed);
+        size_type write = m_write_index.load(std::memory_order_relaxed);
+        for (; read != write; ++read) {
+            allocator_traits::destroy(m_allocator, m_data + (read & m_mask));
+        }
+
+        m_allocator.deallocate(m_data, m_mask + 1);
+    }
+
+    /////////////////////////////////////////////////////////
+    // Producer Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    template <typename... Args>
+    bool DSPSC_Ring<T, Allocator>::try_emplace(Args&&... args)
+    {
+        size_type write = m_write_index.load(std::memory_order_relaxed);
+
+        // Only reload the consumer's index when the cached one says the ring is full
+        if (write - m_cached_read_index > m_mask) {
+            m_cached_read_index = m_read_index.load(std::memory_order_acquire);
+            if (write - m_cached_read_index > m_mask) {
+                return false;
+            }
+        }
+
+        allocator_traits::construct(m_allocator, m_data + (write & m_mask), std::forward<Args>(args)...);
+        m_write_index.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////
+    // Consumer Methods
+    /////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    T* DSPSC_Ring<T, Allocator>::front()
+    {
+        size_type read = m_read_index.load(std::memory_order_relaxed);
+
+        // Only reload the producer's index when the cached one says the ring is empty
+        if (read == m_cached_write_index) {
+            m_cached_write_index = m_write_index.load(std::memory_order_acquire);
+            if (read == m_cached_write_index) {
+                return nullptr;
+            }
+        }
+
+        return m_data + (read & m_mask);
+    }
+
+    template <typename T, typename Allocator>
+    void DSPSC_Ring<T, Allocator>::pop()
+    {
+        size_type read = m_read_index.load(std::memory_order_relaxed);
+        DS_ASSERT(read != m_write_index.load(std::memory_order_acquire), "DSPSC_Ring::pop - Ring is empty");
+
+        allocator_traits::destroy(m_allocator, m_data + (read & m_mask));
+        m_read_index.store(read + 1, std::memory_order_release);
+    }
+
+    template <typename T, typename Allocator>
+    bool DSPSC_Ring<T, Allocator>::try_pop(T& out)
+    {
+        T* value = front();
+        if (!value) {
+            return false;
+        }
+
+        out = std::move(*value);
+        pop();
+        return true;
+    }
+
+} // namespace ds::core::containers
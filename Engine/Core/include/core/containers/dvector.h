@@ -1,7 +1,9 @@
 #pragma once
 #include <core/memory/allocator_interface.h>
 #include <core/memory/allocator_adapters.h>
+#include <core/containers/container_traits.h>
 #include <core/defines.h>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 
@@ -14,11 +16,13 @@ namespace ds::core::containers
 	 * supports dynamic resizing. Integrated with Destan's custom memory allocators.
 	 * 
 	 * @tparam T Type of the elements
-	 * @tparam Allocator Allocator type used for memory management
+	 * @tparam Allocator Allocator type used for memory management, must model memory::Ds_Allocator
 	 */
 	template <typename T, typename Allocator = memory::Default_Allocator<T>>
 	class DVector
 	{
+		static_assert(memory::Ds_Allocator<Allocator>, "DVector requires an allocator that models Ds_Allocator");
+
 	public:
 		// Type definitions
 		using value_type      = T;
@@ -70,7 +74,7 @@ namespace ds::core::containers
 			bool operator>=(const iterator& other) const { return m_ptr >= other.m_ptr; }
 
 		private:
-			pinter m_ptr;
+			pointer m_ptr;
 
 			friend class DVector;
 		};
@@ -352,18 +356,49 @@ namespace ds::core::containers
 		void resize(size_type count, const value_type& value);
 		void swap(DVector& other) noexcept;
 
-	private:
+	protected:
+		/**
+		 * Whether an address points at one of the current elements
+		 */
+		bool is_element(const T* address) const noexcept
+		{
+			return std::less_equal<const T*>()(m_data, address) && std::less<const T*>()(address, m_data + m_size);
+		}
+
 		/**
 		 * Reallocate the vector storage to a new capacity
+		 * Grows the current buffer in place when the allocator supports it
 		 * @param new_cap New capacity
 		 */
 		void reallocate(size_type new_cap);
 
+		/**
+		 * Destroy the elements in [first, last), skipped entirely for trivially destructible types
+		 * @param first Index of the first element to destroy
+		 * @param last Index one past the last element to destroy
+		 */
+		void destroy_range(size_type first, size_type last) noexcept;
+
+		/**
+		 * Move the elements in [from, m_size) to start at index to, leaving the source slots unconstructed
+		 * @param from Index of the first element to move
+		 * @param to Destination index of the first element
+		 */
+		void relocate_tail(size_type from, size_type to);
+
+		// Allocator hooks resolved at compile time
+		using allocator_traits = memory::Allocator_Traits<Allocator>;
+
+		// Element traits that select bulk memory operations over per-element loops
+		static constexpr bool IS_RELOCATABLE = ds_is_trivially_relocatable_v<T>;
+		static constexpr bool IS_TRIVIALLY_COPYABLE = std::is_trivially_copyable_v<T>;
+		static constexpr bool IS_TRIVIALLY_DESTRUCTIBLE = std::is_trivially_destructible_v<T>;
+
 		// Member variables
 		pointer m_data = nullptr;       ///< Pointer to the storage
 		size_type m_size = 0;           ///< Number of elements
 		size_type m_capacity = 0;       ///< Storage capacity
-		allocator_type m_allocator;     ///< Allocator instance
+		DS_NO_UNIQUE_ADDRESS allocator_type m_allocator; ///< Allocator instance, takes no space when stateless
 	};
 
 	//====================
@@ -430,8 +465,15 @@ namespace ds::core::containers
         reserve(other.m_size);
 
         // Copy construct elements from other vector
-        for (size_type i = 0; i < other.m_size; ++i) {
-            m_allocator.construct(m_data + i, other.m_data[i]);
+        if constexpr (IS_TRIVIALLY_COPYABLE) {
+            if (other.m_size > 0) {
+                memory::Memory::Memcpy(m_data, other.m_data, other.m_size * sizeof(T));
+            }
+        }
+        else {
+            for (size_type i = 0; i < other.m_size; ++i) {
+                allocator_traits::construct(m_allocator, m_data + i, other.m_data[i]);
+            }
         }
 
         m_size = other.m_size;
@@ -498,8 +540,15 @@ namespace ds::core::containers
             }
 
             // Copy construct elements
-            for (size_type i = 0; i < other.m_size; ++i) {
-                m_allocator.construct(m_data + i, other.m_data[i]);
+            if constexpr (IS_TRIVIALLY_COPYABLE) {
+                if (other.m_size > 0) {
+                    memory::Memory::Memcpy(m_data, other.m_data, other.m_size * sizeof(T));
+                }
+            }
+            else {
+                for (size_type i = 0; i < other.m_size; ++i) {
+                    allocator_traits::construct(m_allocator, m_data + i, other.m_data[i]);
+                }
             }
 
             m_size = other.m_size;
@@ -553,7 +602,7 @@ namespace ds::core::containers
         // Copy elements
         size_type i = 0;
         for (const auto& item : ilist) {
-            m_allocator.construct(m_data + i, item);
+            allocator_traits::construct(m_allocator, m_data + i, item);
             ++i;
         }
 
@@ -788,9 +837,7 @@ namespace ds::core::containers
     void DVector<T, Allocator>::clear() noexcept
     {
         // Destroy all elements but keep capacity
-        for (size_type i = 0; i < m_size; ++i) {
-            m_allocator.destroy(m_data + i);
-        }
+        destroy_range(0, m_size);
         m_size = 0;
     }
 
@@ -801,6 +848,12 @@ namespace ds::core::containers
         size_type index = pos - cbegin();
         DS_ASSERT(index <= m_size, "DVector::insert - Invalid position");
 
+        // A value from this vector is copied out first, reallocating or shifting may move or free it
+        if (is_element(&value)) {
+            T copy(value);
+            return insert(pos, std::move(copy));
+        }
+
         // Check if we need to reallocate
         if (m_size == m_capacity) {
             size_type new_capacity = m_capacity == 0 ? 1 : m_capacity * 2;
@@ -808,13 +861,10 @@ namespace ds::core::containers
         }
 
         // Shift elements to make space
-        for (size_type i = m_size; i > index; --i) {
-            m_allocator.construct(m_data + i, std::move(m_data[i - 1]));
-            m_allocator.destroy(m_data + i - 1);
-        }
+        relocate_tail(index, index + 1);
 
         // Insert the new element
-        m_allocator.construct(m_data + index, value);
+        allocator_traits::construct(m_allocator, m_data + index, value);
         ++m_size;
 
         return iterator(m_data + index);
@@ -834,13 +884,10 @@ namespace ds::core::containers
         }
 
         // Shift elements to make space
-        for (size_type i = m_size; i > index; --i) {
-            m_allocator.construct(m_data + i, std::move(m_data[i - 1]));
-            m_allocator.destroy(m_data + i - 1);
-        }
+        relocate_tail(index, index + 1);
 
         // Insert the new element
-        m_allocator.construct(m_data + index, std::move(value));
+        allocator_traits::construct(m_allocator, m_data + index, std::move(value));
         ++m_size;
 
         return iterator(m_data + index);
@@ -857,6 +904,12 @@ namespace ds::core::containers
             return iterator(m_data + index);
         }
 
+        // A value from this vector is copied out first, reallocating or shifting may move or free it
+        if (is_element(&value)) {
+            T copy(value);
+            return insert(pos, count, copy);
+        }
+
         // Check if we need to reallocate
         if (m_size + count > m_capacity) {
             size_type new_capacity = std::max(m_capacity * 2, m_size + count);
@@ -864,17 +917,11 @@ namespace ds::core::containers
         }
 
         // Shift elements to make space
-        for (size_type i = m_size + count - 1; i >= index + count; --i) {
-            m_allocator.construct(m_data + i, std::move(m_data[i - count]));
-            m_allocator.destroy(m_data + i - count);
-
-            // Handle potential underflow for unsigned type
-            if (i == index + count) break;
-        }
+        relocate_tail(index, index + count);
 
         // Insert the new elements
         for (size_type i = 0; i < count; ++i) {
-            m_allocator.construct(m_data + index + i, value);
+            allocator_traits::construct(m_allocator, m_data + index + i, value);
         }
 
         m_size += count;
@@ -896,13 +943,10 @@ namespace ds::core::containers
         }
 
         // Shift elements to make space
-        for (size_type i = m_size; i > index; --i) {
-            m_allocator.construct(m_data + i, std::move(m_data[i - 1]));
-            m_allocator.destroy(m_data + i - 1);
-        }
+        relocate_tail(index, index + 1);
 
         // Construct the new element in-place
-        m_allocator.construct(m_data + index, std::forward<Args>(args)...);
+        allocator_traits::construct(m_allocator, m_data + index, std::forward<Args>(args)...);
         ++m_size;
 
         return iterator(m_data + index);
@@ -916,13 +960,10 @@ namespace ds::core::containers
         DS_ASSERT(index < m_size, "DVector::erase - Invalid position");
 
         // Destroy the element at position
-        m_allocator.destroy(m_data + index);
+        destroy_range(index, index + 1);
 
         // Shift remaining elements
-        for (size_type i = index; i < m_size - 1; ++i) {
-            m_allocator.construct(m_data + i, std::move(m_data[i + 1]));
-            m_allocator.destroy(m_data + i + 1);
-        }
+        relocate_tail(index + 1, index);
 
         --m_size;
         return iterator(m_data + index);
@@ -945,15 +986,10 @@ namespace ds::core::containers
         size_type count = end_index - start_index;
 
         // Destroy elements in the range
-        for (size_type i = start_index; i < end_index; ++i) {
-            m_allocator.destroy(m_data + i);
-        }
+        destroy_range(start_index, end_index);
 
         // Shift remaining elements
-        for (size_type i = start_index; i < m_size - count; ++i) {
-            m_allocator.construct(m_data + i, std::move(m_data[i + count]));
-            m_allocator.destroy(m_data + i + count);
-        }
+        relocate_tail(end_index, start_index);
 
         m_size -= count;
         return iterator(m_data + start_index);
@@ -970,7 +1006,7 @@ namespace ds::core::containers
         }
 
         // Construct new element
-        m_allocator.construct(m_data + m_size, value);
+        allocator_traits::construct(m_allocator, m_data + m_size, value);
         ++m_size;
     }
 
@@ -985,7 +1021,7 @@ namespace ds::core::containers
         }
 
         // Move-construct new element
-        m_allocator.construct(m_data + m_size, std::move(value));
+        allocator_traits::construct(m_allocator, m_data + m_size, std::move(value));
         ++m_size;
     }
 
@@ -1001,7 +1037,7 @@ namespace ds::core::containers
         }
 
         // Construct in-place
-        m_allocator.construct(m_data + m_size, std::forward<Args>(args)...);
+        allocator_traits::construct(m_allocator, m_data + m_size, std::forward<Args>(args)...);
         return m_data[m_size++];
     }
 
@@ -1012,7 +1048,7 @@ namespace ds::core::containers
         DS_ASSERT(m_size > 0, "DVector::pop_back - Vector is empty");
 
         --m_size;
-        m_allocator.destroy(m_data + m_size);
+        allocator_traits::destroy(m_allocator, m_data + m_size);
     }
 
     template <typename T, typename Allocator>
@@ -1033,14 +1069,12 @@ namespace ds::core::containers
 
             // Construct new elements
             for (size_type i = m_size; i < count; ++i) {
-                m_allocator.construct(m_data + i, value);
+                allocator_traits::construct(m_allocator, m_data + i, value);
             }
         }
         else if (count < m_size) {
             // Shrink - destroy excess elements
-            for (size_type i = count; i < m_size; ++i) {
-                m_allocator.destroy(m_data + i);
-            }
+            destroy_range(count, m_size);
         }
 
         m_size = count;
@@ -1064,14 +1098,26 @@ namespace ds::core::containers
     void DVector<T, Allocator>::reallocate(size_type new_cap)
     {
         // Reallocate vector with larger capacity
+        // Grow the current buffer in place if the allocator can, nothing has to move then
+        if (m_data && new_cap > m_capacity && allocator_traits::try_expand(m_allocator, m_data, m_capacity, new_cap)) {
+            m_capacity = new_cap;
+            return;
+        }
+
         // Allocate new buffer
         pointer new_data = m_allocator.allocate(new_cap);
 
         // Move elements to new buffer if we had existing elements
         if (m_size > 0) {
-            for (size_type i = 0; i < m_size; ++i) {
-                m_allocator.construct(new_data + i, std::move(m_data[i]));
-                m_allocator.destroy(m_data + i);
+            if constexpr (IS_RELOCATABLE) {
+                // Relocatable types move with one copy and need no destructor call on the old slots
+                memory::Memory::Memcpy(static_cast<void*>(new_data), static_cast<const void*>(m_data), m_size * sizeof(T));
+            }
+            else {
+                for (size_type i = 0; i < m_size; ++i) {
+                    allocator_traits::construct(m_allocator, new_data + i, std::move(m_data[i]));
+                    allocator_traits::destroy(m_allocator, m_data + i);
+                }
             }
         }
 
@@ -1085,6 +1131,44 @@ namespace ds::core::containers
         m_capacity = new_cap;
     }
 
+    template <typename T, typename Allocator>
+    void DVector<T, Allocator>::destroy_range(size_type first, size_type last) noexcept
+    {
+        if constexpr (!IS_TRIVIALLY_DESTRUCTIBLE) {
+            for (size_type i = first; i < last; ++i) {
+                allocator_traits::destroy(m_allocator, m_data + i);
+            }
+        }
+    }
+
+    template <typename T, typename Allocator>
+    void DVector<T, Allocator>::relocate_tail(size_type from, size_type to)
+    {
+        // Capacity for the shifted range must already be available
+        if (from == to || from >= m_size) {
+            return;
+        }
+
+        const size_type count = m_size - from;
+
+        if constexpr (IS_RELOCATABLE) {
+            memory::Memory::Memmove(static_cast<void*>(m_data + to), static_cast<const void*>(m_data + from), count * sizeof(T));
+        }
+        else if (to > from) {
+            // Moving right: walk backwards so nothing is overwritten before it moves
+            for (size_type i = count; i > 0; --i) {
+                allocator_traits::construct(m_allocator, m_data + to + i - 1, std::move(m_data[from + i - 1]));
+                allocator_traits::destroy(m_allocator, m_data + from + i - 1);
+            }
+        }
+        else {
+            for (size_type i = 0; i < count; ++i) {
+                allocator_traits::construct(m_allocator, m_data + to + i, std::move(m_data[from + i]));
+                allocator_traits::destroy(m_allocator, m_data + from + i);
+            }
+        }
+    }
+
     /////////////////////////////////////////////////////////
     // Non-member functions
     /////////////////////////////////////////////////////////
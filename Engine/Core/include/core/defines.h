@@ -26,6 +26,13 @@
     #error "Compiler not supported!"
 #endif
 
+// Lets empty members (stateless allocators, ...) share their address and take no space
+#if defined(DS_COMPILER_MSVC)
+    #define DS_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+    #define DS_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 // Detect CPU Architecture
 #if defined(_M_X64) || defined(__x86_64__)
     #define DS_ARCH_X64
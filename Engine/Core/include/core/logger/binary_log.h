@@ -0,0 +1,148 @@
+#pragma once
+#include <core/defines.h>
+#include <core/logger/log_sink.h>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ds::core
+{
+    /**
+     * Binary log files
+     *
+     * A file is a sequence of sessions. Each session starts with BINARY_LOG_MAGIC and is followed
+     * by entries, each a Binary_Log_Entry_Type byte and its fields. Numbers are stored in the
+     * writer's byte order, which is little endian on every platform the engine targets.
+     *
+     *  FORMAT   u32 id, u32 length, characters           Registers a format string for the session
+     *  MESSAGE  i64 timestamp, u64 monotonic, u8 level,  A deferred message, arguments packed as
+     *           u8 channel, u32 format id, u32 size,     in log_arguments.h
+     *           packed arguments
+     *  TEXT     i64 timestamp, u64 monotonic, u8 level,  A message logged as text
+     *           u8 channel, u32 length, characters
+     *
+     * Format ids are only valid within their session, a new session starts with no formats.
+     */
+
+    // Starts every session, the last byte is the format version
+    inline constexpr char BINARY_LOG_MAGIC[8] = { 'D', 'S', 'B', 'L', 'O', 'G', '\0', '\1' };
+
+    enum class Binary_Log_Entry_Type : ds_u8
+    {
+        FORMAT = 1,
+        MESSAGE = 2,
+        TEXT = 3
+    };
+
+    /**
+     * Binary_Log_Sink - Writes messages as compact binary entries
+     *
+     * Deferred messages are stored as a format id and their packed arguments, so the logger
+     * never formats them for this sink. Each format string is written once per session, the
+     * first time it is used. Use Binary_Log_Reader or the DsLogDecoder tool to read the file.
+     */
+    class Binary_Log_Sink : public Log_Sink
+    {
+    public:
+        /**
+         * Configuration structure for binary sinks
+         */
+        struct Config
+        {
+            std::string path = "ds.dslog";              // Path of the log file, new sessions are appended
+            ds_u64 buffer_size = 64 * 1024;             // Bytes buffered before they are written to the file
+        };
+
+        Binary_Log_Sink();
+        explicit Binary_Log_Sink(const Config& config);
+        ~Binary_Log_Sink() override;
+
+        Binary_Log_Sink(const Binary_Log_Sink&) = delete;
+        Binary_Log_Sink& operator=(const Binary_Log_Sink&) = delete;
+
+        void Write(const Log_Message& message) override;
+        void Flush() override;
+        bool Needs_Text() const override { return false; }
+
+        const Config& Get_Config() const { return m_config; }
+
+    private:
+        void Open();
+
+        /**
+         * Get the id of a format string, writing a FORMAT entry on its first use
+         */
+        ds_u32 Register_Format(std::string_view format);
+
+        template<typename T>
+        void Append(const T& value)
+        {
+            m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        Config m_config;
+        std::ofstream m_file;
+        std::string m_buffer;
+        bool m_failed = false;                              ///< Opening failed, stop trying
+
+        // Keyed by address: deferred format strings are literals that live for the whole program
+        std::unordered_map<const char*, ds_u32> m_format_ids;
+    };
+
+    /**
+     * Binary_Log_Reader - Reads the messages of a binary log file
+     *
+     * The whole file is read into memory on Open. Next fills a Log_Message whose views point into
+     * the reader and stay valid until the following call. A file cut short by a crash reads
+     * up to its last complete entry and then reports Is_Truncated.
+     */
+    class Binary_Log_Reader
+    {
+    public:
+        /**
+         * Read a binary log file
+         * @return False if the file can't be read or isn't a binary log
+         */
+        bool Open(const std::string& path);
+
+        /**
+         * Read the next message, formatting deferred ones into its text
+         * @return False at the end of the file or at the first malformed entry
+         */
+        bool Next(Log_Message& message);
+
+        /**
+         * Whether reading stopped at an incomplete or malformed entry rather than the end of the file
+         */
+        bool Is_Truncated() const { return m_truncated; }
+
+        /**
+         * Get the number of format strings registered in the current session
+         */
+        ds_u64 Get_Format_Count() const { return m_formats.size(); }
+
+    private:
+        template<typename T>
+        bool Read(T& value)
+        {
+            if (m_data.size() - m_offset < sizeof(T))
+            {
+                return false;
+            }
+
+            std::memcpy(&value, m_data.data() + m_offset, sizeof(T));
+            m_offset += sizeof(T);
+            return true;
+        }
+
+        bool Read_Magic();
+
+        std::string m_data;
+        ds_u64 m_offset = 0;
+        std::vector<std::string_view> m_formats;            ///< Indexed by format id
+        std::string m_text;                                 ///< Formatted text of the last message
+        bool m_truncated = false;
+    };
+}
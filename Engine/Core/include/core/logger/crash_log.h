@@ -0,0 +1,68 @@
+#pragma once
+#include <core/defines.h>
+#include <core/logger/log_sink.h>
+#include <string>
+#include <vector>
+
+namespace ds::core
+{
+    /**
+     * Crash log files
+     *
+     * Written by Logger::Enable_Crash_Log. A Crash_Log_Header is followed, at header_size, by
+     * ring_count thread rings of ring_capacity records of record_size bytes each. The rings are
+     * the logger's own thread rings, mapped from the file, so the file always holds the last
+     * records every thread logged whether or not they reached a sink.
+     */
+
+    // Starts every crash log, the last byte is the format version
+    inline constexpr char CRASH_LOG_MAGIC[8] = { 'D', 'S', 'C', 'R', 'A', 'S', 'H', '\1' };
+
+    struct Crash_Log_Header
+    {
+        char magic[8];
+        ds_u32 record_size;
+        ds_u32 ring_capacity;
+        ds_u32 ring_count;
+        ds_u32 header_size;             ///< Offset of the first ring
+    };
+
+    /**
+     * Crash_Log_Reader - Post-mortem reader for crash logs
+     *
+     * Open collects every complete message left in the rings and sorts them by monotonic
+     * time. Messages whose first records were already overwritten are skipped, a record a
+     * thread was in the middle of writing when the process died can come out garbled. The
+     * record layout is checked against the header's record size only, read files with the
+     * engine version that wrote them.
+     */
+    class Crash_Log_Reader
+    {
+    public:
+        /**
+         * Read a crash log
+         * @return False if the file can't be read or isn't a crash log
+         */
+        bool Open(const std::string& path);
+
+        /**
+         * Read the next message, in the order they were logged
+         * @return False after the last message
+         */
+        bool Next(Log_Message& message);
+
+        ds_u64 Get_Message_Count() const { return m_messages.size(); }
+
+    private:
+        struct Crash_Message
+        {
+            Log_Time time;
+            Log_Level level = Log_Level::INFO;
+            Log_Channel channel = Log_Channel::GENERAL;
+            std::string text;
+        };
+
+        std::vector<Crash_Message> m_messages;
+        ds_u64 m_next = 0;
+    };
+}
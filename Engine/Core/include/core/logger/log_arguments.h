@@ -0,0 +1,192 @@
+#pragma once
+#include <core/defines.h>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+
+namespace ds::core
+{
+    /**
+     * Packed log arguments
+     *
+     * Deferred log calls copy their argument values into the log record instead of formatting
+     * them. Each argument is written as a one byte type tag followed by its value: numbers,
+     * enums and pointers as their raw bytes, strings as a ds_u32 length and the characters.
+     * The tags let packed arguments be read back without the call site's C++ types.
+     */
+
+    // Type tag written before every packed argument
+    enum class Log_Argument_Type : ds_u8
+    {
+        BOOL,
+        CHAR,
+        I8,
+        I16,
+        I32,
+        I64,
+        U8,
+        U16,
+        U32,
+        U64,
+        F32,
+        F64,
+        POINTER,
+        STRING
+    };
+
+    // Arguments packed as their characters
+    template<typename T>
+    concept Log_String_Argument = std::is_convertible_v<const T&, std::string_view>;
+
+    // Arguments packed as their raw bytes
+    template<typename T>
+    concept Log_Value_Argument = !Log_String_Argument<T> &&
+        ((std::is_arithmetic_v<T> && !std::is_same_v<T, long double>) ||
+         std::is_enum_v<T> ||
+         std::is_same_v<std::remove_cv_t<std::remove_pointer_t<T>>, void>);
+
+    /**
+     * Arguments that can be packed and formatted later on another thread. Other types, and
+     * anything that refers to memory the caller owns other than strings, are formatted
+     * on the calling thread.
+     */
+    template<typename T>
+    concept Deferred_Log_Argument = Log_String_Argument<T> || Log_Value_Argument<T>;
+
+    /**
+     * Get the type tag for a deferred argument type
+     */
+    template<Deferred_Log_Argument T>
+    consteval Log_Argument_Type Get_Log_Argument_Type()
+    {
+        if constexpr (Log_String_Argument<T>) {
+            return Log_Argument_Type::STRING;
+        }
+        else if constexpr (std::is_enum_v<T>) {
+            return Get_Log_Argument_Type<std::underlying_type_t<T>>();
+        }
+        else if constexpr (std::is_pointer_v<T>) {
+            return Log_Argument_Type::POINTER;
+        }
+        else if constexpr (std::is_same_v<T, bool>) {
+            return Log_Argument_Type::BOOL;
+        }
+        else if constexpr (std::is_same_v<T, char>) {
+            return Log_Argument_Type::CHAR;
+        }
+        else if constexpr (std::is_floating_point_v<T>) {
+            return sizeof(T) == 4 ? Log_Argument_Type::F32 : Log_Argument_Type::F64;
+        }
+        else if constexpr (std::is_signed_v<T>) {
+            return sizeof(T) == 1 ? Log_Argument_Type::I8 : sizeof(T) == 2 ? Log_Argument_Type::I16 :
+                sizeof(T) == 4 ? Log_Argument_Type::I32 : Log_Argument_Type::I64;
+        }
+        else {
+            return sizeof(T) == 1 ? Log_Argument_Type::U8 : sizeof(T) == 2 ? Log_Argument_Type::U16 :
+                sizeof(T) == 4 ? Log_Argument_Type::U32 : Log_Argument_Type::U64;
+        }
+    }
+
+    /**
+     * Get the number of bytes an argument takes once packed
+     */
+    template<Deferred_Log_Argument T>
+    ds_u64 Get_Packed_Log_Argument_Size(const T& value)
+    {
+        if constexpr (Log_String_Argument<T>) {
+            return 1 + sizeof(ds_u32) + std::string_view(value).size();
+        }
+        else {
+            return 1 + sizeof(T);
+        }
+    }
+
+    /**
+     * Pack an argument at out
+     * @return Pointer past the packed argument
+     */
+    template<Deferred_Log_Argument T>
+    ds_u8* Pack_Log_Argument(ds_u8* out, const T& value)
+    {
+        *out++ = static_cast<ds_u8>(Get_Log_Argument_Type<T>());
+
+        if constexpr (Log_String_Argument<T>) {
+            std::string_view text(value);
+            ds_u32 length = static_cast<ds_u32>(text.size());
+            std::memcpy(out, &length, sizeof(length));
+            std::memcpy(out + sizeof(length), text.data(), length);
+            return out + sizeof(length) + length;
+        }
+        else {
+            std::memcpy(out, &value, sizeof(T));
+            return out + sizeof(T);
+        }
+    }
+
+    /**
+     * Read back an argument packed for type T and advance in past it
+     * @return The value, or a view of the packed characters for strings
+     */
+    template<Deferred_Log_Argument T>
+    auto Unpack_Log_Argument(const ds_u8*& in)
+    {
+        // Skip the type tag, the caller knows the type
+        in++;
+
+        if constexpr (Log_String_Argument<T>) {
+            ds_u32 length = 0;
+            std::memcpy(&length, in, sizeof(length));
+            std::string_view text(reinterpret_cast<const char*>(in + sizeof(length)), length);
+            in += sizeof(length) + length;
+            return text;
+        }
+        else {
+            std::array<ds_u8, sizeof(T)> bytes;
+            std::memcpy(bytes.data(), in, sizeof(T));
+            in += sizeof(T);
+            return std::bit_cast<T>(bytes);
+        }
+    }
+
+    /**
+     * Format arguments packed for the types Ts with format, appending to out
+     * Instantiated at each deferred call site and run later by the logger thread
+     */
+    template<Deferred_Log_Argument... Ts>
+    void Format_Packed_Log_Arguments(std::string& out, std::string_view format, const ds_u8* arguments)
+    {
+        // Braced initialization unpacks the arguments in order
+        std::tuple<decltype(Unpack_Log_Argument<Ts>(arguments))...> values{ Unpack_Log_Argument<Ts>(arguments)... };
+
+        std::apply([&](const auto&... unpacked) {
+            std::vformat_to(std::back_inserter(out), format, std::make_format_args(unpacked...));
+        }, values);
+    }
+
+    /**
+     * A packed argument read back by its type tag. Integers are widened, which formats the same.
+     */
+    using Log_Argument_Value = std::variant<bool, char, ds_i64, ds_u64, ds_f32, ds_f64, const void*, std::string_view>;
+
+    /**
+     * Read back one packed argument by its type tag and advance in past it
+     * @param end End of the packed arguments
+     * @return False if the tag is unknown or the argument runs past end
+     */
+    bool Unpack_Tagged_Log_Argument(const ds_u8*& in, const ds_u8* end, Log_Argument_Value& value);
+
+    /**
+     * Format packed arguments without knowing the call site's types, for readers of logs
+     * written by another process. Replacement fields with nested fields, e.g. {:{}}, are not supported.
+     * @param out Formatted text is appended here
+     * @return False if the arguments are malformed or don't fit the format
+     */
+    bool Format_Tagged_Log_Arguments(std::string& out, std::string_view format, const ds_u8* arguments, ds_u64 size);
+}
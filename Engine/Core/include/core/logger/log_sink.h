@@ -0,0 +1,137 @@
+#pragma once
+#include <core/defines.h>
+#include <core/logger/logger.h>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace ds::core
+{
+    /**
+     * A message as handed to the sinks
+     */
+    struct Log_Message
+    {
+        Log_Time time;
+        Log_Level level = Log_Level::INFO;
+        Log_Channel channel = Log_Channel::GENERAL;
+        std::string_view time_text;             ///< Formatted time, e.g. [2025-01-31 12:00:00]
+        std::string_view text;                  ///< Message text, without theme colors. Empty for deferred
+                                                ///< messages when no active sink needs text
+        std::string_view format;                ///< Format string of a deferred message, empty otherwise
+        const ds_u8* arguments = nullptr;       ///< Packed arguments of a deferred message, see log_arguments.h
+        ds_u64 arguments_size = 0;
+    };
+
+    /**
+     * Log_Sink - Destination for log messages
+     *
+     * The logger calls Write for every message and Flush once per batch, always from one
+     * thread at a time, so sinks need no locking of their own. Sinks may buffer freely
+     * between flushes.
+     */
+    class Log_Sink
+    {
+    public:
+        virtual ~Log_Sink() = default;
+
+        /**
+         * Write one message, possibly only into a buffer
+         */
+        virtual void Write(const Log_Message& message) = 0;
+
+        /**
+         * Push buffered messages to their destination
+         */
+        virtual void Flush() = 0;
+
+        /**
+         * Whether the sink reads Log_Message::text of deferred messages. Deferred messages
+         * are only formatted when an active sink needs the text.
+         */
+        virtual bool Needs_Text() const { return true; }
+
+        /**
+         * Append "time [LEVEL] [channel] " to out, the channel only for non-general channels
+         */
+        static void Append_Prefix(std::string& out, const Log_Message& message);
+
+        /**
+         * Append text to out without ANSI escape sequences, for destinations that are not terminals
+         */
+        static void Append_Without_Ansi(std::string& out, std::string_view text);
+    };
+
+    /**
+     * Console_Log_Sink - Writes to standard output, colored with the current logger theme
+     */
+    class Console_Log_Sink : public Log_Sink
+    {
+    public:
+        void Write(const Log_Message& message) override;
+        void Flush() override;
+
+    private:
+        std::string m_buffer;
+    };
+
+    /**
+     * File_Log_Sink - Buffered plain text log file with size and age based rotation
+     *
+     * Messages collect in a memory buffer that is written when it fills or on Flush. When the
+     * file outgrows max_file_size or gets older than max_file_age_seconds it is renamed to
+     * <name>.1<ext>, earlier rotations move up by one and a new file is started. A file's age
+     * counts from when this sink opened it, so a file left by an earlier run and appended to
+     * is kept for another max_file_age_seconds. If the file can't be opened the sink reports it
+     * once and drops messages from then on.
+     */
+    class File_Log_Sink : public Log_Sink
+    {
+    public:
+        /**
+         * Configuration structure for file sinks
+         */
+        struct Config
+        {
+            std::string path = "ds.log";                // Path of the active log file
+            ds_u64 max_file_size = 0;                   // Rotate before the file grows past this many bytes, 0 for no limit
+            ds_u64 max_file_age_seconds = 0;            // Rotate files opened longer ago than this, 0 for no limit
+            ds_u32 max_rotated_files = 5;               // Rotated files kept, the oldest is deleted
+            ds_u64 buffer_size = 64 * 1024;             // Bytes buffered before they are written to the file
+        };
+
+        File_Log_Sink();
+        explicit File_Log_Sink(const Config& config);
+        ~File_Log_Sink() override;
+
+        File_Log_Sink(const File_Log_Sink&) = delete;
+        File_Log_Sink& operator=(const File_Log_Sink&) = delete;
+
+        void Write(const Log_Message& message) override;
+        void Flush() override;
+
+        /**
+         * Get the path of a rotated file, 1 being the most recent
+         */
+        std::string Get_Rotated_Path(ds_u32 index) const;
+
+        const Config& Get_Config() const { return m_config; }
+
+        /**
+         * Get the size of the active file, including buffered bytes
+         */
+        ds_u64 Get_File_Size() const { return m_file_size; }
+
+    private:
+        void Open(ds_i64 timestamp);
+        void Rotate(ds_i64 timestamp);
+
+        Config m_config;
+        std::ofstream m_file;
+        std::string m_buffer;
+        std::string m_line;                 ///< Reused to build each line
+        ds_u64 m_file_size = 0;
+        ds_i64 m_opened_at = 0;             ///< Timestamp the active file was opened at
+        bool m_failed = false;              ///< Opening failed, stop trying
+    };
+}
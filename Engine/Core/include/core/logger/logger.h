@@ -1,22 +1,31 @@
 #pragma once
 #include <core/defines.h>
-#include <queue>
+#include <atomic>
+#include <memory>
+#include <vector>
 #include <string>
 #include <string_view>
 #include <mutex>
 #include <condition_variable>
 #include <thread>
+#include <chrono>
 #include <format>
 #include <algorithm>
 #include <utility>
-#include <regex>
+#include <fstream>
 #include <core/logger/console_format.h>
+#include <core/logger/log_arguments.h>
 
 namespace ds::core
 {
     // Forward declarations
     enum class Logger_Theme;
     struct Theme_Struct;
+    struct Log_Thread_Buffer;
+    struct Log_Crash_File;
+    class Log_Sink;
+    class Console_Log_Sink;
+    class File_Log_Sink;
 
     /**
      * Log severity levels
@@ -31,9 +40,71 @@ namespace ds::core
         NONE    // No logging
     };
 
+    // Number of levels that can be logged, every level before Log_Level::NONE
+    inline constexpr ds_u64 LOG_LEVEL_COUNT = 5;
+
+    /**
+     * What a logging thread does when its ring has no room for a message
+     */
+    enum class Log_Overflow_Policy
+    {
+        BLOCK,          // Wait for the logger thread to make room, nothing is lost
+        DROP_NEWEST,    // Drop the message that doesn't fit
+        DROP_BY_LEVEL,  // Drop messages below the overflow level, wait for room for the rest
+        SAMPLE          // Keep one in every sample rate messages, waiting for room, drop the others
+    };
+
+    /**
+     * When a message was logged, both clocks are read on the logging thread
+     */
+    struct Log_Time
+    {
+        ds_i64 timestamp = 0;                   ///< Wall clock, nanoseconds since the epoch
+        ds_u64 monotonic_microseconds = 0;      ///< Platform_Time::Get_Time_Microseconds
+    };
+
+    /**
+     * Log channels, each with its own runtime minimum level
+     */
+    enum class Log_Channel : ds_u8
+    {
+        GENERAL,    // Messages logged without a channel
+        MEMORY,     // Allocators and memory tracking
+        STREAMING,  // Streaming allocator and resource I/O
+        ALGORITHMS, // Worker pool and parallel algorithms
+        PHYSICS,    // Physics simulation
+        RENDERER,   // Rendering
+        AUDIO,      // Audio
+        GAMEPLAY,   // Game code
+        PROFILER,   // Profiler and trace export
+        COUNT
+    };
+
     /**
      * The Logger class provides logging capabilities with support for
      * different log levels, formatting, and console styling.
+     *
+     * In asynchronous mode every logging thread writes fixed-size records into its own
+     * lock-free ring, so logging takes no lock and allocates nothing after a thread's first
+     * message. The background thread drains all rings in batches and writes them in
+     * timestamp order. Producers only wake it when it isn't already awake.
+     *
+     * With deferred formatting, Log_Format calls whose arguments are all numbers, enums,
+     * pointers or strings copy the format string pointer and the packed argument values
+     * into the record, and the logger thread does the formatting, only if a sink needs the
+     * text. Binary_Log_Sink stores the format and arguments as they are.
+     *
+     * Each thread ring holds a bounded number of records. When a ring is full the overflow
+     * policy decides between waiting and dropping, dropped messages are counted per level and
+     * reported in a warning at most once per drop report interval.
+     *
+     * With a crash log the thread rings live in a shared file mapping. Records stay in their
+     * slots after the logger thread has read them, so when the process dies the file still
+     * holds the last records of every thread. Crash_Log_Reader reads them back.
+     *
+     * Messages go to Log_Sinks: the console, the ds.log file in file output mode, and any
+     * sinks added with Add_Sink. Sinks buffer, and are flushed once per batch, on Flush()
+     * and after every message in synchronous mode.
      */
     class Logger
     {
@@ -78,17 +149,169 @@ namespace ds::core
             m_file_output_mode = file_output_mode;
         }
 
+        /**
+        * Set the monotonic time mode of the logger. If this mode is enabled,
+        * timestamps also show Platform_Time in seconds with microsecond precision.
+        */
+        void Set_Monotonic_Time_Mode(bool monotonic_time_mode)
+        {
+            m_monotonic_time_mode = monotonic_time_mode;
+        }
+
+        /**
+        * Set the console output mode of the logger, enabled by default.
+        * Servers that only log to files can turn the console off.
+        */
+        void Set_Console_Output_Mode(bool console_output_mode)
+        {
+            m_console_output_mode = console_output_mode;
+        }
+
+        /**
+        * Set what logging threads do when their ring is full, Log_Overflow_Policy::BLOCK by default
+        */
+        void Set_Overflow_Policy(Log_Overflow_Policy policy)
+        {
+            m_overflow_policy = policy;
+        }
+
+        /**
+        * Set the lowest level Log_Overflow_Policy::DROP_BY_LEVEL keeps, WARN by default
+        */
+        void Set_Overflow_Level(Log_Level level)
+        {
+            m_overflow_level = level;
+        }
+
+        /**
+        * Set how many overflowing messages Log_Overflow_Policy::SAMPLE counts per kept message
+        */
+        void Set_Overflow_Sample_Rate(ds_u32 sample_rate)
+        {
+            m_overflow_sample_rate = std::max<ds_u32>(sample_rate, 1);
+        }
+
+        /**
+        * Set the shortest time between two dropped message reports, one second by default
+        */
+        void Set_Drop_Report_Interval(std::chrono::milliseconds interval)
+        {
+            m_drop_report_interval = interval.count();
+        }
+
+        /**
+         * Get the number of messages dropped since the logger was created, as collected
+         * by the logger thread so far
+         */
+        ds_u64 Get_Dropped_Message_Count() const
+        {
+            return m_dropped_message_count.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Keep the thread rings in a file mapping, so the last records of every thread
+         * survive a crash. Only threads that log for the first time afterwards get a ring in
+         * the file, so call this before Start. Threads beyond the rings the file holds get
+         * ordinary rings. Deferred records carry a copy of their format string from now on.
+         * @param path File to map, created or overwritten
+         * @param size Bytes of records to keep, in whole thread rings of 128 KB
+         * @return False if the file could not be mapped or a crash log is already enabled
+         */
+        bool Enable_Crash_Log(const std::string& path, ds_u64 size);
+
+        /**
+         * Add a sink that receives every message from now on
+         * @param sink The sink, owned by the logger until removed
+         * @return The sink, for Remove_Sink
+         */
+        Log_Sink* Add_Sink(std::unique_ptr<Log_Sink> sink);
+
+        /**
+         * Flush and destroy a sink added with Add_Sink
+         */
+        void Remove_Sink(Log_Sink* sink);
+
+        /**
+         * Write every message logged so far and flush all sinks
+         * Blocks until the logger thread has done so in asynchronous mode
+         */
+        void Flush();
+
+        /**
+        * Set the deferred formatting mode of the logger. When enabled (the default),
+        * formatting of supported arguments moves from the calling thread to the
+        * logger thread.
+        */
+        void Set_Deferred_Formatting(bool deferred_formatting)
+        {
+            m_deferred_formatting = deferred_formatting;
+        }
+
+        /**
+         * Check whether a message would be logged, cheap enough to run before
+         * the message arguments are evaluated
+         * @param channel The channel of the message
+         * @param level The severity level of the message
+         */
+        static bool Is_Enabled(Log_Channel channel, Log_Level level)
+        {
+            return static_cast<ds_u8>(level) >= s_channel_levels[static_cast<ds_u8>(channel)].load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Set the minimum level a channel logs, Log_Level::NONE silences it
+         */
+        static void Set_Channel_Level(Log_Channel channel, Log_Level level)
+        {
+            s_channel_levels[static_cast<ds_u8>(channel)].store(static_cast<ds_u8>(level), std::memory_order_relaxed);
+        }
+
+        static Log_Level Get_Channel_Level(Log_Channel channel)
+        {
+            return static_cast<Log_Level>(s_channel_levels[static_cast<ds_u8>(channel)].load(std::memory_order_relaxed));
+        }
+
+        /**
+         * Set the minimum level of every channel
+         */
+        static void Set_Level(Log_Level level);
+
+        /**
+         * Get the name of a channel as printed in log lines
+         */
+        static const char* Get_Channel_Name(Log_Channel channel);
+
+        /**
+         * Find a channel by name, for configuring levels from settings
+         * @return The channel, or Log_Channel::COUNT if no channel has that name
+         */
+        static Log_Channel Find_Channel(std::string_view name);
+
         /**
          * Log a message with the specified log level
          * @param level The severity level
          * @param message The message to log
          */
-        void Log(Log_Level level, const std::string& message);
+        void Log(Log_Level level, const std::string& message)
+        {
+            Log(Log_Channel::GENERAL, level, message);
+        }
+
+        /**
+         * Log a message on a channel
+         * @param channel The channel of the message
+         * @param level The severity level
+         * @param message The message to log
+         */
+        void Log(Log_Channel channel, Log_Level level, const std::string& message);
 
         /**
          * Log a formatted message with the specified log level
          * Uses C++20 std::format for compile-time format checking
          *
+         * When every argument is a Deferred_Log_Argument the call only packs the values,
+         * without formatting or allocating, and the logger thread formats them later
+         *
          * @param level The severity level
          * @param fmt The format string
          * @param args Format arguments
@@ -96,8 +319,57 @@ namespace ds::core
         template<typename... Args>
         void Log_Format(Log_Level level, std::format_string<Args...> fmt, Args&&... args)
         {
+            Log_Format(Log_Channel::GENERAL, level, fmt, std::forward<Args>(args)...);
+        }
+
+        /**
+         * Log a formatted message on a channel
+         * @param channel The channel of the message
+         * @param level The severity level
+         * @param fmt The format string
+         * @param args Format arguments
+         */
+        template<typename... Args>
+        void Log_Format(Log_Channel channel, Log_Level level, std::format_string<Args...> fmt, Args&&... args)
+        {
+            if (!Is_Enabled(channel, level))
+            {
+                return;
+            }
+
+            if constexpr ((Deferred_Log_Argument<std::decay_t<Args>> && ...))
+            {
+                ds_u64 size = sizeof(Deferred_Header) + (Get_Packed_Log_Argument_Size<std::decay_t<Args>>(args) + ... + 0);
+                // Crash logs are read by another process, where the format string address means nothing
+                std::string_view format = fmt.get();
+                bool embed_format = m_crash_log_enabled.load(std::memory_order_relaxed);
+                if (embed_format)
+                {
+                    size += format.size();
+                }
+
+                if (size <= LOG_DEFERRED_MAX_SIZE && m_deferred_formatting.load(std::memory_order_relaxed))
+                {
+                    Deferred_Header header{ &Format_Packed_Log_Arguments<std::decay_t<Args>...>, format.data(), format.size() };
+
+                    ds_u8 payload[LOG_DEFERRED_MAX_SIZE];
+                    std::memcpy(payload, &header, sizeof(header));
+
+                    ds_u8* out = payload + sizeof(header);
+                    if (embed_format)
+                    {
+                        std::memcpy(out, format.data(), format.size());
+                        out += format.size();
+                    }
+                    ((out = Pack_Log_Argument<std::decay_t<Args>>(out, args)), ...);
+
+                    Log_Deferred(channel, level, payload, size, embed_format);
+                    return;
+                }
+            }
+
             std::string formatted_message = std::format(fmt, std::forward<Args>(args)...);
-            Log(level, formatted_message);
+            Log(channel, level, formatted_message);
         }
 
         /**
@@ -138,6 +410,17 @@ namespace ds::core
          */
         static Logger_Theme Get_Current_Theme();
 
+        /**
+         * Get the colors of the current theme, sinks read it while the logger
+         * holds its output lock
+         */
+        static const Theme_Struct& Get_Current_Theme_Struct();
+
+        /**
+         * Get the tag printed for a level, e.g. [INFO]
+         */
+        static const char* Get_Level_Name(Log_Level level);
+
         // Static helper methods with format string checking
         template<typename... Args>
         static void Trace(std::format_string<Args...> fmt, Args&&... args)
@@ -196,34 +479,218 @@ namespace ds::core
         }
 
     private:
+        friend class Crash_Log_Reader;
+
+        // A message drained from a thread ring, waiting to be written
+        struct Log_Entry
+        {
+            Log_Time time;
+            Log_Level level = Log_Level::INFO;
+            Log_Channel channel = Log_Channel::GENERAL;
+            ds_u8 flags = 0;
+            std::string payload;                ///< Message text or deferred payload
+        };
+
+        // Formats packed arguments, one instantiation per deferred call site signature
+        using Deferred_Format_Function = void (*)(std::string& out, std::string_view format, const ds_u8* arguments);
+
+        // Start of a deferred record payload, the packed arguments follow it, after a copy
+        // of the format string while a crash log is enabled
+        struct Deferred_Header
+        {
+            Deferred_Format_Function format_function;
+            const char* format;                 ///< Compile-time format string, lives for the whole program
+            ds_u64 format_length;
+        };
+
+        // Largest deferred payload, bigger argument lists are formatted on the calling thread
+        static constexpr ds_u64 LOG_DEFERRED_MAX_SIZE = 1024;
+
         Logger();
         ~Logger();
 
         void Process_Logs();
 
-        std::queue<std::pair<Log_Level, std::string>> m_log_queue;
+        /**
+         * Log a deferred payload: a Deferred_Header followed by the packed arguments
+         * @param format_embedded Whether the format string is copied between the header and the arguments
+         */
+        void Log_Deferred(Log_Channel channel, Log_Level level, const ds_u8* payload, ds_u64 size, bool format_embedded);
+
+        /**
+         * Copy a message or deferred payload into the calling thread's ring
+         */
+        void Push_Records(Log_Channel channel, Log_Level level, const Log_Time& time, ds_u8 flags, const char* data, ds_u64 size);
+
+        /**
+         * Get the calling thread's ring, registering a new one on the thread's first message
+         */
+        Log_Thread_Buffer& Get_Thread_Buffer();
+
+        /**
+         * Move every complete message out of the thread rings into m_pending_entries
+         * and free the rings of threads that have exited
+         * @return True if any record was drained
+         */
+        bool Drain_Thread_Buffers();
+
+        /**
+         * Wake the background thread unless a wakeup is already pending
+         */
+        void Request_Wake();
+
+        /**
+         * Decide by the overflow policy whether a message that found its ring full is kept
+         */
+        bool Keep_Overflowing_Message(Log_Thread_Buffer& buffer, Log_Level level);
+
+        /**
+         * Write a warning with the messages dropped since the last report, m_output_mutex must be held
+         * @return True if any message was dropped
+         */
+        bool Report_Dropped_Messages();
+
+        /**
+         * Hand one message to every active sink, m_output_mutex must be held. Deferred
+         * payloads are formatted only if a sink needs the text.
+         */
+        void Write_Message(Log_Channel channel, Log_Level level, const Log_Time& time, ds_u8 flags, std::string_view payload);
+
+        /**
+         * Write and flush one message from the calling thread
+         */
+        void Write_Synchronous(Log_Channel channel, Log_Level level, const Log_Time& time, ds_u8 flags, std::string_view payload);
+
+        /**
+         * Format a time as [YYYY-MM-DD HH:MM:SS], the date part is only rebuilt when
+         * the second changes. m_output_mutex must be held.
+         */
+        std::string_view Format_Time(const Log_Time& time);
+
+        /**
+         * Flush every sink, m_output_mutex must be held
+         */
+        void Flush_Sinks();
+
+        std::vector<Log_Thread_Buffer*> m_thread_buffers;   ///< Guarded by m_mutex
+        std::unique_ptr<Log_Crash_File> m_crash_file;       ///< Guarded by m_mutex
+        std::mutex m_crash_log_mutex;                       ///< Serializes Enable_Crash_Log
+        std::vector<Log_Entry> m_pending_entries;           ///< Only touched by the draining thread
+        ds_u64 m_unreported_drops[LOG_LEVEL_COUNT] = {};    ///< Only touched by the draining thread
+        std::chrono::steady_clock::time_point m_last_drop_report = std::chrono::steady_clock::now();
         std::mutex m_mutex;
         std::condition_variable m_condition_variable;
+        std::condition_variable m_flush_condition;
+        ds_u64 m_flush_requests = 0;                        ///< Guarded by m_mutex
+        ds_u64 m_flushes_done = 0;                          ///< Guarded by m_mutex
         std::thread m_log_thread;
-        bool m_synchronous_mode = false;
-        bool m_file_output_mode = false;
-        bool m_running;
+
+        std::mutex m_output_mutex;                          ///< Guards the sinks and the theme
+        std::unique_ptr<Console_Log_Sink> m_console_sink;
+        std::unique_ptr<File_Log_Sink> m_file_sink;         ///< ds.log, created lazily in file output mode
+        std::vector<std::unique_ptr<Log_Sink>> m_sinks;
+        ds_i64 m_cached_second = 0;                         ///< Second m_time_text was built for
+        ds_u64 m_cached_second_length = 0;                  ///< Length of the date part in m_time_text
+        std::string m_time_text;
+        std::string m_message_text;                         ///< Reused to format deferred messages
+
+        std::atomic<bool> m_wake_requested{ false };
+        std::atomic<bool> m_synchronous_mode{ false };
+        std::atomic<bool> m_deferred_formatting{ true };
+        std::atomic<bool> m_file_output_mode{ false };
+        std::atomic<bool> m_console_output_mode{ true };
+        std::atomic<bool> m_monotonic_time_mode{ false };
+        std::atomic<bool> m_crash_log_enabled{ false };
+        std::atomic<bool> m_running{ false };
+
+        std::atomic<Log_Overflow_Policy> m_overflow_policy{ Log_Overflow_Policy::BLOCK };
+        std::atomic<Log_Level> m_overflow_level{ Log_Level::WARN };
+        std::atomic<ds_u32> m_overflow_sample_rate{ 10 };
+        std::atomic<ds_i64> m_drop_report_interval{ 1000 };     ///< Milliseconds
+        std::atomic<ds_u64> m_dropped_message_count{ 0 };
+
+        // Minimum level per channel, every channel starts at TRACE
+        inline static std::atomic<ds_u8> s_channel_levels[static_cast<ds_u8>(Log_Channel::COUNT)]{};
     };
 }
 
+// Compile-time log levels, matching Log_Level
+#define DS_LOG_LEVEL_TRACE 0
+#define DS_LOG_LEVEL_INFO 1
+#define DS_LOG_LEVEL_WARN 2
+#define DS_LOG_LEVEL_ERR 3
+#define DS_LOG_LEVEL_FATAL 4
+#define DS_LOG_LEVEL_NONE 5
+
+// Log calls below DS_LOG_MIN_LEVEL are removed at compile time, shipping builds drop TRACE by default
+#ifndef DS_LOG_MIN_LEVEL
+    #ifdef DS_SHIPPING
+        #define DS_LOG_MIN_LEVEL DS_LOG_LEVEL_INFO
+    #else
+        #define DS_LOG_MIN_LEVEL DS_LOG_LEVEL_TRACE
+    #endif
+#endif
+
+// The channel level is checked before the arguments are evaluated
+#define DS_LOG_CHANNEL_MESSAGE(channel, level, ...) \
+    (ds::core::Logger::Is_Enabled(ds::core::Log_Channel::channel, ds::core::Log_Level::level) \
+        ? ds::core::Logger::Get_Instance().Log_Format(ds::core::Log_Channel::channel, ds::core::Log_Level::level, __VA_ARGS__) \
+        : void())
+
+#define DS_LOG_CHANNEL_TEXT(channel, level, message) \
+    (ds::core::Logger::Is_Enabled(ds::core::Log_Channel::channel, ds::core::Log_Level::level) \
+        ? ds::core::Logger::Get_Instance().Log(ds::core::Log_Channel::channel, ds::core::Log_Level::level, message) \
+        : void())
+
+#define DS_LOG_DISABLED() ((void)0)
+
+// Macros for logging with format strings on a channel, e.g. DS_LOG_CHANNEL_TRACE(MEMORY, "{0}", name)
+#if DS_LOG_MIN_LEVEL <= DS_LOG_LEVEL_TRACE
+    #define DS_LOG_CHANNEL_TRACE(channel, ...) DS_LOG_CHANNEL_MESSAGE(channel, TRACE, __VA_ARGS__)
+    #define DS_LOG_TRACE_TEXT(message) DS_LOG_CHANNEL_TEXT(GENERAL, TRACE, message)
+#else
+    #define DS_LOG_CHANNEL_TRACE(channel, ...) DS_LOG_DISABLED()
+    #define DS_LOG_TRACE_TEXT(message) DS_LOG_DISABLED()
+#endif
+
+#if DS_LOG_MIN_LEVEL <= DS_LOG_LEVEL_INFO
+    #define DS_LOG_CHANNEL_INFO(channel, ...) DS_LOG_CHANNEL_MESSAGE(channel, INFO, __VA_ARGS__)
+    #define DS_LOG_INFO_TEXT(message) DS_LOG_CHANNEL_TEXT(GENERAL, INFO, message)
+#else
+    #define DS_LOG_CHANNEL_INFO(channel, ...) DS_LOG_DISABLED()
+    #define DS_LOG_INFO_TEXT(message) DS_LOG_DISABLED()
+#endif
+
+#if DS_LOG_MIN_LEVEL <= DS_LOG_LEVEL_WARN
+    #define DS_LOG_CHANNEL_WARN(channel, ...) DS_LOG_CHANNEL_MESSAGE(channel, WARN, __VA_ARGS__)
+    #define DS_LOG_WARN_TEXT(message) DS_LOG_CHANNEL_TEXT(GENERAL, WARN, message)
+#else
+    #define DS_LOG_CHANNEL_WARN(channel, ...) DS_LOG_DISABLED()
+    #define DS_LOG_WARN_TEXT(message) DS_LOG_DISABLED()
+#endif
+
+#if DS_LOG_MIN_LEVEL <= DS_LOG_LEVEL_ERR
+    #define DS_LOG_CHANNEL_ERROR(channel, ...) DS_LOG_CHANNEL_MESSAGE(channel, ERR, __VA_ARGS__)
+    #define DS_LOG_ERROR_TEXT(message) DS_LOG_CHANNEL_TEXT(GENERAL, ERR, message)
+#else
+    #define DS_LOG_CHANNEL_ERROR(channel, ...) DS_LOG_DISABLED()
+    #define DS_LOG_ERROR_TEXT(message) DS_LOG_DISABLED()
+#endif
+
+#if DS_LOG_MIN_LEVEL <= DS_LOG_LEVEL_FATAL
+    #define DS_LOG_CHANNEL_FATAL(channel, ...) DS_LOG_CHANNEL_MESSAGE(channel, FATAL, __VA_ARGS__)
+    #define DS_LOG_FATAL_TEXT(message) DS_LOG_CHANNEL_TEXT(GENERAL, FATAL, message)
+#else
+    #define DS_LOG_CHANNEL_FATAL(channel, ...) DS_LOG_DISABLED()
+    #define DS_LOG_FATAL_TEXT(message) DS_LOG_DISABLED()
+#endif
+
 // Macros for logging with format strings
-#define DS_LOG_TRACE(...) ds::core::Logger::Trace(__VA_ARGS__)
-#define DS_LOG_INFO(...) ds::core::Logger::Info(__VA_ARGS__)
-#define DS_LOG_WARN(...) ds::core::Logger::Warn(__VA_ARGS__)
-#define DS_LOG_ERROR(...) ds::core::Logger::Error(__VA_ARGS__)
-#define DS_LOG_FATAL(...) ds::core::Logger::Fatal(__VA_ARGS__)
-
-// Macros for logging plain text (e.g., string streams)
-#define DS_LOG_TRACE_TEXT(message) ds::core::Logger::Trace_Text(message)
-#define DS_LOG_INFO_TEXT(message) ds::core::Logger::Info_Text(message)
-#define DS_LOG_WARN_TEXT(message) ds::core::Logger::Warn_Text(message)
-#define DS_LOG_ERROR_TEXT(message) ds::core::Logger::Error_Text(message)
-#define DS_LOG_FATAL_TEXT(message) ds::core::Logger::Fatal_Text(message)
+#define DS_LOG_TRACE(...) DS_LOG_CHANNEL_TRACE(GENERAL, __VA_ARGS__)
+#define DS_LOG_INFO(...) DS_LOG_CHANNEL_INFO(GENERAL, __VA_ARGS__)
+#define DS_LOG_WARN(...) DS_LOG_CHANNEL_WARN(GENERAL, __VA_ARGS__)
+#define DS_LOG_ERROR(...) DS_LOG_CHANNEL_ERROR(GENERAL, __VA_ARGS__)
+#define DS_LOG_FATAL(...) DS_LOG_CHANNEL_FATAL(GENERAL, __VA_ARGS__)
 
 // Macros for assertions, tied to logging that's why they are defined here
 #ifdef DS_ENABLE_ASSERTS
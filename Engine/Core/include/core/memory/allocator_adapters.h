@@ -1,21 +1,38 @@
 #pragma once
 #include <core/memory/allocator_interface.h>
+#include <core/memory/arena_allocator.h>
+#include <core/memory/pool_allocator.h>
+#include <core/memory/stack_allocator.h>
+#include <core/memory/free_list_allocator.h>
+#include <core/memory/page_allocator.h>
+#include <core/memory/streaming_allocator.h>
 
 namespace ds::core::memory
 {
+    // Adapters model Ds_Allocator without virtual calls and point at the allocator they wrap,
+    // so containers can copy, assign and inline them. Wrap one in Allocator_Model when it has
+    // to be chosen at runtime. Each adapter converts from the same adapter for another element
+    // type, which is how containers rebind it for their internal bookkeeping arrays.
+
     // Default Allocator Adapter - Uses the core Memory system
+    // Stateless, so it takes no space inside containers
     template<typename T>
-    class Default_Allocator : public Allocator_Interface<T>
+    class Default_Allocator
     {
     public:
+        using value_type = T;
+
         Default_Allocator() = default;
 
-        T* allocate(ds_u64 n) override
+        template<typename U>
+        Default_Allocator(const Default_Allocator<U>&) {}
+
+        T* allocate(ds_u64 n)
         {
             return static_cast<T*>(Memory::Malloc(sizeof(T) * n, alignof(T)));
         }
 
-        void deallocate(T* p, ds_u64 n) override
+        void deallocate(T* p, ds_u64)
         {
             Memory::Free(p);
         }
@@ -23,35 +40,53 @@ namespace ds::core::memory
 
     // Arena Allocator Adapter
     template<typename T>
-    class Arena_Allocator_Adapter : public Allocator_Interface<T>
+    class Arena_Allocator_Adapter
     {
+    public:
+        using value_type = T;
+
     private:
-        Arena_Allocator& m_allocator;
+        Arena_Allocator* m_allocator;
+
+        template<typename> friend class Arena_Allocator_Adapter;
 
     public:
-        Arena_Allocator_Adapter(Arena_Allocator& allocator) : m_allocator(allocator) {}
+        Arena_Allocator_Adapter(Arena_Allocator& allocator) : m_allocator(&allocator) {}
 
-        T* allocate(ds_u64 n) override
+        template<typename U>
+        Arena_Allocator_Adapter(const Arena_Allocator_Adapter<U>& other) : m_allocator(other.m_allocator) {}
+
+        T* allocate(ds_u64 n)
         {
-            return static_cast<T*>(m_allocator.Allocate(sizeof(T) * n, alignof(T)));
+            return static_cast<T*>(m_allocator->Allocate(sizeof(T) * n, alignof(T)));
         }
 
-        void deallocate(T* p, ds_u64 n) override
+        void deallocate(T*, ds_u64)
         {
             // Arena allocator doesn't support individual deallocations
             // No operation needed
         }
+
+        ds_bool try_expand(T* p, ds_u64 old_n, ds_u64 new_n)
+        {
+            return m_allocator->Try_Expand(p, sizeof(T) * old_n, sizeof(T) * new_n);
+        }
     };
 
     // Pool Allocator Adapter
     template<typename T>
-    class Pool_Allocator_Adapter : public Allocator_Interface<T>
+    class Pool_Allocator_Adapter
     {
+    public:
+        using value_type = T;
+
     private:
-        Pool_Allocator& m_allocator;
+        Pool_Allocator* m_allocator;
+
+        template<typename> friend class Pool_Allocator_Adapter;
 
     public:
-        Pool_Allocator_Adapter(Pool_Allocator& allocator) : m_allocator(allocator)
+        Pool_Allocator_Adapter(Pool_Allocator& allocator) : m_allocator(&allocator)
         {
             // Verify that pool block size is sufficient for type T
             DS_ASSERT(allocator.Get_Block_Size() >= sizeof(T),
@@ -60,25 +95,34 @@ namespace ds::core::memory
                 "Pool block alignment insufficient for type T");
         }
 
-        T* allocate(ds_u64 n) override
+        template<typename U>
+        Pool_Allocator_Adapter(const Pool_Allocator_Adapter<U>& other) : Pool_Allocator_Adapter(*other.m_allocator) {}
+
+        T* allocate(ds_u64 n)
         {
             // Pool allocator only supports single object allocation
             DS_ASSERT(n == 1, "Pool allocator only supports single object allocation");
-            return static_cast<T*>(m_allocator.Allocate());
+            return static_cast<T*>(m_allocator->Allocate());
         }
 
-        void deallocate(T* p, ds_u64 n) override
+        void deallocate(T* p, ds_u64)
         {
-            m_allocator.Deallocate(p);
+            m_allocator->Deallocate(p);
         }
     };
 
     // Stack Allocator Adapter
     template<typename T>
-    class Stack_Allocator_Adapter : public Allocator_Interface<T>
+    class Stack_Allocator_Adapter
     {
+    public:
+        using value_type = T;
+
     private:
-        Stack_Allocator& m_allocator;
+        Stack_Allocator* m_allocator;
+
+        template<typename> friend class Stack_Allocator_Adapter;
+
         struct Allocation_Info
         {
             T* ptr;
@@ -87,11 +131,14 @@ namespace ds::core::memory
         std::vector<Allocation_Info> m_allocations; // Tracks allocations for LIFO enforcement
 
     public:
-        Stack_Allocator_Adapter(Stack_Allocator& allocator) : m_allocator(allocator) {}
+        Stack_Allocator_Adapter(Stack_Allocator& allocator) : m_allocator(&allocator) {}
 
-        T* allocate(ds_u64 n) override
+        template<typename U>
+        Stack_Allocator_Adapter(const Stack_Allocator_Adapter<U>& other) : m_allocator(other.m_allocator) {}
+
+        T* allocate(ds_u64 n)
         {
-            T* result = static_cast<T*>(m_allocator.Allocate(sizeof(T) * n, alignof(T)));
+            T* result = static_cast<T*>(m_allocator->Allocate(sizeof(T) * n, alignof(T)));
 
             // Track this allocation
             m_allocations.push_back({ result, n });
@@ -99,74 +146,97 @@ namespace ds::core::memory
             return result;
         }
 
-        void deallocate(T* p, ds_u64 n) override
+        void deallocate(T* p, ds_u64)
         {
             // Ensure LIFO ordering is maintained
             if (m_allocations.empty() || m_allocations.back().ptr != p)
             {
-                DS_LOG_ERROR("Stack allocator deallocations must follow LIFO ordering");
+                DS_LOG_CHANNEL_ERROR(MEMORY, "Stack allocator deallocations must follow LIFO ordering");
                 return;
             }
 
             // Pop the allocation
             m_allocations.pop_back();
 
-            // Get the current marker
-            Stack_Allocator::Marker marker = m_allocator.Get_Marker();
-
-            // Free to marker (no specific marker, just indicates "free latest")
-            m_allocator.Free_Latest();
+            // Free the latest allocation
+            m_allocator->Free_Latest();
         }
     };
 
     // Free List Allocator Adapter
     template<typename T>
-    class Free_List_Allocator_Adapter : public Allocator_Interface<T>
+    class Free_List_Allocator_Adapter
     {
+    public:
+        using value_type = T;
+
     private:
-        Free_List_Allocator& m_allocator;
+        Free_List_Allocator* m_allocator;
+
+        template<typename> friend class Free_List_Allocator_Adapter;
 
     public:
-        Free_List_Allocator_Adapter(Free_List_Allocator& allocator) : m_allocator(allocator) {}
+        Free_List_Allocator_Adapter(Free_List_Allocator& allocator) : m_allocator(&allocator) {}
+
+        template<typename U>
+        Free_List_Allocator_Adapter(const Free_List_Allocator_Adapter<U>& other) : m_allocator(other.m_allocator) {}
 
-        T* allocate(ds_u64 n) override
+        T* allocate(ds_u64 n)
         {
-            return static_cast<T*>(m_allocator.Allocate(sizeof(T) * n, alignof(T)));
+            return static_cast<T*>(m_allocator->Allocate(sizeof(T) * n, alignof(T)));
         }
 
-        void deallocate(T* p, ds_u64 n) override
+        void deallocate(T* p, ds_u64)
         {
-            m_allocator.Deallocate(p);
+            m_allocator->Deallocate(p);
+        }
+
+        ds_bool try_expand(T* p, ds_u64, ds_u64 new_n)
+        {
+            return m_allocator->Try_Expand(p, sizeof(T) * new_n);
         }
     };
 
     // Page Allocator Adapter
     template<typename T>
-    class Page_Allocator_Adapter : public Allocator_Interface<T>
+    class Page_Allocator_Adapter
     {
+    public:
+        using value_type = T;
+
     private:
-        Page_Allocator& m_allocator;
+        Page_Allocator* m_allocator;
         Page_Protection m_protection;
         Page_Flags m_flags;
 
+        template<typename> friend class Page_Allocator_Adapter;
+
     public:
         Page_Allocator_Adapter(
             Page_Allocator& allocator,
             Page_Protection protection = Page_Protection::READ_WRITE,
             Page_Flags flags = Page_Flags::COMMIT | Page_Flags::ZERO
         ) :
-            m_allocator(allocator),
+            m_allocator(&allocator),
             m_protection(protection),
             m_flags(flags)
         {
         }
 
-        T* allocate(ds_u64 n) override
+        template<typename U>
+        Page_Allocator_Adapter(const Page_Allocator_Adapter<U>& other) :
+            m_allocator(other.m_allocator),
+            m_protection(other.m_protection),
+            m_flags(other.m_flags)
+        {
+        }
+
+        T* allocate(ds_u64 n)
         {
             // Page allocators typically work with larger blocks
             // We'll round up to the nearest page size if necessary
             ds_u64 size = sizeof(T) * n;
-            ds_u64 page_size = m_allocator.Get_Page_Size();
+            ds_u64 page_size = m_allocator->Get_Page_Size();
 
             if (size < page_size)
             {
@@ -178,80 +248,68 @@ namespace ds::core::memory
                 size = ((size + page_size - 1) / page_size) * page_size;
             }
 
-            return static_cast<T*>(m_allocator.Allocate(size, m_protection, m_flags));
+            return static_cast<T*>(m_allocator->Allocate(size, m_protection, m_flags));
+        }
+
+        void deallocate(T* p, ds_u64)
+        {
+            m_allocator->Deallocate(p);
         }
 
-        void deallocate(T* p, ds_u64 n) override
+        ds_bool try_expand(T* p, ds_u64, ds_u64 new_n)
         {
-            m_allocator.Deallocate(p);
+            return m_allocator->Try_Expand(p, sizeof(T) * new_n);
         }
     };
 
     // Streaming Allocator Adapter
+    // Takes budgeted pages straight from the streaming allocator, without going through resource loading
     template<typename T>
-    class Streaming_Allocator_Adapter : public Allocator_Interface<T>
+    class Streaming_Allocator_Adapter
     {
+    public:
+        using value_type = T;
+
     private:
-        Streaming_Allocator& m_allocator;
-        Resource_Category m_category;
-        std::unordered_map<T*, Resource_Handle> m_handles;
+        Streaming_Allocator* m_allocator;
+        Streaming_Allocator::Resource_Category m_category;
+
+        template<typename> friend class Streaming_Allocator_Adapter;
 
     public:
         Streaming_Allocator_Adapter(
             Streaming_Allocator& allocator,
-            Resource_Category category = Resource_Category::GENERIC
+            Streaming_Allocator::Resource_Category category = Streaming_Allocator::Resource_Category::GENERIC
         ) :
-            m_allocator(allocator),
+            m_allocator(&allocator),
             m_category(category)
         {
         }
 
-        T* allocate(ds_u64 n) override
+        template<typename U>
+        Streaming_Allocator_Adapter(const Streaming_Allocator_Adapter<U>& other) :
+            m_allocator(other.m_allocator),
+            m_category(other.m_category)
         {
-            // Create a unique resource path for this allocation
-            static ds_u64 next_id = 1;
-            std::string path = "memory://" + std::to_string(next_id++);
-
-            // Request the resource
-            Resource_Request request;
-            request.resource_id = 0; // Generate a new ID
-            request.path = path.c_str();
-            request.category = m_category;
-            request.priority = Resource_Priority::HIGH; // High priority for allocator requests
-            request.access_mode = Access_Mode::READ_WRITE;
-            request.callback = nullptr;
-            request.user_data = nullptr;
-            request.auto_unload = true;
-            request.estimated_size = sizeof(T) * n;
-
-            Resource_Handle handle = m_allocator.Request_Resource(request);
-
-            // Wait for the resource to be loaded (not ideal in production, but necessary for this adapter)
-            while (handle.state != Resource_State::RESIDENT)
-            {
-                m_allocator.Update(0.016f); // Update with 16ms
-                handle.state = m_allocator.Get_Resource_Info(handle)->state;
-            }
-
-            // Access the resource
-            T* data = static_cast<T*>(m_allocator.Access_Resource(handle));
-
-            // Store the handle for deallocation
-            m_handles[data] = handle;
+        }
 
-            return data;
+        T* allocate(ds_u64 n)
+        {
+            return static_cast<T*>(m_allocator->Allocate_Memory(sizeof(T) * n, m_category));
         }
 
-        void deallocate(T* p, ds_u64 n) override
+        void deallocate(T* p, ds_u64 n)
         {
-            auto it = m_handles.find(p);
-            if (it != m_handles.end())
-            {
-                // Release the resource
-                m_allocator.Release_Resource(it->second);
-                m_allocator.Unload_Resource(it->second);
-                m_handles.erase(it);
-            }
+            m_allocator->Deallocate_Memory(p, sizeof(T) * n, m_category);
         }
     };
-}
\ No newline at end of file
+
+    static_assert(Ds_Allocator<Default_Allocator<ds_u8>>);
+    static_assert(Ds_Expandable_Allocator<Arena_Allocator_Adapter<ds_u8>>);
+    static_assert(Ds_Allocator<Pool_Allocator_Adapter<ds_u8>>);
+    static_assert(Ds_Allocator<Stack_Allocator_Adapter<ds_u8>>);
+    static_assert(Ds_Expandable_Allocator<Free_List_Allocator_Adapter<ds_u8>>);
+    static_assert(Ds_Expandable_Allocator<Page_Allocator_Adapter<ds_u8>>);
+    static_assert(Ds_Allocator<Streaming_Allocator_Adapter<ds_u8>>);
+    static_assert(std::is_empty_v<Default_Allocator<ds_u8>>);
+}
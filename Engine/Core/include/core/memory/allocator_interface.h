@@ -1,9 +1,104 @@
 #pragma once
 #include <core/defines.h>
+#include <concepts>
+#include <new>
+#include <utility>
 
 namespace ds::core::memory
 {
-    // Allocator interface for container compatibility
+    /**
+     * Requirements for allocators used by engine containers
+     *
+     * Containers call allocators directly through their concrete type, so an allocator
+     * needs no vtable and stateless ones take no space inside the container.
+     * construct, destroy and try_expand are optional, Allocator_Traits supplies defaults.
+     */
+    template<typename A>
+    concept Ds_Allocator = requires(A allocator, typename A::value_type* p, ds_u64 n)
+    {
+        typename A::value_type;
+        { allocator.allocate(n) } -> std::same_as<typename A::value_type*>;
+        allocator.deallocate(p, n);
+    };
+
+    // Allocators that can grow an allocation without moving it
+    template<typename A>
+    concept Ds_Expandable_Allocator = Ds_Allocator<A> && requires(A allocator, typename A::value_type* p, ds_u64 n)
+    {
+        { allocator.try_expand(p, n, n) } -> std::convertible_to<ds_bool>;
+    };
+
+    // Statically dispatched access to an allocator's optional hooks
+    template<Ds_Allocator A>
+    struct Allocator_Traits
+    {
+        using value_type = typename A::value_type;
+
+        template<typename U, typename... Args>
+        static void construct(A& allocator, U* p, Args&&... args)
+        {
+            if constexpr (requires { allocator.construct(p, std::forward<Args>(args)...); })
+            {
+                allocator.construct(p, std::forward<Args>(args)...);
+            }
+            else
+            {
+                new(p) U(std::forward<Args>(args)...);
+            }
+        }
+
+        template<typename U>
+        static void destroy(A& allocator, U* p)
+        {
+            if constexpr (requires { allocator.destroy(p); })
+            {
+                allocator.destroy(p);
+            }
+            else
+            {
+                p->~U();
+            }
+        }
+
+        // Tries to grow the allocation at p from old_n to new_n objects without moving it
+        static ds_bool try_expand(A& allocator, value_type* p, ds_u64 old_n, ds_u64 new_n)
+        {
+            if constexpr (Ds_Expandable_Allocator<A>)
+            {
+                return allocator.try_expand(p, old_n, new_n);
+            }
+            else
+            {
+                return false;
+            }
+        }
+    };
+
+    /**
+     * Same allocator family for another element type
+     *
+     * Containers that keep bookkeeping arrays next to their elements rebind the element
+     * allocator with this, so every array comes from the allocator the user picked.
+     * Allocator<T> maps to Allocator<U>, and the result must be constructible from the original.
+     */
+    template<typename A, typename U>
+    struct Allocator_Rebind;
+
+    template<template<typename> class A, typename T, typename U>
+    struct Allocator_Rebind<A<T>, U>
+    {
+        using type = A<U>;
+    };
+
+    template<typename A, typename U>
+    using Rebind_Allocator = typename Allocator_Rebind<A, U>::type;
+
+    /**
+     * Runtime polymorphic allocator interface
+     *
+     * Only for code that picks its allocator at runtime. Containers take it through
+     * Polymorphic_Allocator, concrete allocators are wrapped with Allocator_Model.
+     */
     template<typename T>
     class Allocator_Interface
     {
@@ -15,16 +110,69 @@ namespace ds::core::memory
         virtual T* allocate(ds_u64 n) = 0;
         virtual void deallocate(T* p, ds_u64 n) = 0;
 
-        template<typename U, typename... Args>
-        void construct(U* p, Args&&... args)
+        // Tries to grow the allocation at p from old_n to new_n objects without moving it
+        // Returns false when the allocator can't grow in place, the allocation is left untouched then
+        virtual ds_bool try_expand(T*, ds_u64, ds_u64)
         {
-            new(p) U(std::forward<Args>(args)...);
+            return false;
         }
+    };
 
-        template<typename U>
-        void destroy(U* p)
+    // Implements Allocator_Interface on top of a concrete allocator
+    template<Ds_Allocator A>
+    class Allocator_Model : public Allocator_Interface<typename A::value_type>
+    {
+    private:
+        using T = typename A::value_type;
+
+        A m_allocator;
+
+    public:
+        explicit Allocator_Model(A allocator) : m_allocator(std::move(allocator)) {}
+
+        T* allocate(ds_u64 n) override
+        {
+            return m_allocator.allocate(n);
+        }
+
+        void deallocate(T* p, ds_u64 n) override
+        {
+            m_allocator.deallocate(p, n);
+        }
+
+        ds_bool try_expand(T* p, ds_u64 old_n, ds_u64 new_n) override
+        {
+            return Allocator_Traits<A>::try_expand(m_allocator, p, old_n, new_n);
+        }
+    };
+
+    // Type-erased allocator for containers, refers to an Allocator_Interface owned elsewhere
+    template<typename T>
+    class Polymorphic_Allocator
+    {
+    private:
+        Allocator_Interface<T>* m_resource;
+
+    public:
+        using value_type = T;
+
+        Polymorphic_Allocator(Allocator_Interface<T>& resource) : m_resource(&resource) {}
+
+        T* allocate(ds_u64 n)
         {
-            p->~U();
+            return m_resource->allocate(n);
         }
+
+        void deallocate(T* p, ds_u64 n)
+        {
+            m_resource->deallocate(p, n);
+        }
+
+        ds_bool try_expand(T* p, ds_u64 old_n, ds_u64 new_n)
+        {
+            return m_resource->try_expand(p, old_n, new_n);
+        }
+
+        Allocator_Interface<T>* Get_Resource() const { return m_resource; }
     };
-}
\ No newline at end of file
+}
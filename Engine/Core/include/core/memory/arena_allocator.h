@@ -51,6 +51,17 @@ namespace ds::core::memory
 		 */
 		void* Allocate(ds_u64 size, ds_u64 alignment = DEFAULT_ALIGNMENT);
 
+		/**
+		 * Grows an allocation in place
+		 * Only the most recent allocation can grow, since it is the one ending at the current position
+		 *
+		 * @param ptr Pointer returned by Allocate
+		 * @param old_size Current size of the allocation in bytes
+		 * @param new_size Requested size in bytes
+		 * @return True if the allocation now spans new_size bytes, false if it was left untouched
+		 */
+		bool Try_Expand(void* ptr, ds_u64 old_size, ds_u64 new_size);
+
 		/**
 		 * Allocates and constructs an object of Type T
 		 * 
@@ -95,6 +95,16 @@ namespace ds::core::memory
 		 */
 		bool Deallocate(void* ptr);
 
+		/**
+		 * Grows an allocation in place by absorbing the free block that follows it
+		 * Whatever is left of that block goes back to the free list
+		 *
+		 * @param ptr Pointer to previously allocated memory
+		 * @param new_size Requested size in bytes
+		 * @return True if the allocation now spans new_size bytes, false if it was left untouched
+		 */
+		bool Try_Expand(void* ptr, ds_u64 new_size);
+
 		/**
 		 * Destroys an object and deallocates its memory
 		 *
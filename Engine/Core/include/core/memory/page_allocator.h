@@ -176,6 +176,18 @@ namespace ds::core::memory
             return Deallocate(ptr);
         }
 
+        /**
+         * Grows an allocation in place
+         * Succeeds when the new size still fits in the pages already allocated, or when the
+         * allocation is the last one carved from the reserved address space and enough of
+         * that space is left to commit behind it
+         *
+         * @param ptr Pointer returned by Allocate
+         * @param new_size Requested size in bytes (will be rounded up to page size)
+         * @return True if the allocation now spans new_size bytes, false if it was left untouched
+         */
+        bool Try_Expand(void* ptr, ds_u64 new_size);
+
         /**
          * Changes the protection mode of an allocated page block
          *
@@ -1,3 +1,4 @@
+#pragma once
 #include <core/ds.h>
 #include <core/memory/memory.h>
 
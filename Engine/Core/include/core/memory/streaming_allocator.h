@@ -53,6 +53,27 @@ namespace ds::core::memory
         bool IsReady() const { return state == Resource_State::RESIDENT; }
     };
 
+    /**
+     * Bundle loading callback function type
+     * Called once when every resource in a bundle has become resident
+     *
+     * @param bundle_id The ID of the bundle that finished loading
+     * @param user_data User-provided data passed to the bundle request
+     */
+    using Bundle_Loaded_Callback = void (*)(ds_u64 bundle_id, void* user_data);
+
+    /**
+     * Bundle handle for referring to a group of resources requested together
+     */
+    struct Bundle_Handle
+    {
+        ds_u64 id = 0;            // Unique identifier for the bundle
+        Resource_State state = Resource_State::UNLOADED;  // Combined state of all resources in the bundle
+
+        bool IsValid() const { return id != 0; }
+        bool IsReady() const { return state == Resource_State::RESIDENT; }
+    };
+
     /**
      * Streaming Allocator
      *
@@ -112,6 +133,18 @@ namespace ds::core::memory
             ds_u32 animation_budget_percent = 5;
             ds_u32 script_budget_percent = 2;
             ds_u32 generic_budget_percent = 3;
+
+            // Adaptive budgets let a full category borrow the unused budget of other categories.
+            // Each category keeps guaranteed_budget_percent of its own budget out of lending, and
+            // borrowed allocations are evicted first when a lender needs its budget back.
+            // Values above 100 are clamped to 100
+            ds_bool enable_adaptive_budgets = false;
+            ds_u32 guaranteed_budget_percent = 50;
+
+            // Hot reload watches the files of resident resources (inotify, Linux only) and reloads
+            // them in the background when they change; the new data is swapped in during Update once the
+            // resource has no references, and a file that grew has to fit the category budget like a load
+            ds_bool enable_hot_reload = false;
         };
 
         /**
@@ -128,6 +161,31 @@ namespace ds::core::memory
             void* user_data;                                 // User data passed to callback
             ds_bool auto_unload;                         // Whether to automatically unload
             ds_u64 estimated_size;                       // Estimated size (used for preallocation)
+            ds_u64 file_offset = 0;                      // Offset of the resource inside its file (must be page aligned for mapped files)
+        };
+
+        /**
+         * Bundle request information
+         * A bundle loads several resources as one unit and reports RESIDENT once all of them are in
+         */
+        struct Bundle_Request
+        {
+            const Resource_Request* requests;                // Requests for the resources in the bundle
+            ds_u32 request_count;                            // Number of requests
+            Bundle_Loaded_Callback callback;                 // Callback when the whole bundle is loaded
+            void* user_data;                                 // User data passed to callback
+        };
+
+        /**
+         * Bundle information
+         */
+        struct Bundle_Info
+        {
+            ds_u64 id;                                 // Unique identifier
+            Resource_State state;                          // Combined state of the bundle
+            ds_u32 resource_count;                     // Number of resources in the bundle
+            ds_u32 resident_count;                     // Number of resources already resident
+            ds_u32 failed_count;                       // Number of resources that failed to load
         };
 
         /**
@@ -160,6 +218,8 @@ namespace ds::core::memory
                 ds_u64 memory_used;                     // Memory used for this category
                 ds_u64 memory_budget;                   // Memory budget for this category
                 ds_u64 resource_count;                  // Number of resources in this category
+                ds_u64 memory_borrowed;                 // Memory used above this category's budget (adaptive budgets)
+                ds_u64 memory_lent;                     // Unused budget currently covering other categories
             };
 
             Category_Stats category_stats[6];               // Stats for each category
@@ -171,6 +231,84 @@ namespace ds::core::memory
             ds_u64 bytes_unloaded;                      // Total bytes unloaded in this session
             ds_u32 load_operations;                     // Total load operations
             ds_u32 unload_operations;                   // Total unload operations
+            ds_u64 total_memory_borrowed;               // Memory borrowed across categories (adaptive budgets)
+            ds_u32 borrowed_evictions;                  // Borrowed resources evicted to return budget to lenders
+            ds_u32 direct_allocation_count;             // Live in-memory allocations made with Allocate_Memory
+            ds_u64 cached_memory_bytes;                 // Released Allocate_Memory pages kept for reuse, within the total budget
+            ds_u32 hot_reload_count;                    // Resources swapped after their file changed on disk
+        };
+
+        /**
+         * Phases a load goes through between request and residency
+         */
+        enum class Load_Phase
+        {
+            QUEUE_WAIT,     // Time spent in the pending queue before execution
+            IO,             // Time spent allocating, mapping and reading the resource
+            DECOMPRESS      // Time spent decompressing (reserved until a decompression stage exists)
+        };
+
+        /**
+         * Output formats for telemetry dumps
+         */
+        enum class Telemetry_Format
+        {
+            CSV,
+            JSON
+        };
+
+        static constexpr ds_u32 CATEGORY_COUNT = 6;
+        static constexpr ds_u32 PRIORITY_COUNT = 5;
+        static constexpr ds_u32 PHASE_COUNT = 3;
+        static constexpr ds_u32 MAX_DEPENDENCIES = 8;         // Dependencies per resource
+        static constexpr ds_u32 MAX_BUNDLE_RESOURCES = 64;    // Resources per bundle
+
+        /**
+         * Latency histogram with power-of-two microsecond buckets
+         * Bucket i counts samples in [2^i, 2^(i+1)) microseconds, bucket 0 also holds sub-microsecond samples
+         */
+        struct Latency_Histogram
+        {
+            static constexpr ds_u32 BUCKET_COUNT = 24;  // Last bucket collects everything above ~8 seconds
+
+            ds_u64 buckets[BUCKET_COUNT];               // Sample count per bucket
+            ds_u64 sample_count;                        // Total number of samples
+            ds_u64 total_us;                            // Sum of all samples in microseconds
+            ds_u64 max_us;                              // Largest sample in microseconds
+
+            /**
+             * Approximates a percentile from the bucket counts
+             *
+             * @param percentile Percentile in the range [0, 100]
+             * @return Upper bound of the bucket containing the percentile, in microseconds
+             */
+            ds_u64 Percentile_US(ds_f32 percentile) const;
+
+            /**
+             * @return Mean sample in microseconds, or 0 if there are no samples
+             */
+            ds_u64 Mean_US() const { return sample_count ? total_us / sample_count : 0; }
+        };
+
+        /**
+         * Point-in-time copy of the streaming telemetry counters
+         */
+        struct Telemetry_Snapshot
+        {
+            ds_u64 timestamp_us;                                  // When the snapshot was taken
+
+            Latency_Histogram category_latency[CATEGORY_COUNT];   // Request-to-resident latency per category
+            Latency_Histogram priority_latency[PRIORITY_COUNT];   // Request-to-resident latency per priority
+            Latency_Histogram phase_latency[PHASE_COUNT];         // Time spent per load phase
+
+            ds_u64 budget_rejections[CATEGORY_COUNT];             // Loads rejected by the category budget
+            ds_u64 evictions[CATEGORY_COUNT];                     // Unloads per category
+            ds_u64 evicted_bytes[CATEGORY_COUNT];                 // Bytes unloaded per category
+            ds_u64 reloads_after_eviction;                        // Loads of resources that were evicted before
+
+            ds_u32 rolling_window_seconds;                        // Longest window used for the rates below
+            ds_f64 bandwidth_bytes_per_second;                    // Bytes loaded per second over the window
+            ds_f64 evictions_per_second;                          // Unloads per second over the window
         };
 
         /**
@@ -202,6 +340,71 @@ namespace ds::core::memory
          */
         Resource_Handle Request_Resource(const Resource_Request& request);
 
+        /**
+         * Requests a group of resources as a single bundle
+         * File I/O for the bundle is issued in path and file offset order to keep reads sequential
+         *
+         * @param request Information about the resources to load
+         * @return Handle to the bundle, invalid if the bundle could not be created
+         */
+        Bundle_Handle Request_Bundle(const Bundle_Request& request);
+
+        /**
+         * Gets information about a bundle
+         * The counts and state are as of the last Update or Request_Bundle
+         *
+         * @param handle Handle to the bundle
+         * @return Bundle information, or nullptr if not found
+         */
+        const Bundle_Info* Get_Bundle_Info(Bundle_Handle handle);
+
+        /**
+         * Gets the handle of a resource inside a bundle
+         *
+         * @param handle Handle to the bundle
+         * @param index Index of the resource, in the order it was requested
+         * @return Handle to the resource, invalid if the bundle or index is not found
+         */
+        Resource_Handle Get_Bundle_Resource(Bundle_Handle handle, ds_u32 index);
+
+        /**
+         * Unloads every resource in a bundle and stops tracking the bundle
+         *
+         * @param handle Handle to the bundle
+         * @return True if the bundle was found
+         */
+        bool Unload_Bundle(Bundle_Handle handle);
+
+        /**
+         * Declares that a resource needs another resource to be resident before it is loaded
+         * Loading the resource schedules its dependencies first, and a failed dependency fails the resource
+         *
+         * @param resource Handle to the dependent resource
+         * @param dependency Handle to the resource it depends on
+         * @return True if the dependency was recorded
+         */
+        bool Add_Resource_Dependency(Resource_Handle resource, Resource_Handle dependency);
+
+        /**
+         * Allocates budgeted memory straight from the streaming page pool
+         * There is no resource entry or I/O behind the memory, so it is ready immediately and is never evicted
+         *
+         * @param size Size of the allocation in bytes (charged to the budget rounded up to whole pages)
+         * @param category Category whose budget is charged
+         * @return Pointer aligned to the system page size, or nullptr if the budget is exhausted. With adaptive budgets
+         *         a refused call queues the eviction of borrowed memory, so a call after the next Update can succeed
+         */
+        void* Allocate_Memory(ds_u64 size, Resource_Category category = Resource_Category::GENERIC);
+
+        /**
+         * Returns memory obtained from Allocate_Memory to the page pool
+         *
+         * @param ptr Pointer returned by Allocate_Memory
+         * @param size Size passed to Allocate_Memory
+         * @param category Category passed to Allocate_Memory
+         */
+        void Deallocate_Memory(void* ptr, ds_u64 size, Resource_Category category = Resource_Category::GENERIC);
+
         /**
          * Prefetches a resource (loads it with background priority)
          *
@@ -297,6 +500,23 @@ namespace ds::core::memory
          */
         Stats Get_Stats();
 
+        /**
+         * Gets a snapshot of the latency, bandwidth and eviction telemetry
+         * Does not take the allocator lock, so it is safe to call from any thread at any rate
+         *
+         * @return Telemetry snapshot
+         */
+        Telemetry_Snapshot Get_Telemetry_Snapshot() const;
+
+        /**
+         * Writes a telemetry snapshot to a file
+         *
+         * @param path Output file path
+         * @param format Output format
+         * @return True if the file was written successfully
+         */
+        bool Dump_Telemetry(const ds_char* path, Telemetry_Format format = Telemetry_Format::JSON) const;
+
         /**
          * Clears all non-critical resources
          * Useful when transitioning between game areas or levels
@@ -322,6 +542,70 @@ namespace ds::core::memory
             float distance_from_player;              // Current distance from player
             bool loading_scheduled;                  // Whether loading has been scheduled
             bool unloading_scheduled;                // Whether unloading has been scheduled
+            ds_u64 load_requested_time_us;           // When the current load was scheduled (telemetry)
+            bool was_evicted;                        // Whether the resource has been unloaded before (telemetry)
+            ds_u64 file_offset;                      // Offset of the resource inside its file
+            ds_u64 bundle_id;                        // Bundle that last requested this resource (0 = none)
+            ds_u64 dependencies[MAX_DEPENDENCIES];   // Resources that must be resident before this one loads
+            ds_u32 dependency_count;                 // Number of recorded dependencies
+            bool borrowed_budget;                    // Whether the load went over its category budget
+        };
+
+        // Bundle entry with the resources it groups
+        struct Bundle_Entry
+        {
+            Bundle_Info info;                              // Public bundle information
+            ds_u64 resource_ids[MAX_BUNDLE_RESOURCES];     // Resources in request order
+            Bundle_Loaded_Callback callback;               // Callback for when the bundle is loaded
+            void* user_data;                               // User data for callback
+            bool callback_fired;                           // Whether the callback has been called
+        };
+
+        // Lock-free histogram storage behind Latency_Histogram
+        struct Atomic_Histogram
+        {
+            std::atomic<ds_u64> buckets[Latency_Histogram::BUCKET_COUNT];
+            std::atomic<ds_u64> sample_count;
+            std::atomic<ds_u64> total_us;
+            std::atomic<ds_u64> max_us;
+
+            void Record(ds_u64 sample_us);
+            void Load(Latency_Histogram& out) const;
+            void Store(const Latency_Histogram& in);
+        };
+
+        // Per-second ring of counters used for rolling rates
+        struct Rolling_Counter
+        {
+            static constexpr ds_u32 WINDOW_SECONDS = 8;
+
+            std::atomic<ds_u64> slot_second[WINDOW_SECONDS];
+            std::atomic<ds_u64> slot_value[WINDOW_SECONDS];
+            std::atomic<ds_u64> start_us;                 // When counting started; rates never cover time before it
+
+            void Reset(ds_u64 now_us);
+            void Add(ds_u64 now_us, ds_u64 value);
+            ds_f64 Rate_Per_Second(ds_u64 now_us) const;
+            void Copy_From(const Rolling_Counter& other);
+        };
+
+        // Telemetry counters, written under m_mutex and read without it
+        struct Telemetry
+        {
+            Atomic_Histogram category_latency[CATEGORY_COUNT];
+            Atomic_Histogram priority_latency[PRIORITY_COUNT];
+            Atomic_Histogram phase_latency[PHASE_COUNT];
+
+            std::atomic<ds_u64> budget_rejections[CATEGORY_COUNT];
+            std::atomic<ds_u64> evictions[CATEGORY_COUNT];
+            std::atomic<ds_u64> evicted_bytes[CATEGORY_COUNT];
+            std::atomic<ds_u64> reloads_after_eviction;
+
+            Rolling_Counter bandwidth;
+            Rolling_Counter eviction_rate;
+
+            void Copy_From(const Telemetry& other);
+            void Reset();
         };
 
         // IO operation information
@@ -332,6 +616,8 @@ namespace ds::core::memory
             ds_u64 resource_id;                  // Resource ID
             const ds_char* path;                 // File path (for loads)
             Resource_Priority priority;              // Priority of this operation
+            ds_u64 bundle_id = 0;                // Bundle the operation belongs to (0 = none)
+            ds_u64 file_offset = 0;              // Offset inside the file, used to order bundle reads
         };
 
         // Helper methods
@@ -341,18 +627,39 @@ namespace ds::core::memory
         const Resource_Entry* Find_Resource_Entry(Resource_Handle handle) const;
 
         void Process_IO_Operations();
+        void Sort_Pending_Operations();
         void Schedule_Resource_Load(Resource_Entry* entry);
-        void Schedule_Resource_Unload(Resource_Entry* entry);
+        void Schedule_Resource_Unload(Resource_Entry* entry, Resource_Priority priority = Resource_Priority::BACKGROUND);
         void Execute_Resource_Load(const IO_Operation& operation);
         void Execute_Resource_Unload(const IO_Operation& operation);
 
         bool Has_Available_Memory(Resource_Category category, ds_u64 size) const;
+        bool Fits_Budget(const ds_u64* category_memory_used, Resource_Category category, ds_u64 size) const;
+        bool Reclaim_Borrowed_Memory(Resource_Category category, ds_u64 size);
+        void Update_Lending_Stats();
         void Update_Memory_Usage(Resource_Category category, ds_i64 size_delta);
+        void Trim_Memory_Cache(ds_u64 required_size);
         ds_u64 Get_Memory_Budget(Resource_Category category) const;
 
         ds_u64 Generate_Resource_ID();
         bool Is_Resource_Ready(const Resource_Entry* entry) const;
 
+        Resource_Handle Request_Resource_Internal(const Resource_Request& request);
+        Resource_State Get_Dependency_State(Resource_Entry* entry);
+        bool Depends_On(ds_u64 resource_id, ds_u64 dependency_id, ds_u32 depth = 0) const;
+
+        void Start_Hot_Reload();
+        void Stop_Hot_Reload();
+        void Watch_Resource_File(const Resource_Entry* entry);
+        void Hot_Reload_Thread();
+        void Reload_Changed_File(ds_i32 watch_descriptor, const ds_char* file_name);
+        void Apply_Hot_Reloads();
+
+        Bundle_Entry* Find_Bundle_Entry(Bundle_Handle handle);
+        void Schedule_Bundle_Loads(Bundle_Entry& bundle);
+        void Refresh_Bundle_State(Bundle_Entry& bundle);
+        void Update_Bundle_States();
+
         void Update_Resource_Distances(float player_x, float player_y, float player_z);
         void Check_Resource_Lifetimes();
         void Update_Loading_Queue();
@@ -369,8 +676,49 @@ namespace ds::core::memory
         Resource_Entry m_resources[MAX_RESOURCES];
         ds_u64 m_resource_count = 0;
 
+        // Page runs released by Deallocate_Memory, kept for reuse to avoid a map/unmap per allocation.
+        // They stay within the total budget next to the memory in use and give way to new loads
+        struct Cached_Memory_Block
+        {
+            void* data;
+            ds_u64 size;
+        };
+
+        static constexpr ds_u64 MAX_CACHED_MEMORY_BLOCKS = 32;
+        Cached_Memory_Block m_cached_memory_blocks[MAX_CACHED_MEMORY_BLOCKS];
+        ds_u64 m_cached_memory_block_count = 0;
+
+        // Hot reload: a watcher thread maps changed files into fresh allocations, Update swaps them in
+        struct Hot_Reload
+        {
+            ds_u64 resource_id;
+            void* data;
+            ds_u64 size;
+        };
+
+        struct Watched_Directory
+        {
+            ds_i32 watch_descriptor;
+            ds_char path[256];
+        };
+
+        static constexpr ds_u64 MAX_WATCHED_DIRECTORIES = 64;
+        Watched_Directory m_watched_directories[MAX_WATCHED_DIRECTORIES];
+        ds_u64 m_watched_directory_count = 0;
+        ds_i32 m_watch_fd = -1;
+        std::thread m_watch_thread;
+        std::atomic<bool> m_watch_running{ false };
+        std::vector<Hot_Reload> m_completed_reloads;
+
+        // Bundle tracking
+        static constexpr ds_u64 MAX_BUNDLES = 256;
+        Bundle_Entry m_bundles[MAX_BUNDLES];
+        ds_u64 m_bundle_count = 0;
+        ds_u64 m_next_bundle_id = 1;
+
         // IO operation queues
         std::vector<IO_Operation> m_pending_operations;
+        bool m_pending_operations_sorted = true;    // Cleared whenever operations are queued or retagged
         std::vector<IO_Operation> m_active_operations;
 
         // Current player position for distance-based streaming
@@ -383,6 +731,7 @@ namespace ds::core::memory
 
         // Statistics
         Stats m_stats;
+        Telemetry m_telemetry;
 
         // Timing
         ds_u64 m_last_update_time = 0;
@@ -27,7 +27,7 @@ namespace ds::core
         inline static ds_u64 s_start_time = 0;
 
         #ifdef DS_PLATFORM_MACOS
-            inline static mach_timebase_info_data_s_timebase_info = {0, 0};
+            inline static mach_timebase_info_data_t s_timebase_info = {0, 0};
         #endif
 
         friend class Application;
@@ -53,13 +53,19 @@ namespace ds::core
 
         inline void Platform_Time::Sleep(ds_u32 milliseconds)
         {
-            Sleep(milliseconds);
+            ::Sleep(milliseconds);
         }
 
         inline void Platform_Time::Initialize()
         {
+            // Later calls keep the first start time, times already handed out stay comparable
+            if (s_frequency != 0.0)
+            {
+                return;
+            }
+
             LARGE_INTEGER frequency;
-            QueryPerformanceCounter(&frequency);
+            QueryPerformanceFrequency(&frequency);
             s_frequency = 1.0 / static_cast<ds_f64>(frequency.QuadPart);
 
             LARGE_INTEGER start;
@@ -78,7 +84,7 @@ namespace ds::core
         {
             struct timespec current;
             clock_gettime(CLOCK_MONOTONIC, &current);
-            u64 time = current.tv_sec * 1000000000ull + current.tv_nsec;
+            ds_u64 time = current.tv_sec * 1000000000ull + current.tv_nsec;
             return static_cast<ds_f32>(time - s_start_time) * s_frequency;
         }
 
@@ -86,11 +92,11 @@ namespace ds::core
         {
             struct timespec current;
             clock_gettime(CLOCK_MONOTONIC, &current);
-            u64 time = current.tv_sec * 1000000000ull + current.tv_nsec;
-            return static_cast<ds_u64>((time - s_start_time) * s_frequency * 1000.0);
+            ds_u64 time = current.tv_sec * 1000000000ull + current.tv_nsec;
+            return static_cast<ds_u64>((time - s_start_time) * s_frequency * 1000000.0);
         }
 
-        inline void Platform_Time::Sleep(u32 milliseconds)
+        inline void Platform_Time::Sleep(ds_u32 milliseconds)
         {
             struct timespec ts;
             ts.tv_sec = milliseconds / 1000;
@@ -100,6 +106,12 @@ namespace ds::core
 
         inline void Platform_Time::Initialize()
         {
+            // Later calls keep the first start time, times already handed out stay comparable
+            if (s_frequency != 0.0)
+            {
+                return;
+            }
+
             s_frequency = 1.0 / 1000000000.0;  // nanoseconds to seconds
         
             struct timespec start;
@@ -136,6 +148,12 @@ namespace ds::core
 
         inline void Platform_Time::Initialize()
         {
+            // Later calls keep the first start time, times already handed out stay comparable
+            if (s_frequency != 0.0)
+            {
+                return;
+            }
+
             mach_timebase_info(&s_timebase_info);
             s_frequency = 1.0e-9;  // nanoseconds to seconds
             s_start_time = mach_absolute_time();
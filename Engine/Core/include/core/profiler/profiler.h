@@ -0,0 +1,348 @@
+#pragma once
+#include <core/defines.h>
+#include <core/platform/time.h>
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(DS_ARCH_X64) || defined(DS_ARCH_X86)
+    #define DS_PROFILER_RDTSC
+    #if defined(DS_COMPILER_MSVC)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+#endif
+
+namespace ds::core::profiler
+{
+    /**
+     * Profile_Clock - Timestamps for profile zones
+     *
+     * Reads the CPU time stamp counter where there is one, which costs a few cycles instead of a
+     * system call. Ticks are converted to microseconds with a rate measured against Platform_Time
+     * by Calibrate, and Get_Platform_Microseconds places them on the Platform_Time clock that log
+     * messages are stamped with. The counter has to be invariant, which every x64 CPU of the last
+     * decade is. Other architectures count Platform_Time microseconds directly.
+     */
+    class Profile_Clock
+    {
+    public:
+        static ds_u64 Now()
+        {
+#ifdef DS_PROFILER_RDTSC
+            return __rdtsc();
+#else
+            return Platform_Time::Get_Time_Microseconds();
+#endif
+        }
+
+        /**
+         * Measure the tick rate against Platform_Time
+         * @param milliseconds Time to measure over, longer is more accurate
+         */
+        static void Calibrate(ds_u32 milliseconds);
+
+        static ds_f64 Get_Ticks_Per_Microsecond() { return s_ticks_per_microsecond; }
+
+        /**
+         * Convert a tick duration to microseconds
+         */
+        static ds_f64 Get_Microseconds(ds_u64 ticks) { return static_cast<ds_f64>(ticks) / s_ticks_per_microsecond; }
+
+        /**
+         * Convert a tick timestamp to microseconds on the Platform_Time clock
+         */
+        static ds_f64 Get_Platform_Microseconds(ds_u64 ticks)
+        {
+            ds_f64 offset = static_cast<ds_f64>(static_cast<ds_i64>(ticks - s_anchor_ticks)) / s_ticks_per_microsecond;
+            return static_cast<ds_f64>(s_anchor_microseconds) + offset;
+        }
+
+    private:
+        // Written by Calibrate only, before zones are recorded
+        inline static ds_f64 s_ticks_per_microsecond = 1.0;
+        inline static ds_u64 s_anchor_ticks = 0;            ///< Ticks read at s_anchor_microseconds
+        inline static ds_u64 s_anchor_microseconds = 0;
+    };
+
+    /**
+     * What a zone measures, trace exporters group zones by it
+     */
+    enum class Profile_Category : ds_u8
+    {
+        ZONE,           // Code instrumented with DS_PROFILE_SCOPE
+        STREAMING,      // Streaming I/O, the value is the resource id
+        LOGGER,         // Logger sink flushes, the value is the number of messages written
+        COUNT
+    };
+
+    /**
+     * One recorded scope
+     */
+    struct Profile_Zone
+    {
+        const char* name;                   ///< Static storage, zones keep the pointer only
+        ds_u64 begin;                       ///< Profile_Clock ticks
+        ds_u64 end;
+        ds_u64 value;                       ///< Meaning depends on the category, 0 when unused
+        ds_u32 depth;                       ///< Number of zones open around it on its thread
+        ds_u32 thread;                      ///< Id of the recording thread, see Profile_Thread
+        Profile_Category category;
+    };
+
+    /**
+     * One allocation or free, recorded with Profiler::Record_Allocation and Record_Free
+     */
+    struct Profile_Allocation
+    {
+        const char* allocator;              ///< Name of the allocator, has to outlive the frame
+        const void* address;
+        ds_u64 size;                        ///< Bytes allocated, 0 for frees
+        ds_u64 time;                        ///< Profile_Clock ticks
+        ds_u32 thread;                      ///< Id of the recording thread
+        bool is_free;
+    };
+
+    // Parent of the root nodes of a Profile_Thread
+    inline constexpr ds_u32 PROFILE_NO_PARENT = ~0u;
+
+    /**
+     * A zone name at one place in a thread's call tree, with every call made there in the frame
+     * merged into it
+     */
+    struct Profile_Node
+    {
+        const char* name;
+        ds_u32 parent;                      ///< Index in the same tree, PROFILE_NO_PARENT for roots
+        ds_u32 depth;
+        ds_u32 call_count;
+        ds_f64 total_microseconds;          ///< Time inside the zone, children included
+        ds_f64 self_microseconds;           ///< Time inside the zone minus its children
+    };
+
+    /**
+     * The call tree of one thread in one frame, empty for threads that only recorded allocations
+     */
+    struct Profile_Thread
+    {
+        ds_u32 id;                          ///< Registration order, stable for the thread's lifetime
+        std::string name;                   ///< Set with Profiler::Set_Thread_Name, may be empty
+        std::vector<Profile_Node> nodes;    ///< Depth first, every parent comes before its children
+    };
+
+    /**
+     * Everything recorded between Begin_Frame and End_Frame
+     *
+     * Zones belong to the frame they end in, so a zone that spans a frame boundary begins
+     * before its frame does.
+     */
+    struct Profile_Frame
+    {
+        ds_u64 index = 0;                   ///< Counts up from 0 with every End_Frame
+        ds_u64 begin = 0;                   ///< Profile_Clock ticks
+        ds_u64 end = 0;
+        ds_u64 dropped_zone_count = 0;      ///< Zones and allocations lost to full thread buffers
+        std::vector<Profile_Zone> zones;    ///< Every zone, ordered by thread and begin
+        std::vector<Profile_Allocation> allocations;    ///< Ordered by time
+        std::vector<Profile_Thread> threads;    ///< Threads that recorded zones or allocations, ordered by id
+
+        ds_f64 Get_Duration_Microseconds() const { return Profile_Clock::Get_Microseconds(end - begin); }
+
+        /**
+         * Find the first node with a name in a thread's tree
+         * @return Nullptr if the thread recorded no zone with that name
+         */
+        const Profile_Node* Find_Node(ds_u32 thread, std::string_view name) const;
+    };
+
+    struct Profile_Thread_Buffer;
+
+    /**
+     * Profiler - Scoped timing zones collected into per-frame call trees
+     *
+     * DS_PROFILE_SCOPE records the begin and end ticks of a scope into a buffer owned by the
+     * calling thread, a single producer ring the thread writes without locks or system calls.
+     * End_Frame, called from the thread that runs the frame, drains every thread's buffer and
+     * builds a call tree per thread with the calls of a zone at one place merged together.
+     * A thread whose buffer fills up between two End_Frame calls drops its zones and counts them.
+     *
+     * Like Worker_Pool, the profiler is set up with Initialize() and torn down with Shutdown().
+     * Zones recorded while it is not initialized are ignored.
+     */
+    class Profiler
+    {
+    public:
+        /**
+         * Configuration structure for the profiler
+         */
+        struct Config
+        {
+            ds_u64 thread_buffer_capacity = 16 * 1024;  // Zones a thread can record between two End_Frame calls
+            ds_u32 calibration_milliseconds = 20;       // Time spent measuring Profile_Clock against Platform_Time
+            bool record_allocations = false;            // Record allocator events, see Record_Allocation
+            ds_u64 allocation_buffer_capacity = 16 * 1024;  // Allocator events a thread can record between two End_Frame calls
+        };
+
+        /**
+         * Calibrate the clock and start recording zones
+         */
+        static void Initialize();
+        static void Initialize(const Config& config);
+
+        /**
+         * Stop recording and free every thread buffer
+         * Waits for threads still pushing a zone or allocation, later ones are ignored
+         */
+        static void Shutdown();
+
+        static bool Is_Initialized() { return s_recording.load(std::memory_order_relaxed); }
+
+        /**
+         * Name the calling thread in the frames it shows up in
+         */
+        static void Set_Thread_Name(std::string_view name);
+
+        /**
+         * Start a frame, zones ending from now on belong to it
+         */
+        static void Begin_Frame();
+
+        /**
+         * Finish the frame, collecting the zones of every thread into Get_Last_Frame
+         */
+        static void End_Frame();
+
+        /**
+         * Get the frame last finished by End_Frame, only from the thread that runs the frames
+         */
+        static const Profile_Frame& Get_Last_Frame();
+
+        /**
+         * Get the number of zones and allocations lost to full thread buffers since Initialize
+         */
+        static ds_u64 Get_Dropped_Zone_Count();
+
+        /**
+         * Record a finished zone on the calling thread, used by Profile_Scope
+         */
+        static void Record_Zone(const char* name, ds_u64 begin, ds_u64 end, ds_u32 depth,
+            Profile_Category category = Profile_Category::ZONE, ds_u64 value = 0);
+
+        static bool Is_Recording_Allocations() { return s_recording_allocations.load(std::memory_order_relaxed); }
+
+        /**
+         * Record an allocation on the calling thread, when Config::record_allocations is set
+         * @param allocator Name of the allocator, has to stay valid until the frame is consumed
+         */
+        static void Record_Allocation(const char* allocator, const void* address, ds_u64 size)
+        {
+            if (Is_Recording_Allocations() && address)
+            {
+                Record_Allocation_Event(allocator, address, size, false);
+            }
+        }
+
+        /**
+         * Record a free on the calling thread, matched to its allocation by address
+         */
+        static void Record_Free(const char* allocator, const void* address)
+        {
+            if (Is_Recording_Allocations() && address)
+            {
+                Record_Allocation_Event(allocator, address, 0, true);
+            }
+        }
+
+    private:
+        struct State;
+
+        /**
+         * Get the calling thread's buffer, registering one on first use
+         * Called with the profiler mutex held, while initialized
+         */
+        static Profile_Thread_Buffer* Get_Thread_Buffer();
+
+        static void Record_Allocation_Event(const char* allocator, const void* address, ds_u64 size, bool is_free);
+
+        inline static State* s_state = nullptr;
+        inline static std::atomic<bool> s_recording{ false };
+        inline static std::atomic<bool> s_recording_allocations{ false };
+
+        friend class Profile_Scope;
+        inline static thread_local ds_u32 s_depth = 0;      ///< Zones open on the calling thread
+    };
+
+    /**
+     * Profile_Scope - Records the lifetime of a scope as a zone, see DS_PROFILE_SCOPE
+     */
+    class Profile_Scope
+    {
+    public:
+        explicit Profile_Scope(const char* name, Profile_Category category = Profile_Category::ZONE, ds_u64 value = 0)
+        {
+            if (Profiler::Is_Initialized())
+            {
+                m_name = name;
+                m_value = value;
+                m_category = category;
+                m_depth = Profiler::s_depth++;
+                m_begin = Profile_Clock::Now();
+            }
+        }
+
+        ~Profile_Scope()
+        {
+            if (m_name)
+            {
+                ds_u64 end = Profile_Clock::Now();
+                Profiler::s_depth--;
+                Profiler::Record_Zone(m_name, m_begin, end, m_depth, m_category, m_value);
+            }
+        }
+
+        Profile_Scope(const Profile_Scope&) = delete;
+        Profile_Scope& operator=(const Profile_Scope&) = delete;
+
+        /**
+         * Set the zone's value once it is known inside the scope
+         */
+        void Set_Value(ds_u64 value) { m_value = value; }
+
+    private:
+        const char* m_name = nullptr;       ///< Nullptr while the profiler was off at the start
+        ds_u64 m_begin = 0;
+        ds_u64 m_value = 0;
+        ds_u32 m_depth = 0;
+        Profile_Category m_category = Profile_Category::ZONE;
+    };
+}
+
+// Profile zones are removed at compile time unless DS_PROFILER_ENABLED, shipping builds drop them by default
+#ifndef DS_PROFILER_ENABLED
+    #ifdef DS_SHIPPING
+        #define DS_PROFILER_ENABLED 0
+    #else
+        #define DS_PROFILER_ENABLED 1
+    #endif
+#endif
+
+#define DS_PROFILE_CONCAT_INNER(a, b) a##b
+#define DS_PROFILE_CONCAT(a, b) DS_PROFILE_CONCAT_INNER(a, b)
+
+// Macros for profile zones, the name must be a string literal or have static storage otherwise
+#if DS_PROFILER_ENABLED
+    #define DS_PROFILE_SCOPE(name) ::ds::core::profiler::Profile_Scope DS_PROFILE_CONCAT(ds_profile_scope_, __LINE__)(name)
+    #define DS_PROFILE_FUNCTION() DS_PROFILE_SCOPE(__func__)
+    #define DS_PROFILE_SCOPE_CATEGORY(name, category, value) \
+        ::ds::core::profiler::Profile_Scope DS_PROFILE_CONCAT(ds_profile_scope_, __LINE__)(name, ::ds::core::profiler::Profile_Category::category, value)
+    #define DS_PROFILE_ALLOCATION(allocator, address, size) ::ds::core::profiler::Profiler::Record_Allocation(allocator, address, size)
+    #define DS_PROFILE_FREE(allocator, address) ::ds::core::profiler::Profiler::Record_Free(allocator, address)
+#else
+    #define DS_PROFILE_SCOPE(name) ((void)0)
+    #define DS_PROFILE_FUNCTION() ((void)0)
+    #define DS_PROFILE_SCOPE_CATEGORY(name, category, value) ((void)0)
+    #define DS_PROFILE_ALLOCATION(allocator, address, size) ((void)0)
+    #define DS_PROFILE_FREE(allocator, address) ((void)0)
+#endif
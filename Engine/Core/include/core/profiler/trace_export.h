@@ -0,0 +1,182 @@
+#pragma once
+#include <core/defines.h>
+#include <core/profiler/profiler.h>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ds::core::profiler
+{
+    /**
+     * Trace_Exporter - Writes profiled frames to a trace file for external viewers
+     *
+     * Add each frame after Profiler::End_Frame, in order, then call Finish. The trace gets a
+     * track per thread with its zones and allocation events, a track with one slice per frame
+     * and a live bytes counter per allocator. The counters only know the allocations of the
+     * added frames, frees of older blocks leave them unchanged.
+     *
+     * Timestamps are on the clock log messages are stamped with, see Profile_Clock.
+     */
+    class Trace_Exporter
+    {
+    public:
+        virtual ~Trace_Exporter() = default;
+
+        Trace_Exporter(const Trace_Exporter&) = delete;
+        Trace_Exporter& operator=(const Trace_Exporter&) = delete;
+
+        /**
+         * Write the zones, allocations and threads of a frame
+         */
+        void Add_Frame(const Profile_Frame& frame);
+
+        /**
+         * Complete the file and close it, later frames are ignored
+         * @return False if the file couldn't be written
+         */
+        bool Finish();
+
+        bool Is_Open() const { return m_file.is_open(); }
+        ds_u64 Get_Frame_Count() const { return m_frame_count; }
+
+    protected:
+        Trace_Exporter(const std::string& path, ds_u64 buffer_size);
+
+        virtual void Write_Header() = 0;
+        virtual void Write_Footer() = 0;
+        virtual void Write_Thread(ds_u32 thread, std::string_view name) = 0;
+        virtual void Write_Allocator(ds_u32 allocator, std::string_view name) = 0;
+        virtual void Write_Frame(const Profile_Frame& frame) = 0;
+
+        /**
+         * Write the zones one thread recorded in a frame, ordered by begin and depth
+         */
+        virtual void Write_Zones(ds_u32 thread, std::span<const Profile_Zone> zones) = 0;
+
+        /**
+         * Write an allocation event
+         * @param allocator Index given to Write_Allocator
+         * @param live_bytes Bytes of the allocator still allocated after the event
+         */
+        virtual void Write_Allocation(const Profile_Allocation& allocation, ds_u32 allocator, ds_u64 live_bytes) = 0;
+
+        /**
+         * Nanoseconds on the log clock for Profile_Clock ticks
+         */
+        static ds_u64 To_Nanoseconds(ds_u64 ticks);
+
+        std::string m_buffer;                   ///< Written to the file once it reaches the buffer size
+
+    private:
+        struct Allocator_Track
+        {
+            std::string name;
+            ds_u64 live_bytes = 0;
+            std::unordered_map<const void*, ds_u64> sizes;      ///< Live blocks by address
+        };
+
+        void Begin();
+        void Write_Buffer();
+        ds_u32 Get_Allocator_Index(const char* name);
+
+        std::ofstream m_file;
+        ds_u64 m_buffer_size;
+        ds_u64 m_frame_count = 0;
+        bool m_started = false;
+        bool m_finished = false;
+
+        std::unordered_map<ds_u32, std::string> m_thread_names;
+        std::vector<Allocator_Track> m_allocators;
+        std::unordered_map<std::string, ds_u32> m_allocator_indices;
+    };
+
+    /**
+     * Chrome_Trace_Exporter - Writes the Chrome Trace Event JSON format
+     *
+     * Loads in ui.perfetto.dev and chrome://tracing. Zones are complete events, allocations are
+     * thread scoped instant events and the live bytes are counter events.
+     */
+    class Chrome_Trace_Exporter : public Trace_Exporter
+    {
+    public:
+        /**
+         * Configuration structure for Chrome trace files
+         */
+        struct Config
+        {
+            std::string path = "ds_trace.json";         // Path of the trace file, overwritten
+            ds_u64 buffer_size = 64 * 1024;             // Bytes buffered before they are written to the file
+        };
+
+        Chrome_Trace_Exporter();
+        explicit Chrome_Trace_Exporter(const Config& config);
+        ~Chrome_Trace_Exporter() override;
+
+    protected:
+        void Write_Header() override;
+        void Write_Footer() override;
+        void Write_Thread(ds_u32 thread, std::string_view name) override;
+        void Write_Allocator(ds_u32 allocator, std::string_view name) override;
+        void Write_Frame(const Profile_Frame& frame) override;
+        void Write_Zones(ds_u32 thread, std::span<const Profile_Zone> zones) override;
+        void Write_Allocation(const Profile_Allocation& allocation, ds_u32 allocator, ds_u64 live_bytes) override;
+
+    private:
+        /**
+         * Start an event object: separator, name, phase, thread and timestamp
+         */
+        void Begin_Event(std::string_view name, const char* phase, ds_u32 tid, ds_u64 nanoseconds);
+
+        std::vector<std::string> m_allocator_names;
+        bool m_first_event = true;
+    };
+
+    /**
+     * Perfetto_Trace_Exporter - Writes the Perfetto protobuf trace format
+     *
+     * The packets are TrackDescriptors and TrackEvents of a single sequence, encoded by hand so
+     * the engine needs no protobuf library. Zones become slice begin and end events, allocations
+     * instant events on their thread's track and the live bytes counter tracks in bytes.
+     */
+    class Perfetto_Trace_Exporter : public Trace_Exporter
+    {
+    public:
+        /**
+         * Configuration structure for Perfetto trace files
+         */
+        struct Config
+        {
+            std::string path = "ds_trace.perfetto-trace";  // Path of the trace file, overwritten
+            ds_u64 buffer_size = 64 * 1024;             // Bytes buffered before they are written to the file
+        };
+
+        Perfetto_Trace_Exporter();
+        explicit Perfetto_Trace_Exporter(const Config& config);
+        ~Perfetto_Trace_Exporter() override;
+
+    protected:
+        void Write_Header() override;
+        void Write_Footer() override;
+        void Write_Thread(ds_u32 thread, std::string_view name) override;
+        void Write_Allocator(ds_u32 allocator, std::string_view name) override;
+        void Write_Frame(const Profile_Frame& frame) override;
+        void Write_Zones(ds_u32 thread, std::span<const Profile_Zone> zones) override;
+        void Write_Allocation(const Profile_Allocation& allocation, ds_u32 allocator, ds_u64 live_bytes) override;
+
+    private:
+        /**
+         * Append a TracePacket holding an encoded TrackEvent
+         */
+        void Write_Event(ds_u64 nanoseconds, const std::string& event);
+
+        /**
+         * Append a TracePacket holding an encoded TrackDescriptor
+         */
+        void Write_Descriptor(const std::string& descriptor);
+
+        bool m_first_packet = true;
+    };
+}
@@ -0,0 +1,190 @@
+#include <core/ds_pch.h>
+#include <core/algorithms/worker_pool.h>
+#include <core/containers/dmpmc_queue.h>
+#include <core/containers/dvector.h>
+
+namespace ds::core::algorithms
+{
+    // Upper bound on job references waiting in the queue at once
+    static constexpr ds_u64 JOB_QUEUE_CAPACITY = 1024;
+
+    struct Worker_Pool::State
+    {
+        containers::DMPMC_Queue<Job*> queue{ JOB_QUEUE_CAPACITY };
+        containers::DVector<std::thread> threads;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::atomic<ds_u64> pending{ 0 };
+        std::atomic<bool> running{ true };
+        ds_u32 worker_count = 0;
+    };
+
+    void Worker_Pool::Initialize(ds_u32 worker_count)
+    {
+        if (s_state)
+        {
+            DS_LOG_CHANNEL_WARN(ALGORITHMS, "Worker_Pool: Already initialized with {0} workers", s_state->worker_count);
+            return;
+        }
+
+        if (worker_count == 0)
+        {
+            ds_u32 hardware_threads = std::thread::hardware_concurrency();
+            worker_count = hardware_threads > 1 ? hardware_threads - 1 : 1;
+        }
+
+        s_state = new State();
+        s_state->worker_count = worker_count;
+        s_state->threads.reserve(worker_count);
+        for (ds_u32 i = 0; i < worker_count; i++)
+        {
+            s_state->threads.emplace_back(&Worker_Pool::Worker_Loop, s_state);
+        }
+    }
+
+    void Worker_Pool::Shutdown()
+    {
+        if (!s_state)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(s_state->mutex);
+            s_state->running.store(false);
+        }
+        s_state->wake.notify_all();
+
+        for (std::thread& thread : s_state->threads)
+        {
+            thread.join();
+        }
+
+        delete s_state;
+        s_state = nullptr;
+    }
+
+    bool Worker_Pool::Is_Initialized()
+    {
+        return s_state != nullptr;
+    }
+
+    ds_u32 Worker_Pool::Get_Worker_Count()
+    {
+        return s_state ? s_state->worker_count : 0;
+    }
+
+    void Worker_Pool::Run_Job(Job& job)
+    {
+        State& state = *s_state;
+
+        // Invite at most one worker per task the caller won't run itself
+        ds_u64 invitations = std::min<ds_u64>(state.worker_count, job.task_count - 1);
+        job.references.store(static_cast<ds_u32>(invitations), std::memory_order_relaxed);
+
+        // Count references as pending before they become poppable, so pending never underflows
+        state.pending.fetch_add(invitations);
+
+        ds_u64 queued = 0;
+        while (queued < invitations && state.queue.try_push(&job))
+        {
+            queued++;
+        }
+
+        // References that didn't fit in the queue are dropped, the caller picks up their share
+        if (queued < invitations)
+        {
+            job.references.fetch_sub(static_cast<ds_u32>(invitations - queued), std::memory_order_relaxed);
+            state.pending.fetch_sub(invitations - queued);
+        }
+
+        if (queued > 0)
+        {
+            // Taking the lock orders the pending update before any worker's wait check
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+            }
+            state.wake.notify_all();
+        }
+
+        Execute(job);
+
+        // Wait for workers still inside this job, helping with other queued jobs meanwhile
+        // so nested Run() calls from worker threads can't starve each other
+        while (job.references.load(std::memory_order_acquire) > 0)
+        {
+            if (!Help_One(state))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        // Every thread has left the job, so a task's exception can unwind the caller now
+        if (job.exception)
+        {
+            std::rethrow_exception(job.exception);
+        }
+    }
+
+    void Worker_Pool::Execute(Job& job)
+    {
+        while (true)
+        {
+            ds_u64 task_index = job.next_task.fetch_add(1, std::memory_order_relaxed);
+            if (task_index >= job.task_count)
+            {
+                return;
+            }
+
+            try
+            {
+                job.invoke(job.context, task_index);
+            }
+            catch (...)
+            {
+                // Keep the first exception and stop handing out the remaining tasks
+                if (!job.failed.exchange(true, std::memory_order_acq_rel))
+                {
+                    job.exception = std::current_exception();
+                }
+                job.next_task.store(job.task_count, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    bool Worker_Pool::Help_One(State& state)
+    {
+        Job* job = nullptr;
+        if (!state.queue.try_pop(job))
+        {
+            return false;
+        }
+
+        state.pending.fetch_sub(1);
+        Execute(*job);
+
+        // The job may be destroyed by its caller as soon as this reaches zero
+        job->references.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    void Worker_Pool::Worker_Loop(State* state)
+    {
+        while (true)
+        {
+            if (Help_One(*state))
+            {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->wake.wait(lock, [state] { return state->pending.load() > 0 || !state->running.load(); });
+
+            if (!state->running.load() && state->pending.load() == 0)
+            {
+                return;
+            }
+        }
+    }
+}
@@ -0,0 +1,240 @@
+#include <core/ds_pch.h>
+#include <core/logger/binary_log.h>
+
+#include <cstring>
+#include <iostream>
+#include <iterator>
+
+namespace ds::core
+{
+    /////////////////////////////////////////////////////////
+    // Binary_Log_Sink
+    /////////////////////////////////////////////////////////
+
+    Binary_Log_Sink::Binary_Log_Sink()
+        : Binary_Log_Sink(Config{})
+    {
+    }
+
+    Binary_Log_Sink::Binary_Log_Sink(const Config& config)
+        : m_config(config)
+    {
+        m_buffer.reserve(m_config.buffer_size);
+    }
+
+    Binary_Log_Sink::~Binary_Log_Sink()
+    {
+        Flush();
+    }
+
+    void Binary_Log_Sink::Write(const Log_Message& message)
+    {
+        if (!m_file.is_open())
+        {
+            if (m_failed)
+            {
+                return;
+            }
+
+            Open();
+            if (!m_file.is_open())
+            {
+                return;
+            }
+        }
+
+        // Registering first, a FORMAT entry has to come before the message that uses it
+        bool deferred = message.arguments != nullptr;
+        ds_u32 format_id = deferred ? Register_Format(message.format) : 0;
+
+        Append(static_cast<ds_u8>(deferred ? Binary_Log_Entry_Type::MESSAGE : Binary_Log_Entry_Type::TEXT));
+        Append(message.time.timestamp);
+        Append(message.time.monotonic_microseconds);
+        Append(static_cast<ds_u8>(message.level));
+        Append(static_cast<ds_u8>(message.channel));
+
+        if (deferred)
+        {
+            Append(format_id);
+            Append(static_cast<ds_u32>(message.arguments_size));
+            m_buffer.append(reinterpret_cast<const char*>(message.arguments), message.arguments_size);
+        }
+        else
+        {
+            Append(static_cast<ds_u32>(message.text.size()));
+            m_buffer.append(message.text);
+        }
+
+        if (m_buffer.size() >= m_config.buffer_size)
+        {
+            Flush();
+        }
+    }
+
+    void Binary_Log_Sink::Flush()
+    {
+        if (m_buffer.empty() || !m_file.is_open())
+        {
+            return;
+        }
+
+        m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_file.flush();
+        m_buffer.clear();
+    }
+
+    void Binary_Log_Sink::Open()
+    {
+        m_file.open(m_config.path, std::ios::binary | std::ios::app);
+        if (!m_file.is_open())
+        {
+            // Logging from inside a sink would recurse, report straight to stderr
+            std::cerr << "Binary_Log_Sink: Failed to open " << m_config.path << std::endl;
+            m_failed = true;
+            return;
+        }
+
+        // Every open starts a new session, earlier sessions keep their own format ids
+        m_format_ids.clear();
+        m_buffer.append(BINARY_LOG_MAGIC, sizeof(BINARY_LOG_MAGIC));
+    }
+
+    ds_u32 Binary_Log_Sink::Register_Format(std::string_view format)
+    {
+        auto [it, inserted] = m_format_ids.try_emplace(format.data(), static_cast<ds_u32>(m_format_ids.size()));
+        if (inserted)
+        {
+            Append(static_cast<ds_u8>(Binary_Log_Entry_Type::FORMAT));
+            Append(it->second);
+            Append(static_cast<ds_u32>(format.size()));
+            m_buffer.append(format);
+        }
+
+        return it->second;
+    }
+
+    /////////////////////////////////////////////////////////
+    // Binary_Log_Reader
+    /////////////////////////////////////////////////////////
+
+    bool Binary_Log_Reader::Open(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        m_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        m_offset = 0;
+        m_formats.clear();
+        m_truncated = false;
+
+        return Read_Magic();
+    }
+
+    bool Binary_Log_Reader::Read_Magic()
+    {
+        if (m_data.size() - m_offset < sizeof(BINARY_LOG_MAGIC) ||
+            std::memcmp(m_data.data() + m_offset, BINARY_LOG_MAGIC, sizeof(BINARY_LOG_MAGIC)) != 0)
+        {
+            return false;
+        }
+
+        m_offset += sizeof(BINARY_LOG_MAGIC);
+        m_formats.clear();
+        return true;
+    }
+
+    bool Binary_Log_Reader::Next(Log_Message& message)
+    {
+        while (m_offset < m_data.size())
+        {
+            ds_u8 type = static_cast<ds_u8>(m_data[m_offset]);
+
+            // A new session, appended by a later run
+            if (type == static_cast<ds_u8>(BINARY_LOG_MAGIC[0]))
+            {
+                if (!Read_Magic())
+                {
+                    break;
+                }
+                continue;
+            }
+
+            ds_u64 entry_start = m_offset++;
+
+            if (type == static_cast<ds_u8>(Binary_Log_Entry_Type::FORMAT))
+            {
+                ds_u32 id = 0;
+                ds_u32 length = 0;
+                if (!Read(id) || !Read(length) || id != m_formats.size() || m_data.size() - m_offset < length)
+                {
+                    m_offset = entry_start;
+                    break;
+                }
+
+                m_formats.emplace_back(m_data.data() + m_offset, length);
+                m_offset += length;
+                continue;
+            }
+
+            if (type != static_cast<ds_u8>(Binary_Log_Entry_Type::MESSAGE) && type != static_cast<ds_u8>(Binary_Log_Entry_Type::TEXT))
+            {
+                m_offset = entry_start;
+                break;
+            }
+
+            ds_u8 level = 0;
+            ds_u8 channel = 0;
+            message = Log_Message();
+            if (!Read(message.time.timestamp) || !Read(message.time.monotonic_microseconds) || !Read(level) || !Read(channel) ||
+                level >= static_cast<ds_u8>(Log_Level::NONE) || channel >= static_cast<ds_u8>(Log_Channel::COUNT))
+            {
+                m_offset = entry_start;
+                break;
+            }
+            message.level = static_cast<Log_Level>(level);
+            message.channel = static_cast<Log_Channel>(channel);
+
+            if (type == static_cast<ds_u8>(Binary_Log_Entry_Type::TEXT))
+            {
+                ds_u32 length = 0;
+                if (!Read(length) || m_data.size() - m_offset < length)
+                {
+                    m_offset = entry_start;
+                    break;
+                }
+
+                message.text = std::string_view(m_data.data() + m_offset, length);
+                m_offset += length;
+                return true;
+            }
+
+            ds_u32 format_id = 0;
+            ds_u32 size = 0;
+            if (!Read(format_id) || !Read(size) || format_id >= m_formats.size() || m_data.size() - m_offset < size)
+            {
+                m_offset = entry_start;
+                break;
+            }
+
+            message.format = m_formats[format_id];
+            message.arguments = reinterpret_cast<const ds_u8*>(m_data.data() + m_offset);
+            message.arguments_size = size;
+            m_offset += size;
+
+            // Arguments that don't fit their format keep the raw format string as text
+            m_text.clear();
+            if (!Format_Tagged_Log_Arguments(m_text, message.format, message.arguments, message.arguments_size))
+            {
+                m_text.assign(message.format);
+            }
+            message.text = m_text;
+            return true;
+        }
+
+        m_truncated = m_offset < m_data.size();
+        return false;
+    }
+}
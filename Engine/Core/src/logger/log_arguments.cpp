@@ -0,0 +1,204 @@
+#include <core/ds_pch.h>
+#include <core/logger/log_arguments.h>
+
+#include <vector>
+
+namespace ds::core
+{
+    // Helper function to read a value of type T and advance in past it
+    template<typename T>
+    static bool Read_Packed_Value(const ds_u8*& in, const ds_u8* end, T& value)
+    {
+        if (end - in < static_cast<std::ptrdiff_t>(sizeof(T)))
+        {
+            return false;
+        }
+
+        std::memcpy(&value, in, sizeof(T));
+        in += sizeof(T);
+        return true;
+    }
+
+    // Helper function to read an integer of type T and widen it to Wide
+    template<typename T, typename Wide>
+    static bool Read_Packed_Integer(const ds_u8*& in, const ds_u8* end, Log_Argument_Value& value)
+    {
+        T integer{};
+        if (!Read_Packed_Value(in, end, integer))
+        {
+            return false;
+        }
+
+        value = static_cast<Wide>(integer);
+        return true;
+    }
+
+    bool Unpack_Tagged_Log_Argument(const ds_u8*& in, const ds_u8* end, Log_Argument_Value& value)
+    {
+        if (in >= end)
+        {
+            return false;
+        }
+
+        Log_Argument_Type type = static_cast<Log_Argument_Type>(*in++);
+        switch (type)
+        {
+        case Log_Argument_Type::BOOL:
+        {
+            bool boolean = false;
+            if (!Read_Packed_Value(in, end, boolean))
+                return false;
+            value = boolean;
+            return true;
+        }
+        case Log_Argument_Type::CHAR:
+        {
+            char character = 0;
+            if (!Read_Packed_Value(in, end, character))
+                return false;
+            value = character;
+            return true;
+        }
+        case Log_Argument_Type::I8:
+            return Read_Packed_Integer<ds_i8, ds_i64>(in, end, value);
+        case Log_Argument_Type::I16:
+            return Read_Packed_Integer<ds_i16, ds_i64>(in, end, value);
+        case Log_Argument_Type::I32:
+            return Read_Packed_Integer<ds_i32, ds_i64>(in, end, value);
+        case Log_Argument_Type::I64:
+            return Read_Packed_Integer<ds_i64, ds_i64>(in, end, value);
+        case Log_Argument_Type::U8:
+            return Read_Packed_Integer<ds_u8, ds_u64>(in, end, value);
+        case Log_Argument_Type::U16:
+            return Read_Packed_Integer<ds_u16, ds_u64>(in, end, value);
+        case Log_Argument_Type::U32:
+            return Read_Packed_Integer<ds_u32, ds_u64>(in, end, value);
+        case Log_Argument_Type::U64:
+            return Read_Packed_Integer<ds_u64, ds_u64>(in, end, value);
+        case Log_Argument_Type::F32:
+        {
+            ds_f32 number = 0.0f;
+            if (!Read_Packed_Value(in, end, number))
+                return false;
+            value = number;
+            return true;
+        }
+        case Log_Argument_Type::F64:
+        {
+            ds_f64 number = 0.0;
+            if (!Read_Packed_Value(in, end, number))
+                return false;
+            value = number;
+            return true;
+        }
+        case Log_Argument_Type::POINTER:
+        {
+            const void* pointer = nullptr;
+            if (!Read_Packed_Value(in, end, pointer))
+                return false;
+            value = pointer;
+            return true;
+        }
+        case Log_Argument_Type::STRING:
+        {
+            ds_u32 length = 0;
+            if (!Read_Packed_Value(in, end, length) || end - in < static_cast<std::ptrdiff_t>(length))
+                return false;
+            value = std::string_view(reinterpret_cast<const char*>(in), length);
+            in += length;
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    bool Format_Tagged_Log_Arguments(std::string& out, std::string_view format, const ds_u8* arguments, ds_u64 size)
+    {
+        std::vector<Log_Argument_Value> values;
+        const ds_u8* end = arguments + size;
+        while (arguments < end)
+        {
+            if (!Unpack_Tagged_Log_Argument(arguments, end, values.emplace_back()))
+            {
+                return false;
+            }
+        }
+
+        // Each replacement field is formatted on its own as "{:spec}" with its one argument
+        std::string field = "{";
+        ds_u64 next_index = 0;
+        ds_u64 i = 0;
+        while (i < format.size())
+        {
+            char c = format[i];
+            if (c == '}')
+            {
+                if (i + 1 >= format.size() || format[i + 1] != '}')
+                    return false;
+                out += '}';
+                i += 2;
+                continue;
+            }
+
+            if (c != '{')
+            {
+                out += c;
+                i++;
+                continue;
+            }
+
+            if (i + 1 < format.size() && format[i + 1] == '{')
+            {
+                out += '{';
+                i += 2;
+                continue;
+            }
+
+            ds_u64 close = format.find('}', i + 1);
+            if (close == std::string_view::npos)
+                return false;
+
+            std::string_view replacement = format.substr(i + 1, close - i - 1);
+            if (replacement.find('{') != std::string_view::npos)
+                return false;
+
+            ds_u64 colon = std::min(replacement.find(':'), replacement.size());
+            std::string_view index_text = replacement.substr(0, colon);
+
+            ds_u64 index = next_index++;
+            if (!index_text.empty())
+            {
+                index = 0;
+                for (char digit : index_text)
+                {
+                    if (digit < '0' || digit > '9')
+                        return false;
+                    index = index * 10 + static_cast<ds_u64>(digit - '0');
+                }
+            }
+
+            if (index >= values.size())
+                return false;
+
+            field.resize(1);
+            field.append(replacement.substr(colon));
+            field += '}';
+
+            try
+            {
+                std::visit([&](const auto& value) {
+                    std::vformat_to(std::back_inserter(out), field, std::make_format_args(value));
+                }, values[index]);
+            }
+            catch (const std::format_error&)
+            {
+                return false;
+            }
+
+            i = close + 1;
+        }
+
+        return true;
+    }
+}
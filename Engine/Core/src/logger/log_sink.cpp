@@ -0,0 +1,226 @@
+#include <core/ds_pch.h>
+#include <core/logger/log_sink.h>
+#include <core/logger/console_format.h>
+
+#include <filesystem>
+#include <iostream>
+
+namespace ds::core
+{
+    // Helper function to get the color for a log level based on a theme
+    static const char* Get_Log_Level_Color(const Theme_Struct& theme, Log_Level level)
+    {
+        switch (level)
+        {
+        case Log_Level::TRACE:
+            return theme.trace_color;
+        case Log_Level::INFO:
+            return theme.info_color;
+        case Log_Level::WARN:
+            return theme.warn_color;
+        case Log_Level::ERR:
+            return theme.err_color;
+        case Log_Level::FATAL:
+            return theme.fatal_color;
+        default:
+            return theme.message_color;
+        }
+    }
+
+    /////////////////////////////////////////////////////////
+    // Log_Sink
+    /////////////////////////////////////////////////////////
+
+    void Log_Sink::Append_Prefix(std::string& out, const Log_Message& message)
+    {
+        out.append(message.time_text);
+        out += ' ';
+        out.append(Logger::Get_Level_Name(message.level));
+        if (message.channel != Log_Channel::GENERAL)
+        {
+            out.append(" [");
+            out.append(Logger::Get_Channel_Name(message.channel));
+            out += ']';
+        }
+        out += ' ';
+    }
+
+    void Log_Sink::Append_Without_Ansi(std::string& out, std::string_view text)
+    {
+        ds_u64 start = 0;
+        ds_u64 escape = text.find('\x1B');
+        while (escape != std::string_view::npos)
+        {
+            out.append(text.substr(start, escape - start));
+
+            // Skip ESC [ parameters up to and including the final byte, e.g. \x1B[1;31m
+            ds_u64 end = escape + 1;
+            if (end < text.size() && text[end] == '[')
+            {
+                end++;
+                while (end < text.size() && (text[end] < 0x40 || text[end] > 0x7E))
+                {
+                    end++;
+                }
+                end++;
+            }
+
+            start = std::min<ds_u64>(end, text.size());
+            escape = text.find('\x1B', start);
+        }
+
+        out.append(text.substr(start));
+    }
+
+    /////////////////////////////////////////////////////////
+    // Console_Log_Sink
+    /////////////////////////////////////////////////////////
+
+    void Console_Log_Sink::Write(const Log_Message& message)
+    {
+        const Theme_Struct& theme = Logger::Get_Current_Theme_Struct();
+
+        m_buffer.append(theme.timestamp_color).append(message.time_text).append(console_format::RESET).append(" ");
+        m_buffer.append(Get_Log_Level_Color(theme, message.level)).append(Logger::Get_Level_Name(message.level));
+        if (message.channel != Log_Channel::GENERAL)
+        {
+            m_buffer.append(" [").append(Logger::Get_Channel_Name(message.channel)).append("]");
+        }
+        m_buffer.append(console_format::RESET).append(" ");
+        m_buffer.append(theme.message_color).append(message.text).append(console_format::RESET).append("\n");
+    }
+
+    void Console_Log_Sink::Flush()
+    {
+        if (m_buffer.empty())
+        {
+            return;
+        }
+
+        std::cout.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        std::cout.flush();
+        m_buffer.clear();
+    }
+
+    /////////////////////////////////////////////////////////
+    // File_Log_Sink
+    /////////////////////////////////////////////////////////
+
+    File_Log_Sink::File_Log_Sink()
+        : File_Log_Sink(Config{})
+    {
+    }
+
+    File_Log_Sink::File_Log_Sink(const Config& config)
+        : m_config(config)
+    {
+        m_buffer.reserve(m_config.buffer_size);
+    }
+
+    File_Log_Sink::~File_Log_Sink()
+    {
+        Flush();
+    }
+
+    void File_Log_Sink::Write(const Log_Message& message)
+    {
+        // The line is built first so size based rotation knows how much it adds
+        m_line.clear();
+        Append_Prefix(m_line, message);
+        Append_Without_Ansi(m_line, message.text);
+        m_line += '\n';
+
+        if (!m_file.is_open())
+        {
+            if (m_failed)
+            {
+                return;
+            }
+
+            Open(message.time.timestamp);
+            if (!m_file.is_open())
+            {
+                return;
+            }
+        }
+        else
+        {
+            bool too_big = m_config.max_file_size > 0 && m_file_size > 0 && m_file_size + m_line.size() > m_config.max_file_size;
+            bool too_old = m_config.max_file_age_seconds > 0 &&
+                message.time.timestamp - m_opened_at >= static_cast<ds_i64>(m_config.max_file_age_seconds) * 1000000000ll;
+            if (too_big || too_old)
+            {
+                Rotate(message.time.timestamp);
+            }
+        }
+
+        m_buffer.append(m_line);
+        m_file_size += m_line.size();
+
+        if (m_buffer.size() >= m_config.buffer_size)
+        {
+            Flush();
+        }
+    }
+
+    void File_Log_Sink::Flush()
+    {
+        if (m_buffer.empty() || !m_file.is_open())
+        {
+            return;
+        }
+
+        m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_file.flush();
+        m_buffer.clear();
+    }
+
+    std::string File_Log_Sink::Get_Rotated_Path(ds_u32 index) const
+    {
+        std::filesystem::path path(m_config.path);
+        std::filesystem::path rotated = path.parent_path() /
+            (path.stem().string() + "." + std::to_string(index) + path.extension().string());
+        return rotated.string();
+    }
+
+    void File_Log_Sink::Open(ds_i64 timestamp)
+    {
+        m_file.open(m_config.path, std::ios::binary | std::ios::app);
+        if (!m_file.is_open())
+        {
+            // Logging from inside a sink would recurse, report straight to stderr
+            std::cerr << "File_Log_Sink: Failed to open " << m_config.path << std::endl;
+            m_failed = true;
+            return;
+        }
+
+        std::error_code error;
+        ds_u64 existing_size = std::filesystem::file_size(m_config.path, error);
+        m_file_size = error ? 0 : existing_size;
+        m_opened_at = timestamp;
+    }
+
+    void File_Log_Sink::Rotate(ds_i64 timestamp)
+    {
+        Flush();
+        m_file.close();
+
+        std::error_code error;
+        if (m_config.max_rotated_files == 0)
+        {
+            std::filesystem::remove(m_config.path, error);
+        }
+        else
+        {
+            // Shift name.1.ext -> name.2.ext and so on, dropping the oldest
+            std::filesystem::remove(Get_Rotated_Path(m_config.max_rotated_files), error);
+            for (ds_u32 index = m_config.max_rotated_files - 1; index >= 1; index--)
+            {
+                std::filesystem::rename(Get_Rotated_Path(index), Get_Rotated_Path(index + 1), error);
+            }
+            std::filesystem::rename(m_config.path, Get_Rotated_Path(1), error);
+        }
+
+        Open(timestamp);
+    }
+}
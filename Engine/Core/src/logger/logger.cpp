@@ -1,12 +1,21 @@
 #include <core/ds_pch.h>
 #include <core/logger/logger.h>
 #include <core/logger/console_format.h>
+#include <core/logger/log_sink.h>
+#include <core/logger/crash_log.h>
+#include <core/containers/dspsc_ring.h>
+#include <core/memory/page_allocator.h>
+#include <core/platform/time.h>
+#include <core/profiler/profiler.h>
 
+#include <bit>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
 #include <fstream>
-#include <iomanip>
-#include <sstream>
-#include <regex>
+#include <iterator>
 
 namespace ds::core
 {
@@ -14,65 +23,255 @@ namespace ds::core
     static Theme_Struct s_current_theme = DEFAULT_THEME;
     static Logger_Theme s_current_theme_enum = Logger_Theme::DEFAULT;
 
-    // Helper function to get current time string
-    static std::string Get_Current_Time()
+    // Helper function to read both log clocks
+    static Log_Time Get_Log_Time()
     {
-        auto now = std::chrono::system_clock::now();
-        auto in_time_t = std::chrono::system_clock::to_time_t(now);
-
-        std::ostringstream ss;
-        ss << std::put_time(std::localtime(&in_time_t), "[%Y-%m-%d %H:%M:%S]");
-        return ss.str();
+        Log_Time time;
+        time.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        time.monotonic_microseconds = Platform_Time::Get_Time_Microseconds();
+        return time;
     }
 
-    // Helper function to get the color for a log level based on current theme
-    static const char* Get_Log_Level_Color(Log_Level level)
+    // Size of one ring record, four cache lines
+    static constexpr ds_u64 LOG_RECORD_SIZE = 256;
+
+    // Records a thread ring holds before its producer has to wait for the logger thread
+    static constexpr ds_u64 LOG_THREAD_RING_CAPACITY = 512;
+    static_assert(std::has_single_bit(LOG_THREAD_RING_CAPACITY), "Crash log rings hold exactly LOG_THREAD_RING_CAPACITY records");
+
+    // Longest the logger thread sleeps without a wakeup, bounds the delay of a missed one
+    static constexpr std::chrono::milliseconds LOG_FLUSH_INTERVAL{ 10 };
+
+    // Record flag: the message continues in the next record of the same ring
+    static constexpr ds_u8 LOG_RECORD_CONTINUES = 1 << 0;
+
+    // Record flag: the payload is a deferred header and packed arguments, not text
+    static constexpr ds_u8 LOG_RECORD_DEFERRED = 1 << 1;
+
+    // Record flag: a deferred payload carries its format string between the header and the arguments
+    static constexpr ds_u8 LOG_RECORD_FORMAT_EMBEDDED = 1 << 2;
+
+    // Record flag: the record continues the message of the previous record, lets crash log
+    // readers tell a message's first record from one whose predecessors were overwritten
+    static constexpr ds_u8 LOG_RECORD_CONTINUATION = 1 << 3;
+
+    /**
+     * Fixed-size ring slot holding a message, or one piece of a message that is
+     * longer than LOG_RECORD_TEXT_CAPACITY
+     */
+    struct Log_Record
     {
-        switch (level)
+        Log_Time time;                      ///< Taken on the logging thread
+        ds_u32 length;                      ///< Bytes used in text
+        ds_u8 level;
+        ds_u8 channel;
+        ds_u8 flags;
+        char text[LOG_RECORD_SIZE - 24];
+
+        Log_Record() = default;
+
+        Log_Record(const Log_Time& record_time, Log_Channel record_channel, Log_Level record_level, ds_u8 record_flags, const char* data, ds_u32 data_length)
+            : time(record_time), length(data_length), level(static_cast<ds_u8>(record_level)),
+              channel(static_cast<ds_u8>(record_channel)), flags(record_flags)
         {
-        case Log_Level::TRACE:
-            return s_current_theme.trace_color;
-        case Log_Level::INFO:
-            return s_current_theme.info_color;
-        case Log_Level::WARN:
-            return s_current_theme.warn_color;
-        case Log_Level::ERR:
-            return s_current_theme.err_color;
-        case Log_Level::FATAL:
-            return s_current_theme.fatal_color;
-        default:
-            return s_current_theme.message_color;
+            // Only the used part of the slot is written
+            std::memcpy(text, data, data_length);
         }
-    }
+    };
 
-    // Helper function to get the string representation of a log level
-    static std::string Get_Log_Level_String(Log_Level level)
+    static constexpr ds_u64 LOG_RECORD_TEXT_CAPACITY = sizeof(Log_Record::text);
+    static_assert(sizeof(Log_Record) == LOG_RECORD_SIZE, "Log_Record must fill its slot exactly");
+
+    /**
+     * Allocator for the thread rings. The logger is used before Memory is initialized
+     * and after it shuts down, so ring storage comes straight from the system heap, or
+     * is a ring of the crash log mapping, which the logger hands out and takes back itself.
+     */
+    template<typename T>
+    class Log_Ring_Allocator
     {
-        switch (level)
+    public:
+        using value_type = T;
+
+        Log_Ring_Allocator() = default;
+
+        explicit Log_Ring_Allocator(void* storage)
+            : m_storage(storage)
         {
-        case Log_Level::TRACE:
-            return "[TRACE]";
-        case Log_Level::INFO:
-            return "[INFO]";
-        case Log_Level::WARN:
-            return "[WARN]";
-        case Log_Level::ERR:
-            return "[ERR]";
-        case Log_Level::FATAL:
-            return "[FATAL]";
-        default:
-            return "[NONE]";
         }
-    }
 
-    Logger::Logger() : m_running(false)
+        template<typename U>
+        Log_Ring_Allocator(const Log_Ring_Allocator<U>& other)
+            : m_storage(other.Get_Storage())
+        {
+        }
+
+        T* allocate(ds_u64 n)
+        {
+            if (m_storage)
+            {
+                return static_cast<T*>(m_storage);
+            }
+            return static_cast<T*>(::operator new(sizeof(T) * n, std::align_val_t{ alignof(T) }));
+        }
+
+        void deallocate(T* p, ds_u64)
+        {
+            if (!m_storage)
+            {
+                ::operator delete(p, std::align_val_t{ alignof(T) });
+            }
+        }
+
+        void* Get_Storage() const { return m_storage; }
+
+    private:
+        void* m_storage = nullptr;      ///< Crash log ring, nullptr for heap storage
+    };
+
+    /**
+     * One logging thread's ring. The thread is the only producer and the logger
+     * thread the only consumer.
+     */
+    struct Log_Thread_Buffer
+    {
+        explicit Log_Thread_Buffer(const Log_Ring_Allocator<Log_Record>& allocator, ds_u32 ring_index)
+            : ring(LOG_THREAD_RING_CAPACITY, allocator), crash_ring(ring_index)
+        {
+        }
+
+        containers::DSPSC_Ring<Log_Record, Log_Ring_Allocator<Log_Record>> ring;
+        ds_u32 crash_ring;                      ///< Ring of the crash log used as storage, or LOG_NO_CRASH_RING
+        std::atomic<bool> retired{ false };     ///< Set once the owning thread has exited
+        std::string partial;                    ///< Consumer side: pieces of a split message read so far
+
+        std::atomic<ds_u64> dropped[LOG_LEVEL_COUNT]{};     ///< Producer counts, the logger thread collects
+        ds_u64 overflow_count = 0;              ///< Producer side: messages that found the ring full, for sampling
+    };
+
+    // Crash_ring of thread buffers with heap storage
+    static constexpr ds_u32 LOG_NO_CRASH_RING = ~0u;
+
+    /**
+     * The crash log mapping and which of its rings are in use
+     */
+    struct Log_Crash_File
+    {
+        std::string path;                       ///< Page_Allocator keeps a pointer to it
+        memory::Page_Allocator allocator{ 0, 0, "Logger crash log" };
+        ds_u8* mapping = nullptr;
+        std::vector<ds_u32> free_rings;
+
+        ~Log_Crash_File()
+        {
+            if (mapping)
+            {
+                allocator.Deallocate(mapping);
+            }
+        }
+
+        void* Get_Ring(ds_u32 index) const
+        {
+            return mapping + LOG_RECORD_SIZE + static_cast<ds_u64>(index) * LOG_THREAD_RING_CAPACITY * LOG_RECORD_SIZE;
+        }
+    };
+
+    // Retires the calling thread's ring when the thread exits, the logger thread frees it once drained
+    struct Log_Thread_Buffer_Owner
     {
-        // Initialize the logger
+        Log_Thread_Buffer* buffer = nullptr;
+
+        ~Log_Thread_Buffer_Owner()
+        {
+            if (buffer)
+            {
+                buffer->retired.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    static thread_local Log_Thread_Buffer_Owner t_log_thread_buffer;
+
+    Logger::Logger()
+    {
+        // Messages carry monotonic times, which need the platform clock set up
+        Platform_Time::Initialize();
     }
 
     Logger::~Logger()
     {
         Stop();
+
+        for (Log_Thread_Buffer* buffer : m_thread_buffers)
+        {
+            delete buffer;
+        }
+        m_thread_buffers.clear();
+
+        // Unmapped while the sinks still exist, Page_Allocator logs its destruction
+        m_crash_log_enabled = false;
+        m_crash_file.reset();
+    }
+
+    bool Logger::Enable_Crash_Log(const std::string& path, ds_u64 size)
+    {
+        constexpr ds_u64 ring_size = LOG_THREAD_RING_CAPACITY * LOG_RECORD_SIZE;
+        ds_u64 ring_count = std::max<ds_u64>(size / ring_size, 1);
+        ds_u64 file_size = memory::Memory::Align_Size(LOG_RECORD_SIZE + ring_count * ring_size, memory::Page_Allocator::Get_System_Page_Size());
+
+        // m_mutex can't be held while creating the file, the page allocator and the error below
+        // log, and a thread's first message takes m_mutex. Serializing the calls instead keeps
+        // a second call from replacing the file of an enabled crash log.
+        std::lock_guard<std::mutex> enable_lock(m_crash_log_mutex);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_crash_file)
+            {
+                return false;
+            }
+        }
+
+        // A fresh file reads as zeros, empty slots are skipped by the reader
+        std::error_code error;
+        std::filesystem::remove(path, error);
+        std::ofstream(path, std::ios::binary).close();
+        std::filesystem::resize_file(path, file_size, error);
+        if (error)
+        {
+            Log(Log_Channel::GENERAL, Log_Level::ERR, std::format("Logger: Failed to create crash log {}", path));
+            return false;
+        }
+
+        auto crash_file = std::make_unique<Log_Crash_File>();
+        crash_file->path = path;
+        crash_file->mapping = static_cast<ds_u8*>(crash_file->allocator.Allocate(file_size, memory::Page_Protection::READ_WRITE,
+            memory::Page_Flags::MAP_FILE | memory::Page_Flags::SHARED, crash_file->path.c_str()));
+        if (!crash_file->mapping)
+        {
+            return false;
+        }
+
+        Crash_Log_Header header;
+        std::memcpy(header.magic, CRASH_LOG_MAGIC, sizeof(header.magic));
+        header.record_size = static_cast<ds_u32>(LOG_RECORD_SIZE);
+        header.ring_capacity = static_cast<ds_u32>(LOG_THREAD_RING_CAPACITY);
+        header.ring_count = static_cast<ds_u32>(ring_count);
+        header.header_size = static_cast<ds_u32>(LOG_RECORD_SIZE);
+        std::memcpy(crash_file->mapping, &header, sizeof(header));
+
+        // Handed out from the back, ring 0 first
+        for (ds_u32 ring = static_cast<ds_u32>(ring_count); ring > 0; ring--)
+        {
+            crash_file->free_rings.push_back(ring - 1);
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Set first, every deferred record in a crash log ring has its format string
+        m_crash_log_enabled = true;
+        m_crash_file = std::move(crash_file);
+        return true;
     }
 
     void Logger::Start()
@@ -112,110 +311,531 @@ namespace ds::core
         }
     }
 
-    void Logger::Log(Log_Level level, const std::string& message)
+    void Logger::Log(Log_Channel channel, Log_Level level, const std::string& message)
     {
-        if (m_synchronous_mode)
+        if (!Is_Enabled(channel, level))
         {
-            std::ofstream log_file;
-            if (m_file_output_mode)
-            {
-                log_file = std::ofstream("ds.log", std::ios::app);
-            }
+            return;
+        }
+
+        Log_Time time = Get_Log_Time();
+
+        // Without a logger thread to drain the rings, write on the calling thread
+        if (m_synchronous_mode.load(std::memory_order_relaxed) || !m_running.load(std::memory_order_acquire))
+        {
+            Write_Synchronous(channel, level, time, 0, message);
+            return;
+        }
 
-            // Get current time
-            std::string timestamp = Get_Current_Time();
+        Push_Records(channel, level, time, 0, message.data(), message.size());
+    }
+
+    void Logger::Log_Deferred(Log_Channel channel, Log_Level level, const ds_u8* payload, ds_u64 size, bool format_embedded)
+    {
+        Log_Time time = Get_Log_Time();
+        const char* data = reinterpret_cast<const char*>(payload);
+        ds_u8 flags = format_embedded ? (LOG_RECORD_DEFERRED | LOG_RECORD_FORMAT_EMBEDDED) : LOG_RECORD_DEFERRED;
+
+        if (m_synchronous_mode.load(std::memory_order_relaxed) || !m_running.load(std::memory_order_acquire))
+        {
+            Write_Synchronous(channel, level, time, flags, std::string_view(data, size));
+            return;
+        }
 
-            // Get log level colors and strings
-            const char* level_color = Get_Log_Level_Color(level);
-            std::string level_string = Get_Log_Level_String(level);
+        Push_Records(channel, level, time, flags, data, size);
+    }
+
+    void Logger::Push_Records(Log_Channel channel, Log_Level level, const Log_Time& time, ds_u8 flags, const char* data, ds_u64 size)
+    {
+        Log_Thread_Buffer& buffer = Get_Thread_Buffer();
 
-            // Format for console with colors
-            std::cout << s_current_theme.timestamp_color << timestamp << console_format::RESET << " "
-                << level_color << level_string << console_format::RESET << " "
-                << s_current_theme.message_color << message << console_format::RESET << std::endl;
+        // A message is kept or dropped whole, never cut off after some of its records
+        ds_u64 record_count = std::max<ds_u64>((size + LOG_RECORD_TEXT_CAPACITY - 1) / LOG_RECORD_TEXT_CAPACITY, 1);
+        if (buffer.ring.capacity() - buffer.ring.size() < record_count && !Keep_Overflowing_Message(buffer, level))
+        {
+            buffer.dropped[static_cast<ds_u64>(level)].fetch_add(1, std::memory_order_relaxed);
+            Request_Wake();
+            return;
+        }
 
-            // Write to file (without ANSI color codes)
-            if (m_file_output_mode)
+        // Payloads longer than one record are split across consecutive records
+        const char* piece = data;
+        ds_u64 remaining = size;
+        do
+        {
+            ds_u32 length = static_cast<ds_u32>(std::min(remaining, LOG_RECORD_TEXT_CAPACITY));
+            ds_u8 piece_flags = remaining > length ? (flags | LOG_RECORD_CONTINUES) : flags;
+            if (piece != data)
             {
-                if (log_file.is_open())
-                {
-                    // Use regex to strip ANSI color codes for file output
-                    std::string clean_message = message;
-                    std::regex ansi_regex("\\x1B\\[[0-9;]*[mK]");
-                    clean_message = std::regex_replace(clean_message, ansi_regex, "");
+                piece_flags |= LOG_RECORD_CONTINUATION;
+            }
 
-                    log_file << timestamp << " " << level_string << " " << clean_message << std::endl;
+            while (!buffer.ring.try_emplace(time, channel, level, piece_flags, piece, length))
+            {
+                // The logger stopped while the ring was full, nobody will make room
+                if (!m_running.load(std::memory_order_acquire))
+                {
+                    Write_Synchronous(channel, level, time, flags, std::string_view(data, size));
+                    return;
                 }
+
+                Request_Wake();
+                std::this_thread::yield();
             }
-        }
-        else
+
+            piece += length;
+            remaining -= length;
+        } while (remaining > 0);
+
+        Request_Wake();
+    }
+
+    Log_Thread_Buffer& Logger::Get_Thread_Buffer()
+    {
+        if (!t_log_thread_buffer.buffer)
         {
             std::lock_guard<std::mutex> lock(m_mutex);
-            m_log_queue.emplace(level, message);
+
+            // Storage from the crash log while it has rings left
+            Log_Ring_Allocator<Log_Record> allocator;
+            ds_u32 crash_ring = LOG_NO_CRASH_RING;
+            if (m_crash_file && !m_crash_file->free_rings.empty())
+            {
+                crash_ring = m_crash_file->free_rings.back();
+                m_crash_file->free_rings.pop_back();
+                allocator = Log_Ring_Allocator<Log_Record>(m_crash_file->Get_Ring(crash_ring));
+            }
+
+            Log_Thread_Buffer* buffer = new Log_Thread_Buffer(allocator, crash_ring);
+            m_thread_buffers.push_back(buffer);
+            t_log_thread_buffer.buffer = buffer;
         }
-        m_condition_variable.notify_one();
+
+        return *t_log_thread_buffer.buffer;
     }
 
-    void Logger::Process_Logs()
+    void Logger::Request_Wake()
     {
-        std::ofstream log_file;
-        if (m_file_output_mode)
+        // Only the first message after the logger thread goes back to sleep pays for a notify,
+        // the rest of the batch sees the flag already set
+        if (!m_wake_requested.load(std::memory_order_relaxed) &&
+            !m_wake_requested.exchange(true, std::memory_order_acq_rel))
         {
-            log_file = std::ofstream("ds.log", std::ios::app);
+            m_condition_variable.notify_one();
         }
+    }
 
-        while (m_running)
+    bool Logger::Keep_Overflowing_Message(Log_Thread_Buffer& buffer, Log_Level level)
+    {
+        switch (m_overflow_policy.load(std::memory_order_relaxed))
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_condition_variable.wait(lock, [this] { return !m_log_queue.empty() || !m_running; });
+        case Log_Overflow_Policy::DROP_NEWEST:
+            return false;
+        case Log_Overflow_Policy::DROP_BY_LEVEL:
+            return level >= m_overflow_level.load(std::memory_order_relaxed);
+        case Log_Overflow_Policy::SAMPLE:
+            return buffer.overflow_count++ % m_overflow_sample_rate.load(std::memory_order_relaxed) == 0;
+        default:
+            return true;
+        }
+    }
 
-            if (!m_running && m_log_queue.empty())
-                break;
+    bool Logger::Drain_Thread_Buffers()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        bool drained = false;
+        ds_u64 i = 0;
+        while (i < m_thread_buffers.size())
+        {
+            Log_Thread_Buffer* buffer = m_thread_buffers[i];
 
-            while (!m_log_queue.empty())
+            // Read before draining: a thread retires only after its last push
+            bool retired = buffer->retired.load(std::memory_order_acquire);
+
+            while (Log_Record* record = buffer->ring.front())
             {
-                auto [level, message] = m_log_queue.front();
-                m_log_queue.pop();
-                lock.unlock();
+                if (record->flags & LOG_RECORD_CONTINUES)
+                {
+                    buffer->partial.append(record->text, record->length);
+                }
+                else
+                {
+                    Log_Entry& entry = m_pending_entries.emplace_back();
+                    entry.time = record->time;
+                    entry.level = static_cast<Log_Level>(record->level);
+                    entry.channel = static_cast<Log_Channel>(record->channel);
+                    entry.flags = record->flags;
 
-                // Get current time
-                std::string timestamp = Get_Current_Time();
+                    // Most messages fit one record, deferred ones are formatted when written
+                    if (buffer->partial.empty())
+                    {
+                        entry.payload.assign(record->text, record->length);
+                    }
+                    else
+                    {
+                        buffer->partial.append(record->text, record->length);
+                        entry.payload = std::move(buffer->partial);
+                        buffer->partial.clear();
+                    }
+                }
 
-                // Get log level colors and strings
-                const char* level_color = Get_Log_Level_Color(level);
-                std::string level_string = Get_Log_Level_String(level);
+                buffer->ring.pop();
+                drained = true;
+            }
 
-                // Format for console with colors
-                std::cout << s_current_theme.timestamp_color << timestamp << console_format::RESET << " "
-                    << level_color << level_string << console_format::RESET << " "
-                    << s_current_theme.message_color << message << console_format::RESET << std::endl;
+            for (ds_u64 level = 0; level < LOG_LEVEL_COUNT; level++)
+            {
+                ds_u64 dropped = buffer->dropped[level].exchange(0, std::memory_order_relaxed);
+                m_unreported_drops[level] += dropped;
+                m_dropped_message_count.fetch_add(dropped, std::memory_order_relaxed);
+            }
 
-                // Write to file (without ANSI color codes)
-                if (m_file_output_mode)
+            if (retired)
+            {
+                if (buffer->crash_ring != LOG_NO_CRASH_RING)
                 {
-                    if (log_file.is_open())
-                    {
-                        // Use regex to strip ANSI color codes for file output
-                        std::string clean_message = message;
-                        std::regex ansi_regex("\\x1B\\[[0-9;]*[mK]");
-                        clean_message = std::regex_replace(clean_message, ansi_regex, "");
+                    m_crash_file->free_rings.push_back(buffer->crash_ring);
+                }
+                delete buffer;
+                m_thread_buffers[i] = m_thread_buffers.back();
+                m_thread_buffers.pop_back();
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        return drained;
+    }
+
+    void Logger::Process_Logs()
+    {
+        profiler::Profiler::Set_Thread_Name("Logger");
+
+        while (true)
+        {
+            ds_u64 flush_requests = 0;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition_variable.wait_for(lock, LOG_FLUSH_INTERVAL, [this] { return m_wake_requested.load() || !m_running.load(); });
+
+                // Messages logged before these Flush() calls are already in the rings
+                flush_requests = m_flush_requests;
+            }
+
+            // Read before the final drain, so it still sees everything logged before Stop
+            bool running = m_running.load();
+            m_wake_requested.store(false);
 
-                        log_file << timestamp << " " << level_string << " " << clean_message << std::endl;
+            bool drained = Drain_Thread_Buffers();
+            if (drained)
+            {
+                // Rings are drained one thread after another, restore the global order
+                std::stable_sort(m_pending_entries.begin(), m_pending_entries.end(),
+                    [](const Log_Entry& a, const Log_Entry& b) { return a.time.monotonic_microseconds < b.time.monotonic_microseconds; });
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_output_mutex);
+                for (const Log_Entry& entry : m_pending_entries)
+                {
+                    Write_Message(entry.channel, entry.level, entry.time, entry.flags, entry.payload);
+                }
+
+                // At most one report per interval, so a log storm costs one warning per interval
+                bool reported = false;
+                auto now = std::chrono::steady_clock::now();
+                if (!running || now - m_last_drop_report >= std::chrono::milliseconds(m_drop_report_interval.load(std::memory_order_relaxed)))
+                {
+                    reported = Report_Dropped_Messages();
+                    if (reported)
+                    {
+                        m_last_drop_report = now;
                     }
                 }
 
-                lock.lock();
+                // One flush per batch instead of one per line
+                if (drained || reported || flush_requests > m_flushes_done)
+                {
+                    DS_PROFILE_SCOPE_CATEGORY("Log Flush", LOGGER, m_pending_entries.size());
+                    Flush_Sinks();
+                }
             }
+            m_pending_entries.clear();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (flush_requests > m_flushes_done)
+                {
+                    m_flushes_done = flush_requests;
+                    m_flush_condition.notify_all();
+                }
+            }
+
+            if (!running)
+                break;
+        }
+    }
+
+    bool Logger::Report_Dropped_Messages()
+    {
+        ds_u64 total = 0;
+        for (ds_u64 dropped : m_unreported_drops)
+        {
+            total += dropped;
+        }
+
+        if (total == 0)
+        {
+            return false;
+        }
+
+        std::string message = std::format("Logger dropped {} messages: {} trace, {} info, {} warn, {} error, {} fatal", total,
+            m_unreported_drops[0], m_unreported_drops[1], m_unreported_drops[2], m_unreported_drops[3], m_unreported_drops[4]);
+        std::fill(std::begin(m_unreported_drops), std::end(m_unreported_drops), 0);
+
+        // Written straight to the sinks, the rings may still be full
+        Write_Message(Log_Channel::GENERAL, Log_Level::WARN, Get_Log_Time(), 0, message);
+        return true;
+    }
+
+    void Logger::Flush()
+    {
+        if (!m_synchronous_mode.load() && m_running.load())
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            ds_u64 request = ++m_flush_requests;
+
+            m_wake_requested.store(true);
+            m_condition_variable.notify_one();
+
+            m_flush_condition.wait(lock, [this, request] { return m_flushes_done >= request || !m_running.load(); });
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_output_mutex);
+        Flush_Sinks();
+    }
+
+    Log_Sink* Logger::Add_Sink(std::unique_ptr<Log_Sink> sink)
+    {
+        std::lock_guard<std::mutex> lock(m_output_mutex);
+        m_sinks.push_back(std::move(sink));
+        return m_sinks.back().get();
+    }
+
+    void Logger::Remove_Sink(Log_Sink* sink)
+    {
+        std::lock_guard<std::mutex> lock(m_output_mutex);
+        auto it = std::find_if(m_sinks.begin(), m_sinks.end(), [sink](const std::unique_ptr<Log_Sink>& owned) { return owned.get() == sink; });
+        if (it != m_sinks.end())
+        {
+            (*it)->Flush();
+            m_sinks.erase(it);
+        }
+    }
+
+    void Logger::Write_Synchronous(Log_Channel channel, Log_Level level, const Log_Time& time, ds_u8 flags, std::string_view payload)
+    {
+        std::lock_guard<std::mutex> lock(m_output_mutex);
+        Write_Message(channel, level, time, flags, payload);
+        Flush_Sinks();
+    }
+
+    std::string_view Logger::Format_Time(const Log_Time& time)
+    {
+        // Floor division, so times before the epoch still group by whole seconds
+        ds_i64 second = time.timestamp / 1000000000ll;
+        if (time.timestamp < 0 && time.timestamp % 1000000000ll != 0)
+        {
+            second--;
+        }
+
+        if (m_cached_second_length == 0 || second != m_cached_second)
+        {
+            std::time_t seconds = static_cast<std::time_t>(second);
+            std::tm local_time{};
+#ifdef DS_PLATFORM_WINDOWS
+            localtime_s(&local_time, &seconds);
+#else
+            localtime_r(&seconds, &local_time);
+#endif
+            char date[32];
+            m_cached_second_length = std::strftime(date, sizeof(date), "[%Y-%m-%d %H:%M:%S", &local_time);
+            m_cached_second = second;
+            m_time_text.assign(date, m_cached_second_length);
+        }
+
+        // Everything after the date part is rebuilt per message
+        m_time_text.resize(m_cached_second_length);
+        if (m_monotonic_time_mode.load(std::memory_order_relaxed))
+        {
+            char monotonic[32];
+            std::snprintf(monotonic, sizeof(monotonic), " +%llu.%06llu",
+                static_cast<unsigned long long>(time.monotonic_microseconds / 1000000),
+                static_cast<unsigned long long>(time.monotonic_microseconds % 1000000));
+            m_time_text += monotonic;
+        }
+        m_time_text += ']';
+
+        return m_time_text;
+    }
+
+    void Logger::Write_Message(Log_Channel channel, Log_Level level, const Log_Time& time, ds_u8 flags, std::string_view payload)
+    {
+        std::string_view time_text = Format_Time(time);
+
+        Log_Message log_message;
+        log_message.time = time;
+        log_message.level = level;
+        log_message.channel = channel;
+        log_message.time_text = time_text;
+
+        if (flags & LOG_RECORD_DEFERRED)
+        {
+            Deferred_Header header;
+            std::memcpy(&header, payload.data(), sizeof(header));
+
+            // Record text is not aligned for the header or the arguments, they are read with memcpy
+            ds_u64 arguments_offset = sizeof(header) + ((flags & LOG_RECORD_FORMAT_EMBEDDED) ? header.format_length : 0);
+            log_message.format = std::string_view(header.format, header.format_length);
+            log_message.arguments = reinterpret_cast<const ds_u8*>(payload.data()) + arguments_offset;
+            log_message.arguments_size = payload.size() - arguments_offset;
+
+            bool needs_text = m_console_output_mode.load(std::memory_order_relaxed) || m_file_output_mode.load(std::memory_order_relaxed) ||
+                std::any_of(m_sinks.begin(), m_sinks.end(), [](const std::unique_ptr<Log_Sink>& sink) { return sink->Needs_Text(); });
+            if (needs_text)
+            {
+                m_message_text.clear();
+                header.format_function(m_message_text, log_message.format, log_message.arguments);
+                log_message.text = m_message_text;
+            }
+        }
+        else
+        {
+            log_message.text = payload;
+        }
+
+        if (m_console_output_mode.load(std::memory_order_relaxed))
+        {
+            if (!m_console_sink)
+            {
+                m_console_sink = std::make_unique<Console_Log_Sink>();
+            }
+            m_console_sink->Write(log_message);
+        }
+
+        // The ds.log sink lives while file output mode is on, turning the mode off closes the file
+        if (m_file_output_mode.load(std::memory_order_relaxed))
+        {
+            if (!m_file_sink)
+            {
+                m_file_sink = std::make_unique<File_Log_Sink>(File_Log_Sink::Config());
+            }
+            m_file_sink->Write(log_message);
+        }
+        else if (m_file_sink)
+        {
+            m_file_sink.reset();
+        }
+
+        for (const std::unique_ptr<Log_Sink>& sink : m_sinks)
+        {
+            sink->Write(log_message);
+        }
+    }
+
+    void Logger::Flush_Sinks()
+    {
+        if (m_console_sink)
+        {
+            m_console_sink->Flush();
+        }
+
+        if (m_file_sink)
+        {
+            m_file_sink->Flush();
+        }
+
+        for (const std::unique_ptr<Log_Sink>& sink : m_sinks)
+        {
+            sink->Flush();
+        }
+    }
+
+    const char* Logger::Get_Level_Name(Log_Level level)
+    {
+        switch (level)
+        {
+        case Log_Level::TRACE:
+            return "[TRACE]";
+        case Log_Level::INFO:
+            return "[INFO]";
+        case Log_Level::WARN:
+            return "[WARN]";
+        case Log_Level::ERR:
+            return "[ERR]";
+        case Log_Level::FATAL:
+            return "[FATAL]";
+        default:
+            return "[NONE]";
+        }
+    }
+
+    void Logger::Set_Level(Log_Level level)
+    {
+        for (std::atomic<ds_u8>& channel_level : s_channel_levels)
+        {
+            channel_level.store(static_cast<ds_u8>(level), std::memory_order_relaxed);
         }
+    }
 
-        if (log_file.is_open())
+    const char* Logger::Get_Channel_Name(Log_Channel channel)
+    {
+        switch (channel)
         {
-            log_file.close();
+        case Log_Channel::GENERAL:
+            return "general";
+        case Log_Channel::MEMORY:
+            return "memory";
+        case Log_Channel::STREAMING:
+            return "streaming";
+        case Log_Channel::ALGORITHMS:
+            return "algorithms";
+        case Log_Channel::PHYSICS:
+            return "physics";
+        case Log_Channel::RENDERER:
+            return "renderer";
+        case Log_Channel::AUDIO:
+            return "audio";
+        case Log_Channel::GAMEPLAY:
+            return "gameplay";
+        case Log_Channel::PROFILER:
+            return "profiler";
+        default:
+            return "unknown";
         }
     }
 
+    Log_Channel Logger::Find_Channel(std::string_view name)
+    {
+        for (ds_u8 i = 0; i < static_cast<ds_u8>(Log_Channel::COUNT); i++)
+        {
+            Log_Channel channel = static_cast<Log_Channel>(i);
+            if (name == Get_Channel_Name(channel))
+            {
+                return channel;
+            }
+        }
+
+        return Log_Channel::COUNT;
+    }
+
     void Logger::Apply_Theme(Logger_Theme theme)
     {
+        std::unique_lock<std::mutex> lock(Get_Instance().m_output_mutex);
         switch (theme)
         {
         case Logger_Theme::DEFAULT:
@@ -242,6 +862,7 @@ namespace ds::core
         }
 
         s_current_theme_enum = theme;
+        lock.unlock();
 
         // Log the theme change using string concatenation
         std::string theme_name;
@@ -262,8 +883,11 @@ namespace ds::core
 
     void Logger::Apply_Theme_Struct(const Theme_Struct& theme_struct)
     {
-        s_current_theme = theme_struct;
-        s_current_theme_enum = Logger_Theme::CUSTOM;
+        {
+            std::lock_guard<std::mutex> lock(Get_Instance().m_output_mutex);
+            s_current_theme = theme_struct;
+            s_current_theme_enum = Logger_Theme::CUSTOM;
+        }
         Logger::Get_Instance().Log(Log_Level::INFO, "Applied custom theme");
     }
 
@@ -292,4 +916,157 @@ namespace ds::core
     {
         return s_current_theme_enum;
     }
-}
\ No newline at end of file
+
+    const Theme_Struct& Logger::Get_Current_Theme_Struct()
+    {
+        return s_current_theme;
+    }
+
+    /////////////////////////////////////////////////////////
+    // Crash_Log_Reader
+    /////////////////////////////////////////////////////////
+
+    // Helper function to read a crash log record, false for empty slots and slots that aren't records
+    static bool Read_Crash_Record(const char* ring, ds_u64 slot, Log_Record& record)
+    {
+        std::memcpy(&record, ring + slot * sizeof(Log_Record), sizeof(Log_Record));
+        return record.time.timestamp != 0 && record.length <= LOG_RECORD_TEXT_CAPACITY &&
+            record.level < static_cast<ds_u8>(Log_Level::NONE) && record.channel < static_cast<ds_u8>(Log_Channel::COUNT);
+    }
+
+    bool Crash_Log_Reader::Open(const std::string& path)
+    {
+        m_messages.clear();
+        m_next = 0;
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            return false;
+        }
+        std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        Crash_Log_Header header;
+        if (data.size() < sizeof(header))
+        {
+            return false;
+        }
+        std::memcpy(&header, data.data(), sizeof(header));
+
+        ds_u64 ring_size = static_cast<ds_u64>(header.ring_capacity) * sizeof(Log_Record);
+        if (std::memcmp(header.magic, CRASH_LOG_MAGIC, sizeof(header.magic)) != 0 || header.record_size != sizeof(Log_Record) ||
+            header.ring_capacity == 0 || header.header_size + header.ring_count * ring_size > data.size())
+        {
+            return false;
+        }
+
+        Log_Record record;
+        Log_Record piece;
+        std::string payload;
+        for (ds_u32 ring_index = 0; ring_index < header.ring_count; ring_index++)
+        {
+            const char* ring = data.data() + header.header_size + ring_index * ring_size;
+            ds_u64 capacity = header.ring_capacity;
+
+            // Every message ends in a record without LOG_RECORD_CONTINUES, walk back from there to its first record
+            for (ds_u64 last = 0; last < capacity; last++)
+            {
+                if (!Read_Crash_Record(ring, last, record) || (record.flags & LOG_RECORD_CONTINUES))
+                {
+                    continue;
+                }
+
+                ds_u64 first = last;
+                bool complete = true;
+                piece = record;
+                while (piece.flags & LOG_RECORD_CONTINUATION)
+                {
+                    first = (first + capacity - 1) % capacity;
+                    if (first == last || !Read_Crash_Record(ring, first, piece) || !(piece.flags & LOG_RECORD_CONTINUES) ||
+                        piece.time.timestamp != record.time.timestamp || piece.time.monotonic_microseconds != record.time.monotonic_microseconds)
+                    {
+                        complete = false;
+                        break;
+                    }
+                }
+
+                if (!complete)
+                {
+                    continue;
+                }
+
+                payload.clear();
+                for (ds_u64 slot = first; ; slot = (slot + 1) % capacity)
+                {
+                    Read_Crash_Record(ring, slot, piece);
+                    payload.append(piece.text, piece.length);
+                    if (slot == last)
+                    {
+                        break;
+                    }
+                }
+
+                Crash_Message message;
+                message.time = record.time;
+                message.level = static_cast<Log_Level>(record.level);
+                message.channel = static_cast<Log_Channel>(record.channel);
+
+                if (!(record.flags & LOG_RECORD_DEFERRED))
+                {
+                    message.text = payload;
+                }
+                else
+                {
+                    // Without its format string a deferred message can't be read outside the process that logged it
+                    Logger::Deferred_Header deferred;
+                    if (!(record.flags & LOG_RECORD_FORMAT_EMBEDDED) || payload.size() < sizeof(deferred))
+                    {
+                        continue;
+                    }
+
+                    std::memcpy(&deferred, payload.data(), sizeof(deferred));
+                    if (payload.size() - sizeof(deferred) < deferred.format_length)
+                    {
+                        continue;
+                    }
+
+                    std::string_view format(payload.data() + sizeof(deferred), deferred.format_length);
+                    ds_u64 arguments_offset = sizeof(deferred) + deferred.format_length;
+                    if (!Format_Tagged_Log_Arguments(message.text, format,
+                        reinterpret_cast<const ds_u8*>(payload.data()) + arguments_offset, payload.size() - arguments_offset))
+                    {
+                        message.text.assign(format);
+                    }
+                }
+
+                m_messages.push_back(std::move(message));
+            }
+        }
+
+        std::stable_sort(m_messages.begin(), m_messages.end(),
+            [](const Crash_Message& a, const Crash_Message& b)
+            {
+                // Wall clock nanoseconds order messages logged within the same microsecond
+                if (a.time.monotonic_microseconds != b.time.monotonic_microseconds)
+                    return a.time.monotonic_microseconds < b.time.monotonic_microseconds;
+                return a.time.timestamp < b.time.timestamp;
+            });
+        return true;
+    }
+
+    bool Crash_Log_Reader::Next(Log_Message& message)
+    {
+        if (m_next >= m_messages.size())
+        {
+            return false;
+        }
+
+        const Crash_Message& crash_message = m_messages[m_next++];
+        message = Log_Message();
+        message.time = crash_message.time;
+        message.level = crash_message.level;
+        message.channel = crash_message.channel;
+        message.text = crash_message.text;
+        return true;
+    }
+}
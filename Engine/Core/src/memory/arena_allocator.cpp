@@ -49,7 +49,7 @@ namespace ds::core::memory
 
         // In debug mode, fill memory with a pattern to help identify uninitialized memory
         Memory::Memset(m_memory_block, 0xCD, size_bytes); // 0xCD = "Clean Dynamic memory"
-        DS_LOG_INFO("Arena allocator '{0}' created with {1} bytes", m_name, size_bytes);
+        DS_LOG_CHANNEL_INFO(MEMORY, "Arena allocator '{0}' created with {1} bytes", m_name, size_bytes);
 #endif
     }
 
@@ -62,7 +62,7 @@ namespace ds::core::memory
             // Check for memory leaks before freeing
             if (m_allocation_count > 0)
             {
-                DS_LOG_WARN("Arena '{0}' destroyed with {1} active allocations ({2} bytes)",
+                DS_LOG_CHANNEL_WARN(MEMORY, "Arena '{0}' destroyed with {1} active allocations ({2} bytes)",
                     m_name, m_allocation_count, Get_Used_Size());
             }
 
@@ -155,7 +155,7 @@ namespace ds::core::memory
         // Handle zero-size allocation
         if (size == 0)
         {
-            DS_LOG_WARN("Arena '{0}': Attempted to allocate 0 bytes", m_name);
+            DS_LOG_CHANNEL_WARN(MEMORY, "Arena '{0}': Attempted to allocate 0 bytes", m_name);
             return nullptr;
         }
 
@@ -178,7 +178,7 @@ namespace ds::core::memory
         {
             // Out of memory
 #ifdef DS_DEBUG
-            DS_LOG_ERROR("Arena '{0}' allocation failed: requested {1} bytes with {2} alignment, "
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Arena '{0}' allocation failed: requested {1} bytes with {2} alignment, "
                 "but only {3} bytes available",
                 m_name, size, alignment, static_cast<ds_u64>(m_end_pos - m_current_pos));
 #endif
@@ -194,6 +194,43 @@ namespace ds::core::memory
         return result;
     }
 
+    bool Arena_Allocator::Try_Expand(void* ptr, ds_u64 old_size, ds_u64 new_size)
+    {
+        ds_char* block = static_cast<ds_char*>(ptr);
+
+        // Only the allocation that ends at the current position has room behind it
+        if (!block || block + old_size != m_current_pos)
+        {
+            return false;
+        }
+
+        if (new_size <= old_size)
+        {
+            return true;
+        }
+
+        if (block + new_size > m_end_pos)
+        {
+            return false;
+        }
+
+        m_current_pos = block + new_size;
+
+#ifdef DS_DEBUG
+        // Keep the tracked size in sync so Reset clears the whole block
+        for (ds_u64 i = m_debug_allocation_count; i > 0; --i)
+        {
+            if (m_debug_allocations[i - 1].ptr == ptr)
+            {
+                m_debug_allocations[i - 1].size = new_size;
+                break;
+            }
+        }
+#endif
+
+        return true;
+    }
+
     void Arena_Allocator::Reset()
     {
 #ifdef DS_DEBUG
@@ -216,7 +253,7 @@ namespace ds::core::memory
 
         // Fill memory with pattern to help identify use-after-free
         Memory::Memset(m_memory_block, 0xCD, m_size);
-        DS_LOG_INFO("Arena '{0}' reset: freed {1} allocations, {2} bytes",
+        DS_LOG_CHANNEL_INFO(MEMORY, "Arena '{0}' reset: freed {1} allocations, {2} bytes",
             m_name, m_allocation_count, Get_Used_Size());
 #endif
 
@@ -243,7 +280,7 @@ namespace ds::core::memory
         }
         else if (ptr && m_debug_allocation_count >= MAX_DEBUG_ALLOCATIONS)
         {
-            DS_LOG_WARN("Arena '{0}': Debug allocation tracking limit reached ({1})",
+            DS_LOG_CHANNEL_WARN(MEMORY, "Arena '{0}': Debug allocation tracking limit reached ({1})",
                 m_name, MAX_DEBUG_ALLOCATIONS);
         }
 
@@ -289,7 +326,7 @@ namespace ds::core::memory
         }
 
         ss << "==============================================";
-        DS_LOG_INFO("{}", ss.str());
+        DS_LOG_CHANNEL_INFO(MEMORY, "{}", ss.str());
     }
 #endif
 
@@ -41,7 +41,7 @@ namespace ds::core::memory
         // Ensure size is at least large enough for one block
         if (size_bytes < sizeof(Block_Header) + MIN_BLOCK_SIZE)
         {
-            DS_LOG_ERROR("Free List Allocator '{0}': size too small ({1} bytes), minimum is {2} bytes",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': size too small ({1} bytes), minimum is {2} bytes",
                 m_name, size_bytes, sizeof(Block_Header) + MIN_BLOCK_SIZE);
 
             // Adjust size to minimum
@@ -78,7 +78,7 @@ namespace ds::core::memory
         Memory::Memset(reinterpret_cast<ds_u8*>(m_memory_region) + sizeof(Block_Header),
             0xCD, user_size); // 0xCD = "Clean Dynamic memory"
 
-        DS_LOG_INFO("Free List Allocator '{0}' created with {1} bytes", m_name, m_size);
+        DS_LOG_CHANNEL_INFO(MEMORY, "Free List Allocator '{0}' created with {1} bytes", m_name, m_size);
 #endif
     }
 
@@ -91,7 +91,7 @@ namespace ds::core::memory
             // Check for memory leaks before freeing
             if (m_allocation_count > 0)
             {
-                DS_LOG_WARN("Free List Allocator '{0}' destroyed with {1} active allocations ({2} bytes)",
+                DS_LOG_CHANNEL_WARN(MEMORY, "Free List Allocator '{0}' destroyed with {1} active allocations ({2} bytes)",
                     m_name, m_allocation_count, Get_Used_Size());
 
                 // List all active allocations
@@ -100,7 +100,7 @@ namespace ds::core::memory
                 {
                     if (!current->is_free)
                     {
-                        DS_LOG_WARN("  Leaked allocation: {0} bytes at {1} ({2}:{3})",
+                        DS_LOG_CHANNEL_WARN(MEMORY, "  Leaked allocation: {0} bytes at {1} ({2}:{3})",
                             current->size - sizeof(Block_Header),
                             static_cast<void*>(reinterpret_cast<ds_u8*>(current) + sizeof(Block_Header)),
                             current->file ? current->file : "unknown",
@@ -195,7 +195,7 @@ namespace ds::core::memory
         // Handle zero-size allocation
         if (size == 0)
         {
-            DS_LOG_WARN("Free List Allocator '{0}': Attempted to allocate 0 bytes", m_name);
+            DS_LOG_CHANNEL_WARN(MEMORY, "Free List Allocator '{0}': Attempted to allocate 0 bytes", m_name);
             return nullptr;
         }
 
@@ -222,7 +222,7 @@ namespace ds::core::memory
         if (!block)
         {
             // No suitable block found
-            DS_LOG_ERROR("Free List Allocator '{0}': Failed to allocate {1} bytes (alignment {2})",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Failed to allocate {1} bytes (alignment {2})",
                 m_name, size, alignment);
             Unlock();
             return nullptr;
@@ -294,7 +294,7 @@ namespace ds::core::memory
         Block_Header* block = Get_Block_Header(ptr);
         if (!block || block->is_free)
         {
-            DS_LOG_ERROR("Free List Allocator '{0}': Invalid pointer for deallocation: {1}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Invalid pointer for deallocation: {1}",
                 m_name, ptr);
             Unlock();
             return false;
@@ -304,7 +304,7 @@ namespace ds::core::memory
         // Validate block before deallocation
         if (!Validate_Block(block))
         {
-            DS_LOG_ERROR("Free List Allocator '{0}': Memory corruption detected at {1}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Memory corruption detected at {1}",
                 m_name, ptr);
             Unlock();
             return false;
@@ -338,6 +338,72 @@ namespace ds::core::memory
         return true;
     }
 
+    bool Free_List_Allocator::Try_Expand(void* ptr, ds_u64 new_size)
+    {
+        if (!ptr)
+        {
+            return false;
+        }
+
+        Lock();
+
+        Block_Header* block = Get_Block_Header(ptr);
+        if (!block || block->is_free)
+        {
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Invalid pointer for expansion: {1}",
+                m_name, ptr);
+            Unlock();
+            return false;
+        }
+
+        // Bytes from the user pointer to the end of the block, alignment padding excluded
+        ds_u8* user_ptr = static_cast<ds_u8*>(ptr);
+        ds_u64 offset = static_cast<ds_u64>(user_ptr - reinterpret_cast<ds_u8*>(block));
+        ds_u64 required_size = offset + new_size;
+
+        // The block may already have slack left over from an unsplit allocation
+        if (block->size >= required_size)
+        {
+            Unlock();
+            return true;
+        }
+
+        Block_Header* next_block = block->next;
+        if (!next_block || !next_block->is_free || block->size + next_block->size < required_size)
+        {
+            Unlock();
+            return false;
+        }
+
+        // Absorb the following free block
+        Remove_From_Free_List(next_block);
+        block->size += next_block->size;
+        block->next = next_block->next;
+        if (next_block->next)
+        {
+            next_block->next->prev = block;
+        }
+
+        if (m_last_allocated == next_block)
+        {
+            m_last_allocated = block;
+        }
+
+        // Give back what we don't need if it is big enough to be a block on its own
+        ds_u64 split_size = Memory::Align_Size(required_size, alignof(Block_Header));
+        if (block->size >= split_size + sizeof(Block_Header) + MIN_BLOCK_SIZE)
+        {
+            Block_Header* remainder_block = Split_Block(block, split_size);
+            Add_To_Free_List(remainder_block);
+
+            // Split_Block already counted the remainder as a free block
+            m_free_block_count--;
+        }
+
+        Unlock();
+        return true;
+    }
+
     void Free_List_Allocator::Set_Strategy(Allocation_Strategy strategy)
     {
         Lock();
@@ -371,7 +437,7 @@ namespace ds::core::memory
         Memory::Memset(reinterpret_cast<ds_u8*>(m_memory_region) + sizeof(Block_Header),
             0xCD, user_size); // 0xCD = "Clean Dynamic memory"
 
-        DS_LOG_INFO("Free List Allocator '{0}' reset", m_name);
+        DS_LOG_CHANNEL_INFO(MEMORY, "Free List Allocator '{0}' reset", m_name);
 #endif
 
         Unlock();
@@ -415,7 +481,7 @@ namespace ds::core::memory
 
         if (coalesced_count > 0)
         {
-            DS_LOG_INFO("Free List Allocator '{0}': Defragmented {1} blocks",
+            DS_LOG_CHANNEL_INFO(MEMORY, "Free List Allocator '{0}': Defragmented {1} blocks",
                 m_name, coalesced_count);
         }
 
@@ -485,7 +551,7 @@ namespace ds::core::memory
             return Find_Next_Fit(size, alignment);
 
         default:
-            DS_LOG_ERROR("Free List Allocator '{0}': Unknown allocation strategy", m_name);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Unknown allocation strategy", m_name);
             return Find_First_Fit(size, alignment);
         }
     }
@@ -763,7 +829,7 @@ namespace ds::core::memory
             Add_To_Free_List(block);
 
 #ifdef DS_DEBUG
-            DS_LOG_TRACE("Free List Allocator '{0}': Coalesced block with next block", m_name);
+            DS_LOG_CHANNEL_TRACE(MEMORY, "Free List Allocator '{0}': Coalesced block with next block", m_name);
 #endif
         }
 
@@ -792,7 +858,7 @@ namespace ds::core::memory
             block = prev_block;
 
 #ifdef DS_DEBUG
-            DS_LOG_TRACE("Free List Allocator '{0}': Coalesced block with previous block", m_name);
+            DS_LOG_CHANNEL_TRACE(MEMORY, "Free List Allocator '{0}': Coalesced block with previous block", m_name);
 #endif
         }
 
@@ -877,7 +943,7 @@ namespace ds::core::memory
         // Check guard pattern
         if (block->guard_value != Block_Header::GUARD_PATTERN)
         {
-            DS_LOG_ERROR("Free List Allocator '{0}': Memory corruption detected in block header", m_name);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Memory corruption detected in block header", m_name);
             return false;
         }
 
@@ -889,14 +955,14 @@ namespace ds::core::memory
 
         if (block_start < memory_start || block_end > memory_end)
         {
-            DS_LOG_ERROR("Free List Allocator '{0}': Block is outside memory region", m_name);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Block is outside memory region", m_name);
             return false;
         }
 
         // Validate block size
         if (block->size < sizeof(Block_Header) || block->size > m_size)
         {
-            DS_LOG_ERROR("Free List Allocator '{0}': Invalid block size: {1}", m_name, block->size);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Invalid block size: {1}", m_name, block->size);
             return false;
         }
 
@@ -908,14 +974,14 @@ namespace ds::core::memory
             // Next block should be after this block
             if (next_block_start != block_start + block->size)
             {
-                DS_LOG_ERROR("Free List Allocator '{0}': Block links are corrupted", m_name);
+                DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Block links are corrupted", m_name);
                 return false;
             }
 
             // Next block should have correct prev pointer
             if (block->next->prev != block)
             {
-                DS_LOG_ERROR("Free List Allocator '{0}': Block links are corrupted", m_name);
+                DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Block links are corrupted", m_name);
                 return false;
             }
         }
@@ -928,7 +994,7 @@ namespace ds::core::memory
             // This block should be after prev block
             if (block_start != prev_block_end)
             {
-                DS_LOG_ERROR("Free List Allocator '{0}': Block links are corrupted", m_name);
+                DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Block links are corrupted", m_name);
                 return false;
             }
         }
@@ -947,7 +1013,7 @@ namespace ds::core::memory
             // Each block in the free list should be marked as free
             if (!current->is_free)
             {
-                DS_LOG_ERROR("Free List Allocator '{0}': Block in free list is not marked as free", m_name);
+                DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Block in free list is not marked as free", m_name);
                 return false;
             }
 
@@ -960,7 +1026,7 @@ namespace ds::core::memory
             // Check next_free link
             if (current->next_free && current->next_free->prev_free != current)
             {
-                DS_LOG_ERROR("Free List Allocator '{0}': Free list links are corrupted", m_name);
+                DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Free list links are corrupted", m_name);
                 return false;
             }
 
@@ -970,7 +1036,7 @@ namespace ds::core::memory
             // Detect cycles
             if (count > m_free_block_count)
             {
-                DS_LOG_ERROR("Free List Allocator '{0}': Cycle detected in free list", m_name);
+                DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Cycle detected in free list", m_name);
                 return false;
             }
         }
@@ -978,7 +1044,7 @@ namespace ds::core::memory
         // Check if counted blocks match tracked count
         if (count != m_free_block_count)
         {
-            DS_LOG_ERROR("Free List Allocator '{0}': Free block count mismatch: counted {1}, tracked {2}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Free List Allocator '{0}': Free block count mismatch: counted {1}, tracked {2}",
                 m_name, count, m_free_block_count);
             return false;
         }
@@ -1082,7 +1148,7 @@ namespace ds::core::memory
         }
 
         ss << "==============================================";
-        DS_LOG_INFO("{}", ss.str());
+        DS_LOG_CHANNEL_INFO(MEMORY, "{}", ss.str());
 
         Unlock();
     }
@@ -1135,7 +1201,7 @@ namespace ds::core::memory
         ss << "]" << std::endl;
         ss << "Legend: # = Allocated, . = Free" << std::endl;
 
-        DS_LOG_INFO("{}", ss.str());
+        DS_LOG_CHANNEL_INFO(MEMORY, "{}", ss.str());
 
         Unlock();
     }
@@ -1,5 +1,6 @@
 #include <core/ds_pch.h>
 #include <core/memory/memory.h>
+#include <core/profiler/profiler.h>
 
 namespace ds::core::memory
 {
@@ -86,7 +87,7 @@ namespace ds::core::memory
 				Block* new_block = static_cast<Block*>(std::malloc(sizeof(Block)));
 				if (!new_block)
 				{
-					DS_LOG_ERROR("Thread-local allocator ran out of memory!");
+					DS_LOG_CHANNEL_ERROR(MEMORY, "Thread-local allocator ran out of memory!");
 					return nullptr;
 				}
 
@@ -103,7 +104,7 @@ namespace ds::core::memory
 				return reinterpret_cast<void*>(aligned);
 			}
 
-			DS_LOG_ERROR("Could not allocate from thread-local storage!");
+			DS_LOG_CHANNEL_ERROR(MEMORY, "Could not allocate from thread-local storage!");
 			return nullptr;
 		}
 
@@ -206,7 +207,7 @@ namespace ds::core::memory
 		if ((alignment & (alignment - 1)) != 0)
 		{
 			// Round up to the next power of 2
-			DS_LOG_WARN("Alignment is not a power of 2! Rounding up...");
+			DS_LOG_CHANNEL_WARN(MEMORY, "Alignment is not a power of 2! Rounding up...");
 			alignment--;
 			alignment |= alignment >> 1;
 			alignment |= alignment >> 2;
@@ -226,6 +227,7 @@ namespace ds::core::memory
 			{
 				// Update global statistics atomically
 				s_allocation_count.fetch_add(1, std::memory_order_relaxed);
+				DS_PROFILE_ALLOCATION("Memory", ptr, size);
 				return ptr;
 			}
 		}
@@ -280,6 +282,7 @@ namespace ds::core::memory
 		s_total_allocated.fetch_add(size, std::memory_order_relaxed);
 		s_allocation_count.fetch_add(1, std::memory_order_relaxed);
 
+		DS_PROFILE_ALLOCATION("Memory", user_data, size);
 		return user_data;
 #else
 		// In release mode, use aligned_alloc
@@ -287,6 +290,7 @@ namespace ds::core::memory
 		if (ptr) {
 			s_total_allocated.fetch_add(size, std::memory_order_relaxed);
 			s_allocation_count.fetch_add(1, std::memory_order_relaxed);
+			DS_PROFILE_ALLOCATION("Memory", ptr, size);
 		}
 		return ptr;
 #endif
@@ -299,6 +303,8 @@ namespace ds::core::memory
 			return;
 		}
 
+		DS_PROFILE_FREE("Memory", ptr);
+
 		// Try thread-local free first
 		if (Thread_Local_Free(ptr))
 		{
@@ -320,7 +326,7 @@ namespace ds::core::memory
 
 		// Validate the header
 		if (header->guard_value != Allocation_Header::GUARD_PATTERN) {
-			DS_LOG_ERROR("Memory corruption detected in header while freeing {0}!", ptr);
+			DS_LOG_CHANNEL_ERROR(MEMORY, "Memory corruption detected in header while freeing {0}!", ptr);
 			// Still attempt to free to avoid leaks
 		}
 
@@ -329,7 +335,7 @@ namespace ds::core::memory
 			reinterpret_cast<ds_char*>(ptr) + header->size
 			);
 		if (*footer != FOOTER_GUARD_PATTERN) {
-			DS_LOG_ERROR("Memory corruption detected in footer while freeing {0}!", ptr);
+			DS_LOG_CHANNEL_ERROR(MEMORY, "Memory corruption detected in footer while freeing {0}!", ptr);
 		}
 
 		// Clear memory to catch use-after-free
@@ -374,7 +380,7 @@ namespace ds::core::memory
 			void* new_ptr = Malloc(new_size, alignment);
 			if (!new_ptr)
 			{
-				DS_LOG_ERROR("Failed to reallocate memory!");
+				DS_LOG_CHANNEL_ERROR(MEMORY, "Failed to reallocate memory!");
 				return nullptr;
 			}
 
@@ -392,7 +398,7 @@ namespace ds::core::memory
 		void* new_ptr = Malloc(new_size, alignment);
 		if (!new_ptr)
 		{
-			DS_LOG_ERROR("Failed to reallocate memory!");
+			DS_LOG_CHANNEL_ERROR(MEMORY, "Failed to reallocate memory!");
 			return nullptr;
 		}
 
@@ -462,7 +468,7 @@ namespace ds::core::memory
 		// Validate the header first
 		if (!header || !Validate_Header(header))
 		{
-			DS_LOG_ERROR("Memory corruption detected while getting the size of the memory at {0}!", ptr);
+			DS_LOG_CHANNEL_ERROR(MEMORY, "Memory corruption detected while getting the size of the memory at {0}!", ptr);
 			return 0;
 		}
 
@@ -522,7 +528,7 @@ namespace ds::core::memory
 			ss << "  Active Allocations: " << s_thread_local_allocator->allocations << std::endl;
 		}
 		ss << "=================================" << std::endl;
-		DS_LOG_INFO("{}", ss.str());
+		DS_LOG_CHANNEL_INFO(MEMORY, "{}", ss.str());
 	}
 
 	void Memory::Check_Memory_Leaks()
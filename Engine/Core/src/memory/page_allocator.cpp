@@ -54,18 +54,18 @@ namespace ds::core::memory
             m_reserved_address_space = Reserve_Address_Space(m_reserved_address_space_size, m_page_size);
             if (!m_reserved_address_space)
             {
-                DS_LOG_ERROR("Page Allocator '{0}': Failed to reserve {1} bytes of address space",
+                DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to reserve {1} bytes of address space",
                     m_name, m_reserved_address_space_size);
                 m_reserved_address_space_size = 0;
             }
             else
             {
-                DS_LOG_INFO("Page Allocator '{0}': Reserved {1} MB of address space at {2}",
+                DS_LOG_CHANNEL_INFO(MEMORY, "Page Allocator '{0}': Reserved {1} MB of address space at {2}",
                     m_name, m_reserved_address_space_size / (1024 * 1024), m_reserved_address_space);
             }
         }
 
-        DS_LOG_INFO("Page Allocator '{0}' created with page size {1} KB",
+        DS_LOG_CHANNEL_INFO(MEMORY, "Page Allocator '{0}' created with page size {1} KB",
             m_name, m_page_size / 1024);
     }
 
@@ -104,7 +104,7 @@ namespace ds::core::memory
             m_reserved_address_space_used = 0;
         }
 
-        DS_LOG_INFO("Page Allocator '{0}' destroyed", m_name);
+        DS_LOG_CHANNEL_INFO(MEMORY, "Page Allocator '{0}' destroyed", m_name);
     }
 
     Page_Allocator::Page_Allocator(Page_Allocator&& other) noexcept
@@ -221,7 +221,7 @@ namespace ds::core::memory
         // Nothing special needed for Unix-like systems
         return true;
 #else
-        DS_LOG_ERROR("Page Allocator: Platform not supported");
+        DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator: Platform not supported");
         return false;
 #endif
     }
@@ -269,7 +269,7 @@ namespace ds::core::memory
             FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
         if (file_handle == INVALID_HANDLE_VALUE)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Failed to open file {1}", m_name, file_path);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to open file {1}", m_name, file_path);
             return nullptr;
         }
 
@@ -291,7 +291,7 @@ namespace ds::core::memory
         LARGE_INTEGER file_size;
         if (!GetFileSizeEx(file_handle, &file_size))
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Failed to get file size for {1}", m_name, file_path);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to get file size for {1}", m_name, file_path);
             CloseHandle(file_handle);
             return nullptr;
         }
@@ -300,7 +300,7 @@ namespace ds::core::memory
         ds_u64 actual_file_size = static_cast<ds_u64>(file_size.QuadPart);
         if (size > actual_file_size)
         {
-            DS_LOG_WARN("Page Allocator '{0}': Requested size {1} KB exceeds file size {2} KB for {3}",
+            DS_LOG_CHANNEL_WARN(MEMORY, "Page Allocator '{0}': Requested size {1} KB exceeds file size {2} KB for {3}",
                 m_name, size / 1024, actual_file_size / 1024, file_path);
             size = actual_file_size;  // Update the reference parameter
         }
@@ -314,7 +314,7 @@ namespace ds::core::memory
         if (!mapping_handle)
         {
             CloseHandle(file_handle);
-            DS_LOG_ERROR("Page Allocator '{0}': Failed to create file mapping for {1}", m_name, file_path);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to create file mapping for {1}", m_name, file_path);
             return nullptr;
         }
 
@@ -347,7 +347,7 @@ namespace ds::core::memory
 
         if (!mapped_address)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Failed to map file {1} into memory", m_name, file_path);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to map file {1} into memory", m_name, file_path);
             return nullptr;
         }
 
@@ -357,7 +357,7 @@ namespace ds::core::memory
         int fd = open(file_path, O_RDWR);
         if (fd == -1)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Failed to open file {1}", m_name, file_path);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to open file {1}", m_name, file_path);
             return nullptr;
         }
 
@@ -365,7 +365,7 @@ namespace ds::core::memory
         struct stat file_stat;
         if (fstat(fd, &file_stat) == -1)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Failed to get file size for {1}", m_name, file_path);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to get file size for {1}", m_name, file_path);
             close(fd);
             return nullptr;
         }
@@ -374,7 +374,7 @@ namespace ds::core::memory
         ds_u64 actual_file_size = static_cast<ds_u64>(file_stat.st_size);
         if (size > actual_file_size)
         {
-            DS_LOG_WARN("Page Allocator '{0}': Requested size {1} KB exceeds file size {2} KB for {3}",
+            DS_LOG_CHANNEL_WARN(MEMORY, "Page Allocator '{0}': Requested size {1} KB exceeds file size {2} KB for {3}",
                 m_name, size / 1024, actual_file_size / 1024, file_path);
             size = actual_file_size;  // Update the reference parameter
         }
@@ -405,7 +405,7 @@ namespace ds::core::memory
 
         if (mapped_address == MAP_FAILED)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Failed to map file {1} into memory", m_name, file_path);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to map file {1} into memory", m_name, file_path);
             return nullptr;
         }
 
@@ -454,7 +454,7 @@ namespace ds::core::memory
         // Validate allocation size
         if (size == 0)
         {
-            DS_LOG_WARN("Page Allocator '{0}': Attempted to allocate 0 bytes", m_name);
+            DS_LOG_CHANNEL_WARN(MEMORY, "Page Allocator '{0}': Attempted to allocate 0 bytes", m_name);
             Unlock();
             return nullptr;
         }
@@ -466,7 +466,7 @@ namespace ds::core::memory
         // Check if we have room to track this allocation
         if (m_page_info_count >= MAX_PAGE_ALLOCATIONS)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Maximum number of page allocations ({1}) reached",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Maximum number of page allocations ({1}) reached",
                 m_name, MAX_PAGE_ALLOCATIONS);
             Unlock();
             return nullptr;
@@ -562,7 +562,7 @@ namespace ds::core::memory
 
         if (!allocation)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Failed to allocate {1} bytes ({2} pages)",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to allocate {1} bytes ({2} pages)",
                 m_name, aligned_size, page_count);
             Unlock();
             return nullptr;
@@ -581,12 +581,12 @@ namespace ds::core::memory
             DWORD old_protect;
             if (!VirtualProtect(allocation, aligned_size, Convert_Protection_Flags(protection), &old_protect))
             {
-                DS_LOG_ERROR("Page Allocator '{0}': Failed to change protection after initialization", m_name);
+                DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to change protection after initialization", m_name);
             }
 #else
             if (mprotect(allocation, aligned_size, Convert_Protection_Flags(protection)) != 0)
             {
-                DS_LOG_ERROR("Page Allocator '{0}': Failed to change protection after initialization", m_name);
+                DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to change protection after initialization", m_name);
             }
 #endif
         }
@@ -625,7 +625,7 @@ namespace ds::core::memory
         // Update stats
         m_allocated_page_count += page_count;
 
-        DS_LOG_TRACE("Page Allocator '{0}': Allocated {1} bytes ({2} pages) at {3}",
+        DS_LOG_CHANNEL_TRACE(MEMORY, "Page Allocator '{0}': Allocated {1} bytes ({2} pages) at {3}",
             m_name, aligned_size, page_count, allocation);
 
         Unlock();
@@ -670,7 +670,7 @@ namespace ds::core::memory
                 // Update stats
                 m_allocated_page_count -= info.page_count;
 
-                DS_LOG_TRACE("Page Allocator '{0}': Deallocated {1} bytes ({2} pages) at {3}",
+                DS_LOG_CHANNEL_TRACE(MEMORY, "Page Allocator '{0}': Deallocated {1} bytes ({2} pages) at {3}",
                     m_name, info.size, info.page_count, ptr);
 
                 // Remove this entry by copying the last entry to this position
@@ -688,13 +688,110 @@ namespace ds::core::memory
             }
         }
 
-        DS_LOG_ERROR("Page Allocator '{0}': Attempted to deallocate unknown address {1}",
+        DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Attempted to deallocate unknown address {1}",
             m_name, ptr);
 
         Unlock();
         return false;
     }
 
+    bool Page_Allocator::Try_Expand(void* ptr, ds_u64 new_size)
+    {
+        if (!ptr)
+        {
+            return false;
+        }
+
+        Lock();
+
+        Page_Info* info = nullptr;
+        for (ds_u64 i = 0; i < m_page_info_count; i++)
+        {
+            if (m_page_infos[i].base_address == ptr)
+            {
+                info = &m_page_infos[i];
+                break;
+            }
+        }
+
+        if (!info || info->file_path)
+        {
+            Unlock();
+            return false;
+        }
+
+        ds_u64 aligned_size = Memory::Align_Size(new_size, m_page_size);
+        if (aligned_size <= info->size)
+        {
+            Unlock();
+            return true;
+        }
+
+        // Only the most recent slice of the reserved space has uncommitted pages behind it
+        ds_u8* reserved_base = static_cast<ds_u8*>(m_reserved_address_space);
+        ds_u8* allocation_end = static_cast<ds_u8*>(ptr) + info->size;
+        ds_u64 extra_size = aligned_size - info->size;
+
+        if (!reserved_base ||
+            allocation_end != reserved_base + m_reserved_address_space_used ||
+            m_reserved_address_space_used + extra_size > m_reserved_address_space_size ||
+            Has_Flag(info->flags, Page_Flags::GUARD))
+        {
+            Unlock();
+            return false;
+        }
+
+        // Commit the new pages with the allocation's protection, writable first if they need zeroing
+        Page_Protection initial_protection = info->protection;
+        bool zero = Has_Flag(info->flags, Page_Flags::ZERO);
+        if (zero && initial_protection == Page_Protection::READ_ONLY)
+        {
+            initial_protection = Page_Protection::READ_WRITE;
+        }
+
+#ifdef DS_PLATFORM_WINDOWS
+        bool result = VirtualAlloc(allocation_end, extra_size, MEM_COMMIT, Convert_Protection_Flags(initial_protection)) != nullptr;
+#else
+        bool result = mprotect(allocation_end, extra_size, Convert_Protection_Flags(initial_protection)) == 0;
+#endif
+
+        if (!result)
+        {
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to commit {1} bytes to expand {2}",
+                m_name, extra_size, ptr);
+            Unlock();
+            return false;
+        }
+
+        if (zero)
+        {
+            Memory::Memset(allocation_end, 0, extra_size);
+        }
+
+        if (initial_protection != info->protection)
+        {
+#ifdef DS_PLATFORM_WINDOWS
+            DWORD old_protect;
+            VirtualProtect(allocation_end, extra_size, Convert_Protection_Flags(info->protection), &old_protect);
+#else
+            mprotect(allocation_end, extra_size, Convert_Protection_Flags(info->protection));
+#endif
+        }
+
+        // Update tracking
+        ds_u64 extra_pages = extra_size / m_page_size;
+        info->size = aligned_size;
+        info->page_count += extra_pages;
+        m_allocated_page_count += extra_pages;
+        m_reserved_address_space_used += extra_size;
+
+        DS_LOG_CHANNEL_TRACE(MEMORY, "Page Allocator '{0}': Expanded {1} in place to {2} bytes ({3} pages)",
+            m_name, ptr, info->size, info->page_count);
+
+        Unlock();
+        return true;
+    }
+
     bool Page_Allocator::Protect(void* ptr, Page_Protection protection)
     {
         if (!ptr)
@@ -708,7 +805,7 @@ namespace ds::core::memory
         const Page_Info* info = Get_Page_Info(ptr);
         if (!info)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Attempted to protect unknown address {1}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Attempted to protect unknown address {1}",
                 m_name, ptr);
             Unlock();
             return false;
@@ -724,7 +821,7 @@ namespace ds::core::memory
 
         if (!result)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Failed to change protection for address {1}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to change protection for address {1}",
                 m_name, ptr);
             Unlock();
             return false;
@@ -758,7 +855,7 @@ namespace ds::core::memory
         const Page_Info* info = Get_Page_Info(ptr);
         if (!info)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Attempted to commit unknown address {1}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Attempted to commit unknown address {1}",
                 m_name, ptr);
             Unlock();
             return false;
@@ -767,7 +864,7 @@ namespace ds::core::memory
         // Ensure size is within bounds
         if (size > info->size)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Commit size {1} exceeds allocation size {2}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Commit size {1} exceeds allocation size {2}",
                 m_name, size, info->size);
             Unlock();
             return false;
@@ -783,7 +880,7 @@ namespace ds::core::memory
 
         if (!result)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Failed to commit memory at address {1}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to commit memory at address {1}",
                 m_name, ptr);
             Unlock();
             return false;
@@ -806,7 +903,7 @@ namespace ds::core::memory
         const Page_Info* info = Get_Page_Info(ptr);
         if (!info)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Attempted to decommit unknown address {1}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Attempted to decommit unknown address {1}",
                 m_name, ptr);
             Unlock();
             return false;
@@ -815,7 +912,7 @@ namespace ds::core::memory
         // Ensure size is within bounds
         if (size > info->size)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Decommit size {1} exceeds allocation size {2}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Decommit size {1} exceeds allocation size {2}",
                 m_name, size, info->size);
             Unlock();
             return false;
@@ -831,7 +928,7 @@ namespace ds::core::memory
 
         if (!result)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Failed to decommit memory at address {1}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to decommit memory at address {1}",
                 m_name, ptr);
             Unlock();
             return false;
@@ -854,7 +951,7 @@ namespace ds::core::memory
         const Page_Info* info = Get_Page_Info(ptr);
         if (!info)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Attempted to flush unknown address {1}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Attempted to flush unknown address {1}",
                 m_name, ptr);
             Unlock();
             return false;
@@ -863,7 +960,7 @@ namespace ds::core::memory
         // Ensure this is a memory-mapped file
         if (!info->file_path)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Attempted to flush non-file-mapped memory at {1}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Attempted to flush non-file-mapped memory at {1}",
                 m_name, ptr);
             Unlock();
             return false;
@@ -872,7 +969,7 @@ namespace ds::core::memory
         // Ensure size is within bounds
         if (size > info->size)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Flush size {1} exceeds allocation size {2}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Flush size {1} exceeds allocation size {2}",
                 m_name, size, info->size);
             Unlock();
             return false;
@@ -887,7 +984,7 @@ namespace ds::core::memory
 
         if (!result)
         {
-            DS_LOG_ERROR("Page Allocator '{0}': Failed to flush memory at address {1}",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Page Allocator '{0}': Failed to flush memory at address {1}",
                 m_name, ptr);
             Unlock();
             return false;
@@ -1046,7 +1143,7 @@ namespace ds::core::memory
         }
 
         ss << "==================================================";
-        DS_LOG_INFO("{}", ss.str());
+        DS_LOG_CHANNEL_INFO(MEMORY, "{}", ss.str());
 
         Unlock();
     }
@@ -92,11 +92,11 @@ namespace ds::core::memory
             Memory::Memset(user_data, 0xCD, user_size);
         }
 
-        DS_LOG_INFO("Pool allocator '{0}' created with {1} blocks, {2} bytes each, {3} bytes total (+ {4} bytes debug info)",
+        DS_LOG_CHANNEL_INFO(MEMORY, "Pool allocator '{0}' created with {1} blocks, {2} bytes each, {3} bytes total (+ {4} bytes debug info)",
             m_name, block_count, m_block_size, blocks_size, debug_tracking_aligned_size);
 #else
         // In release builds, just log basic information
-        DS_LOG_INFO("Pool allocator '{0}' created with {1} blocks, {2} bytes each, {3} bytes total",
+        DS_LOG_CHANNEL_INFO(MEMORY, "Pool allocator '{0}' created with {1} blocks, {2} bytes each, {3} bytes total",
             m_name, block_count, m_block_size, total_size);
 #endif
     }
@@ -111,7 +111,7 @@ namespace ds::core::memory
             ds_u64 allocated = Get_Allocated_Block_Count();
             if (allocated > 0)
             {
-                DS_LOG_WARN("Pool '{0}' destroyed with {1} active allocations", m_name, allocated);
+                DS_LOG_CHANNEL_WARN(MEMORY, "Pool '{0}' destroyed with {1} active allocations", m_name, allocated);
             }
 
             // Fill with pattern to catch use-after-free
@@ -212,7 +212,7 @@ namespace ds::core::memory
         // Check if we have free blocks
         if (!m_free_list)
         {
-            DS_LOG_ERROR("Pool '{0}' allocation failed: pool is full ({1} blocks)",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Pool '{0}' allocation failed: pool is full ({1} blocks)",
                 m_name, m_block_count);
             Unlock();
             return nullptr;
@@ -252,7 +252,7 @@ namespace ds::core::memory
         // Validate the pointer belongs to our pool
         if (!Is_Address_In_Pool(ptr))
         {
-            DS_LOG_ERROR("Pool '{0}' deallocation failed: pointer {1} not from this pool",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Pool '{0}' deallocation failed: pointer {1} not from this pool",
                 m_name, ptr);
             Unlock();
             return false;
@@ -261,7 +261,7 @@ namespace ds::core::memory
         // Check if address is at a valid block boundary
         if ((reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(m_memory_pool)) % m_padded_block_size != 0)
         {
-            DS_LOG_ERROR("Pool '{0}' deallocation failed: pointer {1} not aligned to block boundary",
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Pool '{0}' deallocation failed: pointer {1} not aligned to block boundary",
                 m_name, ptr);
             Unlock();
             return false;
@@ -274,7 +274,7 @@ namespace ds::core::memory
         {
             if (!m_debug_blocks[block_index].allocated)
             {
-                DS_LOG_ERROR("Pool '{0}' double-free detected at {1}", m_name, ptr);
+                DS_LOG_CHANNEL_ERROR(MEMORY, "Pool '{0}' double-free detected at {1}", m_name, ptr);
                 Unlock();
                 return false;
             }
@@ -333,7 +333,7 @@ namespace ds::core::memory
         ds_u64 total_size = m_padded_block_size * m_block_count;
         Memory::Memset(m_memory_pool, 0xCD, total_size);
 
-        DS_LOG_INFO("Pool '{0}' reset: all {1} blocks now available", m_name, m_block_count);
+        DS_LOG_CHANNEL_INFO(MEMORY, "Pool '{0}' reset: all {1} blocks now available", m_name, m_block_count);
 #endif
 
         Unlock();
@@ -448,7 +448,7 @@ namespace ds::core::memory
         }
 
         ss << "==============================================";
-        DS_LOG_INFO("{}", ss.str());
+        DS_LOG_CHANNEL_INFO(MEMORY, "{}", ss.str());
 
         Unlock();
     }
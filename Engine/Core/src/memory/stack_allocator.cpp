@@ -61,11 +61,11 @@ namespace ds::core::memory
         // Fill memory with pattern to help identify uninitialized memory
         Memory::Memset(m_memory_block, 0xCD, size_bytes); // 0xCD = "Clean Dynamic memory"
 
-        DS_LOG_INFO("Stack allocator '{0}' created with {1} bytes (+ {2} bytes debug info)",
+        DS_LOG_CHANNEL_INFO(MEMORY, "Stack allocator '{0}' created with {1} bytes (+ {2} bytes debug info)",
             m_name, size_bytes, debug_tracking_aligned_size);
 #else
         // In release builds, just log basic information
-        DS_LOG_INFO("Stack allocator '{0}' created with {1} bytes",
+        DS_LOG_CHANNEL_INFO(MEMORY, "Stack allocator '{0}' created with {1} bytes",
             m_name, total_size);
 #endif
     }
@@ -78,7 +78,7 @@ namespace ds::core::memory
             // Check for leaks before freeing
             if (m_current_pos > m_start_pos)
             {
-                DS_LOG_WARN("Stack '{0}' destroyed with {1} bytes still allocated",
+                DS_LOG_CHANNEL_WARN(MEMORY, "Stack '{0}' destroyed with {1} bytes still allocated",
                     m_name, m_current_pos - m_start_pos);
             }
 
@@ -195,7 +195,7 @@ namespace ds::core::memory
         if (size == 0)
         {
 #ifdef DS_DEBUG
-            DS_LOG_WARN("Stack '{0}': Attempted to allocate 0 bytes", m_name);
+            DS_LOG_CHANNEL_WARN(MEMORY, "Stack '{0}': Attempted to allocate 0 bytes", m_name);
             Unlock();
 #endif
             return nullptr;
@@ -218,7 +218,7 @@ namespace ds::core::memory
         {
             // Out of memory
 #ifdef DS_DEBUG
-            DS_LOG_ERROR("Stack '{0}' allocation failed: requested {1} bytes with {2} alignment, "
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Stack '{0}' allocation failed: requested {1} bytes with {2} alignment, "
                 "but only {3} bytes available",
                 m_name, size, alignment, m_end_pos - m_current_pos);
             Unlock();
@@ -250,7 +250,7 @@ namespace ds::core::memory
         }
         else if (result_pos_void && m_debug_allocation_count >= MAX_DEBUG_ALLOCATIONS)
         {
-            DS_LOG_WARN("Stack '{0}': Debug allocation tracking limit reached ({1})",
+            DS_LOG_CHANNEL_WARN(MEMORY, "Stack '{0}': Debug allocation tracking limit reached ({1})",
                 m_name, MAX_DEBUG_ALLOCATIONS);
         }
         Unlock();
@@ -272,7 +272,7 @@ namespace ds::core::memory
         // Validate marker is within our stack
         if (marker < m_start_pos || marker > m_current_pos)
         {
-            DS_LOG_ERROR("Stack '{0}': Invalid marker {1}", m_name, marker);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "Stack '{0}': Invalid marker {1}", m_name, marker);
             Unlock();
             return;
         }
@@ -311,7 +311,7 @@ namespace ds::core::memory
             Memory::Memset(reinterpret_cast<void*>(marker), 0xCD, freed_size);
         }
 
-        DS_LOG_INFO("Stack '{0}' freed to marker: {1} bytes released", m_name, freed_size);
+        DS_LOG_CHANNEL_INFO(MEMORY, "Stack '{0}' freed to marker: {1} bytes released", m_name, freed_size);
 #endif
 
         // Reset current position to the marker
@@ -330,7 +330,7 @@ namespace ds::core::memory
         // Check if stack is empty
         if (m_current_pos == m_start_pos)
         {
-            DS_LOG_WARN("Stack '{0}': Cannot free latest allocation - stack is empty", m_name);
+            DS_LOG_CHANNEL_WARN(MEMORY, "Stack '{0}': Cannot free latest allocation - stack is empty", m_name);
             Unlock();
             return false;
         }
@@ -368,7 +368,7 @@ namespace ds::core::memory
             // Update current position
             m_current_pos = marker;
 
-            DS_LOG_INFO("Stack '{0}' freed latest allocation: {1} bytes released",
+            DS_LOG_CHANNEL_INFO(MEMORY, "Stack '{0}' freed latest allocation: {1} bytes released",
                 m_name, highest_pos + m_debug_allocations[latest_allocation_index].size - marker);
 
             Unlock();
@@ -377,7 +377,7 @@ namespace ds::core::memory
 
         // If we get here in debug mode, we don't have debug info for any allocations
         // This would be strange, but we'll handle it by just resetting the stack
-        DS_LOG_WARN("Stack '{0}': No debug info available for latest allocation", m_name);
+        DS_LOG_CHANNEL_WARN(MEMORY, "Stack '{0}': No debug info available for latest allocation", m_name);
         Reset();
 
         Unlock();
@@ -420,7 +420,7 @@ namespace ds::core::memory
             Memory::Memset(reinterpret_cast<void*>(m_start_pos), 0xCD, used_size);
         }
 
-        DS_LOG_INFO("Stack '{0}' reset: {1} bytes freed", m_name, used_size);
+        DS_LOG_CHANNEL_INFO(MEMORY, "Stack '{0}' reset: {1} bytes freed", m_name, used_size);
 #endif
 
         // Reset current position to start
@@ -469,7 +469,7 @@ namespace ds::core::memory
         }
         else if (ptr && m_debug_allocation_count >= MAX_DEBUG_ALLOCATIONS)
         {
-            DS_LOG_WARN("Stack '{0}': Debug allocation tracking limit reached ({1})",
+            DS_LOG_CHANNEL_WARN(MEMORY, "Stack '{0}': Debug allocation tracking limit reached ({1})",
                 m_name, MAX_DEBUG_ALLOCATIONS);
         }
 
@@ -550,7 +550,7 @@ namespace ds::core::memory
         }
 
         ss << "==============================================";
-        DS_LOG_INFO("{}", ss.str());
+        DS_LOG_CHANNEL_INFO(MEMORY, "{}", ss.str());
 
         Unlock();
     }
@@ -1,5 +1,7 @@
 #include <core/ds_pch.h>
 #include <core/memory/streaming_allocator.h>
+#include <core/algorithms/parallel.h>
+#include <core/profiler/profiler.h>
 
 // For getting current time
 #ifdef DS_PLATFORM_WINDOWS
@@ -8,6 +10,15 @@
 #include <sys/time.h>
 #endif
 
+// For hot reload file watching
+#ifdef DS_PLATFORM_LINUX
+#include <sys/inotify.h>
+#include <poll.h>
+#endif
+
+#include <bit>
+#include <cmath>
+
 namespace ds::core::memory
 {
     // Helper function to get current time in milliseconds
@@ -25,6 +36,23 @@ namespace ds::core::memory
 #endif
     }
 
+    // Helper function to get a monotonic time in microseconds for telemetry
+    ds_u64 GetCurrentTimeUS()
+    {
+        return static_cast<ds_u64>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // Names used for telemetry dumps, indexed by the enum values
+    static const ds_char* s_category_names[Streaming_Allocator::CATEGORY_COUNT] =
+        { "geometry", "texture", "audio", "animation", "script", "generic" };
+
+    static const ds_char* s_priority_names[Streaming_Allocator::PRIORITY_COUNT] =
+        { "critical", "high", "medium", "low", "background" };
+
+    static const ds_char* s_phase_names[Streaming_Allocator::PHASE_COUNT] =
+        { "queue_wait", "io", "decompress" };
+
     Streaming_Allocator::Streaming_Allocator(const Config& config, const ds_char* name)
         : m_config(config)
         , m_page_allocator(config.page_size, 0, "Streaming_Page_Allocator")
@@ -53,6 +81,14 @@ namespace ds::core::memory
             m_name[i] = '\0';
         }
 
+        // A category cannot guarantee more than its whole budget
+        if (m_config.guaranteed_budget_percent > 100)
+        {
+            DS_LOG_CHANNEL_WARN(STREAMING, "Streaming Allocator '{0}': Guaranteed budget of {1}% clamped to 100%",
+                m_name, m_config.guaranteed_budget_percent);
+            m_config.guaranteed_budget_percent = 100;
+        }
+
         // Set up memory budgets for each category
         m_category_memory_budget[static_cast<int>(Resource_Category::GEOMETRY)] =
             (m_config.total_memory_budget * m_config.geometry_budget_percent) / 100;
@@ -81,18 +117,28 @@ namespace ds::core::memory
             m_stats.category_stats[i].memory_budget = m_category_memory_budget[i];
         }
 
-        // Initialize resource entries
+        // Initialize resource and bundle entries
         Memory::Memset(m_resources, 0, sizeof(m_resources));
+        Memory::Memset(m_bundles, 0, sizeof(m_bundles));
 
         // Record start time
         m_last_update_time = GetCurrentTimeMS();
+        m_telemetry.Reset();
 
-        DS_LOG_INFO("Streaming Allocator '{0}' initialized with {1} MB memory budget",
+        if (m_config.enable_hot_reload)
+        {
+            Start_Hot_Reload();
+        }
+
+        DS_LOG_CHANNEL_INFO(STREAMING, "Streaming Allocator '{0}' initialized with {1} MB memory budget",
             m_name, m_config.total_memory_budget / (1024 * 1024));
     }
 
     Streaming_Allocator::~Streaming_Allocator()
     {
+        // The watcher allocates from the page allocator, so it has to stop first
+        Stop_Hot_Reload();
+
         // Unload all resources
         for (ds_u64 i = 0; i < m_resource_count; i++)
         {
@@ -105,29 +151,40 @@ namespace ds::core::memory
             }
         }
 
-        DS_LOG_INFO("Streaming Allocator '{0}' destroyed. Stats: {1} resources, {2} MB loaded, {3} load operations",
+        DS_LOG_CHANNEL_INFO(STREAMING, "Streaming Allocator '{0}' destroyed. Stats: {1} resources, {2} MB loaded, {3} load operations",
             m_name, m_stats.resource_count, m_stats.total_memory_used / (1024 * 1024), m_stats.load_operations);
     }
 
     Streaming_Allocator::Streaming_Allocator(Streaming_Allocator&& other) noexcept
         : m_config(other.m_config)
         , m_resource_count(other.m_resource_count)
+        , m_cached_memory_block_count(other.m_cached_memory_block_count)
+        , m_bundle_count(other.m_bundle_count)
+        , m_next_bundle_id(other.m_next_bundle_id)
         , m_player_x(other.m_player_x)
         , m_player_y(other.m_player_y)
         , m_player_z(other.m_player_z)
         , m_last_update_time(other.m_last_update_time)
-        , m_page_allocator(std::move(other.m_page_allocator))
+        , m_page_allocator(other.m_config.page_size, 0, "Streaming_Page_Allocator")
         , m_stats(other.m_stats)
     {
+        // The other watcher allocates from its page allocator, so it has to stop before that is taken over
+        other.Stop_Hot_Reload();
+        m_page_allocator = std::move(other.m_page_allocator);
+
         // Copy memory tracking
         Memory::Memcpy(m_category_memory_used, other.m_category_memory_used, sizeof(m_category_memory_used));
         Memory::Memcpy(m_category_memory_budget, other.m_category_memory_budget, sizeof(m_category_memory_budget));
 
-        // Copy resource entries
+        // Copy resource and bundle entries
         Memory::Memcpy(m_resources, other.m_resources, sizeof(Resource_Entry) * m_resource_count);
+        Memory::Memcpy(m_bundles, other.m_bundles, sizeof(Bundle_Entry) * m_bundle_count);
+        Memory::Memcpy(m_cached_memory_blocks, other.m_cached_memory_blocks,
+            sizeof(Cached_Memory_Block) * m_cached_memory_block_count);
 
         // Move operation queues
         m_pending_operations = std::move(other.m_pending_operations);
+        m_pending_operations_sorted = other.m_pending_operations_sorted;
         m_active_operations = std::move(other.m_active_operations);
 
         // Copy name
@@ -136,18 +193,35 @@ namespace ds::core::memory
         // Set next resource ID
         m_next_resource_id.store(other.m_next_resource_id.load(std::memory_order_relaxed), std::memory_order_relaxed);
 
+        // Take over telemetry
+        m_telemetry.Copy_From(other.m_telemetry);
+
+        // Pending reloads live in the page allocator we just took over
+        m_completed_reloads = std::move(other.m_completed_reloads);
+        if (m_config.enable_hot_reload)
+        {
+            Start_Hot_Reload();
+        }
+
         // Clear the moved-from object
         other.m_resource_count = 0;
+        other.m_bundle_count = 0;
+        other.m_cached_memory_block_count = 0;
         Memory::Memset(other.m_category_memory_used, 0, sizeof(other.m_category_memory_used));
         Memory::Memset(other.m_resources, 0, sizeof(other.m_resources));
+        Memory::Memset(other.m_bundles, 0, sizeof(other.m_bundles));
         other.m_last_update_time = 0;
         Memory::Memset(&other.m_stats, 0, sizeof(other.m_stats));
+        other.m_telemetry.Reset();
     }
 
     Streaming_Allocator& Streaming_Allocator::operator=(Streaming_Allocator&& other) noexcept
     {
         if (this != &other)
         {
+            Stop_Hot_Reload();
+            other.Stop_Hot_Reload();
+
             // Clear existing resources
             for (ds_u64 i = 0; i < m_resource_count; i++)
             {
@@ -163,6 +237,9 @@ namespace ds::core::memory
             // Copy configuration and state
             m_config = other.m_config;
             m_resource_count = other.m_resource_count;
+            m_bundle_count = other.m_bundle_count;
+            m_next_bundle_id = other.m_next_bundle_id;
+            m_cached_memory_block_count = other.m_cached_memory_block_count;
             m_player_x = other.m_player_x;
             m_player_y = other.m_player_y;
             m_player_z = other.m_player_z;
@@ -173,11 +250,15 @@ namespace ds::core::memory
             Memory::Memcpy(m_category_memory_used, other.m_category_memory_used, sizeof(m_category_memory_used));
             Memory::Memcpy(m_category_memory_budget, other.m_category_memory_budget, sizeof(m_category_memory_budget));
 
-            // Copy resource entries
+            // Copy resource and bundle entries
             Memory::Memcpy(m_resources, other.m_resources, sizeof(Resource_Entry) * m_resource_count);
+            Memory::Memcpy(m_bundles, other.m_bundles, sizeof(Bundle_Entry) * m_bundle_count);
+            Memory::Memcpy(m_cached_memory_blocks, other.m_cached_memory_blocks,
+                sizeof(Cached_Memory_Block) * m_cached_memory_block_count);
 
             // Move operation queues
             m_pending_operations = std::move(other.m_pending_operations);
+            m_pending_operations_sorted = other.m_pending_operations_sorted;
             m_active_operations = std::move(other.m_active_operations);
 
             // Copy name
@@ -186,12 +267,26 @@ namespace ds::core::memory
             // Set next resource ID
             m_next_resource_id.store(other.m_next_resource_id.load(std::memory_order_relaxed), std::memory_order_relaxed);
 
+            // Take over telemetry
+            m_telemetry.Copy_From(other.m_telemetry);
+
+            // Pending reloads live in the page allocator we just took over
+            m_completed_reloads = std::move(other.m_completed_reloads);
+            if (m_config.enable_hot_reload)
+            {
+                Start_Hot_Reload();
+            }
+
             // Clear the moved-from object
             other.m_resource_count = 0;
+            other.m_bundle_count = 0;
+            other.m_cached_memory_block_count = 0;
             Memory::Memset(other.m_category_memory_used, 0, sizeof(other.m_category_memory_used));
             Memory::Memset(other.m_resources, 0, sizeof(other.m_resources));
+            Memory::Memset(other.m_bundles, 0, sizeof(other.m_bundles));
             other.m_last_update_time = 0;
             Memory::Memset(&other.m_stats, 0, sizeof(other.m_stats));
+            other.m_telemetry.Reset();
         }
         return *this;
     }
@@ -199,7 +294,11 @@ namespace ds::core::memory
     Resource_Handle Streaming_Allocator::Request_Resource(const Resource_Request& request)
     {
         std::lock_guard<std::mutex> lock(m_mutex);
+        return Request_Resource_Internal(request);
+    }
 
+    Resource_Handle Streaming_Allocator::Request_Resource_Internal(const Resource_Request& request)
+    {
         Resource_Handle handle;
         handle.id = 0;
         handle.state = Resource_State::UNLOADED;
@@ -212,7 +311,7 @@ namespace ds::core::memory
             if (existing->unloading_scheduled)
             {
                 existing->unloading_scheduled = false;
-                DS_LOG_TRACE("Streaming Allocator '{0}': Canceling unload for resource {1}",
+                DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Canceling unload for resource {1}",
                     m_name, request.resource_id);
             }
 
@@ -240,7 +339,10 @@ namespace ds::core::memory
                         op.resource_id = request.resource_id;
                         op.path = existing->info.path;
                         op.priority = request.priority;
+                        op.bundle_id = existing->bundle_id;
+                        op.file_offset = existing->file_offset;
                         m_pending_operations.push_back(op);
+                        m_pending_operations_sorted = false;
                     }
                 }
             }
@@ -264,7 +366,7 @@ namespace ds::core::memory
         // Check if we have room to track this resource
         if (m_resource_count >= MAX_RESOURCES)
         {
-            DS_LOG_ERROR("Streaming Allocator '{0}': Maximum number of resources ({1}) reached",
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Maximum number of resources ({1}) reached",
                 m_name, MAX_RESOURCES);
             return handle;
         }
@@ -296,6 +398,12 @@ namespace ds::core::memory
         entry.distance_from_player = 0.0f;
         entry.loading_scheduled = false;
         entry.unloading_scheduled = false;
+        entry.load_requested_time_us = 0;
+        entry.was_evicted = false;
+        entry.file_offset = request.file_offset;
+        entry.bundle_id = 0;
+        entry.dependency_count = 0;
+        entry.borrowed_budget = false;
 
         // Schedule loading
         Schedule_Resource_Load(&entry);
@@ -311,10 +419,325 @@ namespace ds::core::memory
         return handle;
     }
 
+    Bundle_Handle Streaming_Allocator::Request_Bundle(const Bundle_Request& request)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        Bundle_Handle handle;
+
+        if (!request.requests || request.request_count == 0)
+        {
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Cannot request an empty bundle", m_name);
+            return handle;
+        }
+
+        if (request.request_count > MAX_BUNDLE_RESOURCES)
+        {
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Bundle with {1} resources exceeds the limit of {2}",
+                m_name, request.request_count, MAX_BUNDLE_RESOURCES);
+            return handle;
+        }
+
+        if (m_bundle_count >= MAX_BUNDLES)
+        {
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Maximum number of bundles ({1}) reached",
+                m_name, MAX_BUNDLES);
+            return handle;
+        }
+
+        // The id is only taken once every resource has been requested
+        Bundle_Entry& bundle = m_bundles[m_bundle_count++];
+        Memory::Memset(&bundle, 0, sizeof(Bundle_Entry));
+        bundle.info.id = m_next_bundle_id;
+        bundle.info.state = Resource_State::LOADING;
+        bundle.info.resource_count = request.request_count;
+        bundle.callback = request.callback;
+        bundle.user_data = request.user_data;
+
+        // The bundle loads as one unit, so every read uses its most urgent priority
+        Resource_Priority bundle_priority = Resource_Priority::BACKGROUND;
+
+        // Bundles the resources belonged to before, restored if the request fails
+        ds_u64 previous_bundle_ids[MAX_BUNDLE_RESOURCES];
+
+        for (ds_u32 i = 0; i < request.request_count; i++)
+        {
+            Resource_Handle resource = Request_Resource_Internal(request.requests[i]);
+            if (!resource.IsValid())
+            {
+                DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Failed to request resource {1} of bundle {2}",
+                    m_name, i, bundle.info.id);
+
+                // Resources requested so far stay tracked as individual resources
+                for (ds_u32 j = 0; j < i; j++)
+                {
+                    Resource_Entry* requested = Find_Resource_Entry(bundle.resource_ids[j]);
+                    if (requested && requested->bundle_id == bundle.info.id)
+                    {
+                        requested->bundle_id = previous_bundle_ids[j];
+                    }
+                }
+
+                m_bundle_count--;
+                return handle;
+            }
+
+            Resource_Entry* entry = Find_Resource_Entry(resource.id);
+            previous_bundle_ids[i] = entry->bundle_id;
+            entry->bundle_id = bundle.info.id;
+            bundle.resource_ids[i] = resource.id;
+
+            if (static_cast<int>(entry->info.priority) < static_cast<int>(bundle_priority))
+            {
+                bundle_priority = entry->info.priority;
+            }
+        }
+
+        m_next_bundle_id++;
+
+        // Members that were requested before and have since been unloaded load with the bundle
+        Schedule_Bundle_Loads(bundle);
+
+        // Tag the queued reads so they are issued together in file offset order
+        for (IO_Operation& operation : m_pending_operations)
+        {
+            if (operation.type != IO_Operation::LOAD)
+            {
+                continue;
+            }
+
+            for (ds_u32 i = 0; i < bundle.info.resource_count; i++)
+            {
+                if (operation.resource_id == bundle.resource_ids[i])
+                {
+                    const Resource_Entry* entry = Find_Resource_Entry(operation.resource_id);
+                    operation.bundle_id = bundle.info.id;
+                    operation.file_offset = entry->file_offset;
+                    operation.priority = bundle_priority;
+                    break;
+                }
+            }
+        }
+        m_pending_operations_sorted = false;
+
+        Refresh_Bundle_State(bundle);
+
+        DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Requested bundle {1} with {2} resources",
+            m_name, bundle.info.id, bundle.info.resource_count);
+
+        handle.id = bundle.info.id;
+        handle.state = bundle.info.state;
+        return handle;
+    }
+
+    const Streaming_Allocator::Bundle_Info* Streaming_Allocator::Get_Bundle_Info(Bundle_Handle handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const Bundle_Entry* bundle = Find_Bundle_Entry(handle);
+        if (!bundle)
+        {
+            return nullptr;
+        }
+
+        return &bundle->info;
+    }
+
+    Resource_Handle Streaming_Allocator::Get_Bundle_Resource(Bundle_Handle handle, ds_u32 index)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        Resource_Handle resource;
+
+        Bundle_Entry* bundle = Find_Bundle_Entry(handle);
+        if (!bundle || index >= bundle->info.resource_count)
+        {
+            return resource;
+        }
+
+        const Resource_Entry* entry = Find_Resource_Entry(bundle->resource_ids[index]);
+        if (entry)
+        {
+            resource.id = entry->info.id;
+            resource.state = entry->info.state;
+        }
+
+        return resource;
+    }
+
+    bool Streaming_Allocator::Unload_Bundle(Bundle_Handle handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        Bundle_Entry* bundle = Find_Bundle_Entry(handle);
+        if (!bundle)
+        {
+            return false;
+        }
+
+        for (ds_u32 i = 0; i < bundle->info.resource_count; i++)
+        {
+            Resource_Entry* entry = Find_Resource_Entry(bundle->resource_ids[i]);
+            if (!entry)
+            {
+                continue;
+            }
+
+            if (entry->bundle_id == bundle->info.id)
+            {
+                entry->bundle_id = 0;
+            }
+
+            // Same rules as Unload_Resource: critical and referenced resources stay
+            if (entry->info.priority != Resource_Priority::CRITICAL && entry->info.reference_count == 0)
+            {
+                Schedule_Resource_Unload(entry);
+            }
+        }
+
+        DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Unloading bundle {1}", m_name, bundle->info.id);
+
+        // Swap with the last bundle to keep the array packed
+        *bundle = m_bundles[--m_bundle_count];
+        return true;
+    }
+
+    bool Streaming_Allocator::Add_Resource_Dependency(Resource_Handle resource, Resource_Handle dependency)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        Resource_Entry* entry = Find_Resource_Entry(resource);
+        Resource_Entry* dependency_entry = Find_Resource_Entry(dependency);
+        if (!entry || !dependency_entry)
+        {
+            return false;
+        }
+
+        // Reject anything that would make the loads wait on each other forever
+        if (Depends_On(dependency_entry->info.id, entry->info.id))
+        {
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Dependency of resource {1} on {2} would create a cycle",
+                m_name, entry->info.id, dependency_entry->info.id);
+            return false;
+        }
+
+        for (ds_u32 i = 0; i < entry->dependency_count; i++)
+        {
+            if (entry->dependencies[i] == dependency_entry->info.id)
+            {
+                return true;
+            }
+        }
+
+        if (entry->dependency_count >= MAX_DEPENDENCIES)
+        {
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Resource {1} already has {2} dependencies",
+                m_name, entry->info.id, MAX_DEPENDENCIES);
+            return false;
+        }
+
+        entry->dependencies[entry->dependency_count++] = dependency_entry->info.id;
+
+        // A load that is already queued needs the new dependency queued as well
+        if (entry->loading_scheduled && dependency_entry->info.state == Resource_State::UNLOADED)
+        {
+            Schedule_Resource_Load(dependency_entry);
+        }
+
+        return true;
+    }
+
+    void* Streaming_Allocator::Allocate_Memory(ds_u64 size, Resource_Category category)
+    {
+        if (size == 0)
+        {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // The budget is charged for whole pages since that is what the allocation occupies
+        const ds_u64 aligned_size = Memory::Align_Size(size, m_page_allocator.Get_Page_Size());
+
+        if (!Has_Available_Memory(category, aligned_size))
+        {
+            // Borrowed memory comes back through the IO queue, so only a later call can use it
+            if (m_config.enable_adaptive_budgets)
+            {
+                Reclaim_Borrowed_Memory(category, aligned_size);
+            }
+
+            m_telemetry.budget_rejections[static_cast<int>(category)].fetch_add(1, std::memory_order_relaxed);
+            DS_LOG_CHANNEL_WARN(STREAMING, "Streaming Allocator '{0}': Not enough budget for a {1} byte allocation", m_name, size);
+            return nullptr;
+        }
+
+        void* data = nullptr;
+
+        // Reuse a released page run of the same size if there is one
+        for (ds_u64 i = 0; i < m_cached_memory_block_count; i++)
+        {
+            if (m_cached_memory_blocks[i].size == aligned_size)
+            {
+                data = m_cached_memory_blocks[i].data;
+                m_stats.cached_memory_bytes -= aligned_size;
+                m_cached_memory_blocks[i] = m_cached_memory_blocks[--m_cached_memory_block_count];
+                break;
+            }
+        }
+
+        if (!data)
+        {
+            // Cached runs of other sizes give way before the pool grows
+            Trim_Memory_Cache(aligned_size);
+            data = m_page_allocator.Allocate(aligned_size, Page_Protection::READ_WRITE, Page_Flags::COMMIT);
+            if (!data)
+            {
+                DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Failed to allocate {1} bytes from the page pool",
+                    m_name, aligned_size);
+                return nullptr;
+            }
+        }
+
+        Update_Memory_Usage(category, static_cast<ds_i64>(aligned_size));
+        m_stats.direct_allocation_count++;
+        DS_PROFILE_ALLOCATION(m_name, data, aligned_size);
+
+        return data;
+    }
+
+    void Streaming_Allocator::Deallocate_Memory(void* ptr, ds_u64 size, Resource_Category category)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const ds_u64 aligned_size = Memory::Align_Size(size, m_page_allocator.Get_Page_Size());
+        DS_PROFILE_FREE(m_name, ptr);
+
+        Update_Memory_Usage(category, -static_cast<ds_i64>(aligned_size));
+        m_stats.direct_allocation_count--;
+
+        // Keep the pages around for the next allocation of the same size, as long as the cache
+        // and the memory in use stay within the total budget
+        if (m_cached_memory_block_count < MAX_CACHED_MEMORY_BLOCKS &&
+            m_stats.total_memory_used + m_stats.cached_memory_bytes + aligned_size <= m_config.total_memory_budget)
+        {
+            m_cached_memory_blocks[m_cached_memory_block_count++] = { ptr, aligned_size };
+            m_stats.cached_memory_bytes += aligned_size;
+            return;
+        }
+
+        m_page_allocator.Deallocate(ptr);
+    }
+
     Resource_Handle Streaming_Allocator::Prefetch_Resource(const ds_char* path, Resource_Category category)
     {
         if (!path) {
-            DS_LOG_ERROR("Streaming Allocator '{0}': Cannot prefetch resource with null path", m_name);
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Cannot prefetch resource with null path", m_name);
             return Resource_Handle();
         }
 
@@ -337,7 +760,7 @@ namespace ds::core::memory
 #endif
 
         if (file_size == 0) {
-            DS_LOG_ERROR("Streaming Allocator '{0}': Failed to detect size for file {1}", m_name, path);
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Failed to detect size for file {1}", m_name, path);
             return Resource_Handle();
         }
 
@@ -395,7 +818,7 @@ namespace ds::core::memory
         if (entry->unloading_scheduled)
         {
             entry->unloading_scheduled = false;
-            DS_LOG_TRACE("Streaming Allocator '{0}': Canceling unload for resource {1}",
+            DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Canceling unload for resource {1}",
                 m_name, entry->info.id);
         }
 
@@ -435,7 +858,7 @@ namespace ds::core::memory
         // spatial database or resource registry to find nearby resources.
 
         // For now, just log that we intend to prefetch
-        DS_LOG_TRACE("Streaming Allocator '{0}': Prefetching resources at position ({1}, {2}, {3}) with radius {4}",
+        DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Prefetching resources at position ({1}, {2}, {3}) with radius {4}",
             m_name, position_x, position_y, position_z, radius);
 
         // The implementation would depend on how resources are organized spatially
@@ -481,7 +904,10 @@ namespace ds::core::memory
                 op.resource_id = entry->info.id;
                 op.path = entry->info.path;
                 op.priority = priority;
+                op.bundle_id = entry->bundle_id;
+                op.file_offset = entry->file_offset;
                 m_pending_operations.push_back(op);
+                m_pending_operations_sorted = false;
             }
         }
 
@@ -502,7 +928,7 @@ namespace ds::core::memory
         // Don't unload critical resources
         if (entry->info.priority == Resource_Priority::CRITICAL)
         {
-            DS_LOG_WARN("Streaming Allocator '{0}': Cannot unload critical resource {1}",
+            DS_LOG_CHANNEL_WARN(STREAMING, "Streaming Allocator '{0}': Cannot unload critical resource {1}",
                 m_name, entry->info.id);
             return false;
         }
@@ -510,7 +936,7 @@ namespace ds::core::memory
         // If it has references, we can't unload it
         if (entry->info.reference_count > 0)
         {
-            DS_LOG_WARN("Streaming Allocator '{0}': Cannot unload resource {1} with {2} references",
+            DS_LOG_CHANNEL_WARN(STREAMING, "Streaming Allocator '{0}': Cannot unload resource {1} with {2} references",
                 m_name, entry->info.id, entry->info.reference_count);
             return false;
         }
@@ -547,12 +973,12 @@ namespace ds::core::memory
 
                 if (flush_result)
                 {
-                    DS_LOG_TRACE("Streaming Allocator '{0}': Flushed resource {1} to disk",
+                    DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Flushed resource {1} to disk",
                         m_name, entry.info.id);
                 }
                 else
                 {
-                    DS_LOG_ERROR("Streaming Allocator '{0}': Failed to flush resource {1} to disk",
+                    DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Failed to flush resource {1} to disk",
                         m_name, entry.info.id);
                 }
             }
@@ -577,13 +1003,22 @@ namespace ds::core::memory
         // Process pending IO operations
         Process_IO_Operations();
 
+        // Drop cached pages that no longer fit next to the memory in use
+        Trim_Memory_Cache(0);
+
+        // Swap in resources that were reloaded after their file changed
+        Apply_Hot_Reloads();
+
         // Update loading queue based on priorities
         Update_Loading_Queue();
 
+        // Report bundles whose resources are all resident
+        Update_Bundle_States();
+
         // Log detailed stats if enabled
         if (m_config.log_detailed_stats)
         {
-            DS_LOG_INFO("Streaming Allocator '{0}': {1} resources, {2}/{3} MB used, {4} loading, {5} operations pending",
+            DS_LOG_CHANNEL_INFO(STREAMING, "Streaming Allocator '{0}': {1} resources, {2}/{3} MB used, {4} loading, {5} operations pending",
                 m_name, m_stats.resource_count,
                 m_stats.total_memory_used / (1024 * 1024),
                 m_stats.total_memory_budget / (1024 * 1024),
@@ -612,84 +1047,256 @@ namespace ds::core::memory
         return m_stats;
     }
 
-    // Clear all non-critical resources
-    void Streaming_Allocator::Clear_Non_Critical_Resources()
+    Streaming_Allocator::Telemetry_Snapshot Streaming_Allocator::Get_Telemetry_Snapshot() const
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        // Counters are only written under m_mutex, so relaxed loads give a consistent enough
+        // view for tuning without making readers contend with the streaming thread
+        Telemetry_Snapshot snapshot;
+        snapshot.timestamp_us = GetCurrentTimeUS();
 
-        // Unload all non-critical resources
-        for (ds_u64 i = 0; i < m_resource_count; i++)
+        for (ds_u32 i = 0; i < CATEGORY_COUNT; i++)
         {
-            Resource_Entry& entry = m_resources[i];
-
-            // Skip critical resources or those with references
-            if (entry.info.priority == Resource_Priority::CRITICAL ||
-                entry.info.reference_count > 0)
-            {
-                continue;
-            }
-
-            // Schedule unloading
-            if (entry.info.state == Resource_State::RESIDENT && !entry.unloading_scheduled)
-            {
-                Schedule_Resource_Unload(&entry);
+            m_telemetry.category_latency[i].Load(snapshot.category_latency[i]);
+            snapshot.budget_rejections[i] = m_telemetry.budget_rejections[i].load(std::memory_order_relaxed);
+            snapshot.evictions[i] = m_telemetry.evictions[i].load(std::memory_order_relaxed);
+            snapshot.evicted_bytes[i] = m_telemetry.evicted_bytes[i].load(std::memory_order_relaxed);
+        }
 
-                DS_LOG_TRACE("Streaming Allocator '{0}': Cleared non-critical resource {1}",
-                    m_name, entry.info.id);
-            }
+        for (ds_u32 i = 0; i < PRIORITY_COUNT; i++)
+        {
+            m_telemetry.priority_latency[i].Load(snapshot.priority_latency[i]);
         }
-    }
 
-    // Find resource entry by ID
-    Streaming_Allocator::Resource_Entry* Streaming_Allocator::Find_Resource_Entry(ds_u64 resource_id)
-    {
-        // Linear search through resources
-        for (ds_u64 i = 0; i < m_resource_count; i++)
+        for (ds_u32 i = 0; i < PHASE_COUNT; i++)
         {
-            if (m_resources[i].info.id == resource_id)
-            {
-                return &m_resources[i];
-            }
+            m_telemetry.phase_latency[i].Load(snapshot.phase_latency[i]);
         }
 
-        return nullptr;
+        snapshot.reloads_after_eviction = m_telemetry.reloads_after_eviction.load(std::memory_order_relaxed);
+        snapshot.rolling_window_seconds = Rolling_Counter::WINDOW_SECONDS;
+        snapshot.bandwidth_bytes_per_second = m_telemetry.bandwidth.Rate_Per_Second(snapshot.timestamp_us);
+        snapshot.evictions_per_second = m_telemetry.eviction_rate.Rate_Per_Second(snapshot.timestamp_us);
+
+        return snapshot;
     }
 
-    // Const version of find resource entry by ID
-    const Streaming_Allocator::Resource_Entry* Streaming_Allocator::Find_Resource_Entry(ds_u64 resource_id) const
+    // Writes one histogram as a JSON object
+    static void Write_Histogram_JSON(std::ofstream& out, const Streaming_Allocator::Latency_Histogram& histogram)
     {
-        // Linear search through resources
-        for (ds_u64 i = 0; i < m_resource_count; i++)
+        out << "{ \"count\": " << histogram.sample_count
+            << ", \"mean_us\": " << histogram.Mean_US()
+            << ", \"p50_us\": " << histogram.Percentile_US(50.0f)
+            << ", \"p95_us\": " << histogram.Percentile_US(95.0f)
+            << ", \"p99_us\": " << histogram.Percentile_US(99.0f)
+            << ", \"max_us\": " << histogram.max_us
+            << ", \"buckets\": [";
+
+        for (ds_u32 i = 0; i < Streaming_Allocator::Latency_Histogram::BUCKET_COUNT; i++)
         {
-            if (m_resources[i].info.id == resource_id)
-            {
-                return &m_resources[i];
-            }
+            out << (i ? ", " : "") << histogram.buckets[i];
         }
 
-        return nullptr;
+        out << "] }";
     }
 
-    // Find resource entry by handle
-    Streaming_Allocator::Resource_Entry* Streaming_Allocator::Find_Resource_Entry(Resource_Handle handle)
+    // Writes one histogram as CSV rows: group,name,count,mean_us,p50_us,p95_us,p99_us,max_us,buckets...
+    static void Write_Histogram_CSV(std::ofstream& out, const ds_char* group, const ds_char* name,
+        const Streaming_Allocator::Latency_Histogram& histogram)
     {
-        // A handle is valid if its ID is not zero
-        if (!handle.IsValid())
+        out << group << "," << name << ","
+            << histogram.sample_count << ","
+            << histogram.Mean_US() << ","
+            << histogram.Percentile_US(50.0f) << ","
+            << histogram.Percentile_US(95.0f) << ","
+            << histogram.Percentile_US(99.0f) << ","
+            << histogram.max_us;
+
+        for (ds_u32 i = 0; i < Streaming_Allocator::Latency_Histogram::BUCKET_COUNT; i++)
         {
-            return nullptr;
+            out << "," << histogram.buckets[i];
         }
 
-        // Find by ID
-        return Find_Resource_Entry(handle.id);
+        out << "\n";
     }
 
-    // Const version of find resource entry by handle
-    const Streaming_Allocator::Resource_Entry* Streaming_Allocator::Find_Resource_Entry(Resource_Handle handle) const
+    bool Streaming_Allocator::Dump_Telemetry(const ds_char* path, Telemetry_Format format) const
     {
-        // A handle is valid if its ID is not zero
-        if (!handle.IsValid())
+        if (!path)
         {
-            return nullptr;
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Cannot dump telemetry to a null path", m_name);
+            return false;
+        }
+
+        std::ofstream out(path, std::ios::trunc);
+        if (!out)
+        {
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Failed to open telemetry file {1}", m_name, path);
+            return false;
+        }
+
+        const Telemetry_Snapshot snapshot = Get_Telemetry_Snapshot();
+
+        if (format == Telemetry_Format::CSV)
+        {
+            out << "group,name,count,mean_us,p50_us,p95_us,p99_us,max_us";
+            for (ds_u32 i = 0; i < Latency_Histogram::BUCKET_COUNT; i++)
+            {
+                out << ",bucket_" << i;
+            }
+            out << "\n";
+
+            for (ds_u32 i = 0; i < CATEGORY_COUNT; i++)
+            {
+                Write_Histogram_CSV(out, "category_latency", s_category_names[i], snapshot.category_latency[i]);
+            }
+            for (ds_u32 i = 0; i < PRIORITY_COUNT; i++)
+            {
+                Write_Histogram_CSV(out, "priority_latency", s_priority_names[i], snapshot.priority_latency[i]);
+            }
+            for (ds_u32 i = 0; i < PHASE_COUNT; i++)
+            {
+                Write_Histogram_CSV(out, "phase_latency", s_phase_names[i], snapshot.phase_latency[i]);
+            }
+
+            // Scalar counters use the count column only
+            for (ds_u32 i = 0; i < CATEGORY_COUNT; i++)
+            {
+                out << "budget_rejections," << s_category_names[i] << "," << snapshot.budget_rejections[i] << "\n";
+                out << "evictions," << s_category_names[i] << "," << snapshot.evictions[i] << "\n";
+                out << "evicted_bytes," << s_category_names[i] << "," << snapshot.evicted_bytes[i] << "\n";
+            }
+            out << "churn,reloads_after_eviction," << snapshot.reloads_after_eviction << "\n";
+            out << "rolling,bandwidth_bytes_per_second," << snapshot.bandwidth_bytes_per_second << "\n";
+            out << "rolling,evictions_per_second," << snapshot.evictions_per_second << "\n";
+        }
+        else
+        {
+            out << "{\n";
+            out << "  \"allocator\": \"" << m_name << "\",\n";
+            out << "  \"timestamp_us\": " << snapshot.timestamp_us << ",\n";
+            out << "  \"rolling_window_seconds\": " << snapshot.rolling_window_seconds << ",\n";
+            out << "  \"bandwidth_bytes_per_second\": " << snapshot.bandwidth_bytes_per_second << ",\n";
+            out << "  \"evictions_per_second\": " << snapshot.evictions_per_second << ",\n";
+            out << "  \"reloads_after_eviction\": " << snapshot.reloads_after_eviction << ",\n";
+
+            out << "  \"categories\": {\n";
+            for (ds_u32 i = 0; i < CATEGORY_COUNT; i++)
+            {
+                out << "    \"" << s_category_names[i] << "\": { "
+                    << "\"budget_rejections\": " << snapshot.budget_rejections[i]
+                    << ", \"evictions\": " << snapshot.evictions[i]
+                    << ", \"evicted_bytes\": " << snapshot.evicted_bytes[i]
+                    << ", \"latency\": ";
+                Write_Histogram_JSON(out, snapshot.category_latency[i]);
+                out << " }" << (i + 1 < CATEGORY_COUNT ? "," : "") << "\n";
+            }
+            out << "  },\n";
+
+            out << "  \"priorities\": {\n";
+            for (ds_u32 i = 0; i < PRIORITY_COUNT; i++)
+            {
+                out << "    \"" << s_priority_names[i] << "\": ";
+                Write_Histogram_JSON(out, snapshot.priority_latency[i]);
+                out << (i + 1 < PRIORITY_COUNT ? "," : "") << "\n";
+            }
+            out << "  },\n";
+
+            out << "  \"phases\": {\n";
+            for (ds_u32 i = 0; i < PHASE_COUNT; i++)
+            {
+                out << "    \"" << s_phase_names[i] << "\": ";
+                Write_Histogram_JSON(out, snapshot.phase_latency[i]);
+                out << (i + 1 < PHASE_COUNT ? "," : "") << "\n";
+            }
+            out << "  }\n";
+            out << "}\n";
+        }
+
+        DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Dumped telemetry to {1}", m_name, path);
+        return static_cast<bool>(out);
+    }
+
+    // Clear all non-critical resources
+    void Streaming_Allocator::Clear_Non_Critical_Resources()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Unload all non-critical resources
+        for (ds_u64 i = 0; i < m_resource_count; i++)
+        {
+            Resource_Entry& entry = m_resources[i];
+
+            // Skip critical resources or those with references
+            if (entry.info.priority == Resource_Priority::CRITICAL ||
+                entry.info.reference_count > 0)
+            {
+                continue;
+            }
+
+            // Schedule unloading
+            if (entry.info.state == Resource_State::RESIDENT && !entry.unloading_scheduled)
+            {
+                Schedule_Resource_Unload(&entry);
+
+                DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Cleared non-critical resource {1}",
+                    m_name, entry.info.id);
+            }
+        }
+
+        // Give every cached page run back to the system
+        Trim_Memory_Cache(m_config.total_memory_budget);
+    }
+
+    // Find resource entry by ID
+    Streaming_Allocator::Resource_Entry* Streaming_Allocator::Find_Resource_Entry(ds_u64 resource_id)
+    {
+        // Linear search through resources
+        for (ds_u64 i = 0; i < m_resource_count; i++)
+        {
+            if (m_resources[i].info.id == resource_id)
+            {
+                return &m_resources[i];
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Const version of find resource entry by ID
+    const Streaming_Allocator::Resource_Entry* Streaming_Allocator::Find_Resource_Entry(ds_u64 resource_id) const
+    {
+        // Linear search through resources
+        for (ds_u64 i = 0; i < m_resource_count; i++)
+        {
+            if (m_resources[i].info.id == resource_id)
+            {
+                return &m_resources[i];
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Find resource entry by handle
+    Streaming_Allocator::Resource_Entry* Streaming_Allocator::Find_Resource_Entry(Resource_Handle handle)
+    {
+        // A handle is valid if its ID is not zero
+        if (!handle.IsValid())
+        {
+            return nullptr;
+        }
+
+        // Find by ID
+        return Find_Resource_Entry(handle.id);
+    }
+
+    // Const version of find resource entry by handle
+    const Streaming_Allocator::Resource_Entry* Streaming_Allocator::Find_Resource_Entry(Resource_Handle handle) const
+    {
+        // A handle is valid if its ID is not zero
+        if (!handle.IsValid())
+        {
+            return nullptr;
         }
 
         // Find by ID
@@ -713,20 +1320,43 @@ namespace ds::core::memory
         // as they were already executed when moved from the pending queue
         m_active_operations.clear();
 
+        // Loads waiting for their dependencies go back to the queue after this update
+        std::vector<IO_Operation> deferred_operations;
+
         // Add new operations from the pending queue
         while (!m_pending_operations.empty() && operations_processed < max_operations_per_update)
         {
-            // Sort operations by priority
-            std::sort(m_pending_operations.begin(), m_pending_operations.end(),
-                [](const IO_Operation& a, const IO_Operation& b) {
-                    // Higher priority comes first
-                    return static_cast<int>(a.priority) < static_cast<int>(b.priority);
-                });
+            // Sort operations by priority, only re-sorted when operations were queued since
+            Sort_Pending_Operations();
 
             // Take the highest priority operation
             IO_Operation operation = m_pending_operations.front();
             m_pending_operations.erase(m_pending_operations.begin());
 
+            if (operation.type == IO_Operation::LOAD)
+            {
+                Resource_Entry* entry = Find_Resource_Entry(operation.resource_id);
+                Resource_State dependency_state = entry ? Get_Dependency_State(entry) : Resource_State::RESIDENT;
+
+                if (dependency_state == Resource_State::LOADING)
+                {
+                    deferred_operations.push_back(operation);
+                    continue;
+                }
+
+                if (dependency_state == Resource_State::FAILED)
+                {
+                    DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Dependency of resource {1} failed to load",
+                        m_name, entry->info.id);
+
+                    entry->loading_scheduled = false;
+                    entry->info.state = Resource_State::FAILED;
+                    m_stats.loading_count--;
+                    m_stats.failed_count++;
+                    continue;
+                }
+            }
+
             // Add to active operations - in a real implementation, these would be tracked
             // until the async operation completes
             m_active_operations.push_back(operation);
@@ -743,6 +1373,53 @@ namespace ds::core::memory
 
             operations_processed++;
         }
+
+        if (!deferred_operations.empty())
+        {
+            m_pending_operations.insert(m_pending_operations.end(), deferred_operations.begin(), deferred_operations.end());
+            m_pending_operations_sorted = false;
+        }
+    }
+
+    // Order pending operations by priority; within a priority, bundle loads are grouped
+    // and issued in path and file offset order so reads stay sequential.
+    // Large backlogs are sorted on the worker pool. Does nothing while the queue is still
+    // sorted, taking operations from the front or dropping them keeps the order
+    void Streaming_Allocator::Sort_Pending_Operations()
+    {
+        if (m_pending_operations_sorted)
+        {
+            return;
+        }
+
+        algorithms::stable_sort(m_pending_operations.begin(), m_pending_operations.end(),
+            [](const IO_Operation& a, const IO_Operation& b) {
+                // Higher priority comes first
+                if (a.priority != b.priority)
+                {
+                    return static_cast<int>(a.priority) < static_cast<int>(b.priority);
+                }
+
+                if (a.bundle_id != b.bundle_id)
+                {
+                    return a.bundle_id < b.bundle_id;
+                }
+
+                // Operations outside bundles keep their queue order
+                if (a.bundle_id == 0)
+                {
+                    return false;
+                }
+
+                int path_order = strcmp(a.path ? a.path : "", b.path ? b.path : "");
+                if (path_order != 0)
+                {
+                    return path_order < 0;
+                }
+
+                return a.file_offset < b.file_offset;
+            });
+        m_pending_operations_sorted = true;
     }
 
     // Schedule a resource for loading
@@ -756,6 +1433,7 @@ namespace ds::core::memory
         // Mark as loading
         entry->info.state = Resource_State::LOADING;
         entry->loading_scheduled = true;
+        entry->load_requested_time_us = GetCurrentTimeUS();
 
         // Create an IO operation
         IO_Operation operation;
@@ -763,19 +1441,32 @@ namespace ds::core::memory
         operation.resource_id = entry->info.id;
         operation.path = entry->info.path;
         operation.priority = entry->info.priority;
+        operation.bundle_id = entry->bundle_id;
+        operation.file_offset = entry->file_offset;
 
         // Add to pending operations
         m_pending_operations.push_back(operation);
+        m_pending_operations_sorted = false;
 
         // Update stats
         m_stats.loading_count++;
 
-        DS_LOG_TRACE("Streaming Allocator '{0}': Scheduled load for resource {1} with priority {2}",
+        // Dependencies have to be resident first, so make sure they are queued too
+        for (ds_u32 i = 0; i < entry->dependency_count; i++)
+        {
+            Resource_Entry* dependency = Find_Resource_Entry(entry->dependencies[i]);
+            if (dependency && dependency->info.state == Resource_State::UNLOADED)
+            {
+                Schedule_Resource_Load(dependency);
+            }
+        }
+
+        DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Scheduled load for resource {1} with priority {2}",
             m_name, entry->info.id, static_cast<int>(entry->info.priority));
     }
 
     // Schedule a resource for unloading
-    void Streaming_Allocator::Schedule_Resource_Unload(Resource_Entry* entry)
+    void Streaming_Allocator::Schedule_Resource_Unload(Resource_Entry* entry, Resource_Priority priority)
     {
         if (!entry || entry->unloading_scheduled || entry->info.state != Resource_State::RESIDENT)
         {
@@ -785,7 +1476,7 @@ namespace ds::core::memory
         // Cannot unload if it has references
         if (entry->info.reference_count > 0)
         {
-            DS_LOG_WARN("Streaming Allocator '{0}': Cannot unload resource {1} with {2} references",
+            DS_LOG_CHANNEL_WARN(STREAMING, "Streaming Allocator '{0}': Cannot unload resource {1} with {2} references",
                 m_name, entry->info.id, entry->info.reference_count);
             return;
         }
@@ -799,23 +1490,26 @@ namespace ds::core::memory
         operation.type = IO_Operation::UNLOAD;
         operation.resource_id = entry->info.id;
         operation.path = nullptr;  // Not needed for unload
-        operation.priority = Resource_Priority::BACKGROUND;  // Unloads are low priority
+        operation.priority = priority;  // Unloads are low priority unless a load waits on them
 
         // Add to pending operations
         m_pending_operations.push_back(operation);
+        m_pending_operations_sorted = false;
 
-        DS_LOG_TRACE("Streaming Allocator '{0}': Scheduled unload for resource {1}",
+        DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Scheduled unload for resource {1}",
             m_name, entry->info.id);
     }
 
     // Execute a load operation
     void Streaming_Allocator::Execute_Resource_Load(const IO_Operation& operation)
     {
+        DS_PROFILE_SCOPE_CATEGORY("Streaming Load", STREAMING, operation.resource_id);
+
         // Find the resource entry
         Resource_Entry* entry = Find_Resource_Entry(operation.resource_id);
         if (!entry)
         {
-            DS_LOG_ERROR("Streaming Allocator '{0}': Cannot find resource {1} for loading",
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Cannot find resource {1} for loading",
                 m_name, operation.resource_id);
             return;
         }
@@ -823,11 +1517,26 @@ namespace ds::core::memory
         // Reset loading scheduled flag
         entry->loading_scheduled = false;
 
-        // Check if we have enough memory for this resource
+        const ds_u64 execute_start_us = GetCurrentTimeUS();
+        const int category_index = static_cast<int>(entry->info.category);
+
+        // Check if we have enough memory for this resource; adaptive budgets first take back
+        // what other categories have borrowed and retry the load once those unloads have run
+        if (!Has_Available_Memory(entry->info.category, entry->info.size) &&
+            m_config.enable_adaptive_budgets && Reclaim_Borrowed_Memory(entry->info.category, entry->info.size))
+        {
+            entry->loading_scheduled = true;
+            m_pending_operations.push_back(operation);
+            m_pending_operations_sorted = false;
+            return;
+        }
+
         if (!Has_Available_Memory(entry->info.category, entry->info.size))
         {
+            m_telemetry.budget_rejections[category_index].fetch_add(1, std::memory_order_relaxed);
+
             // Try to free up memory by unloading low-priority resources
-            DS_LOG_WARN("Streaming Allocator '{0}': Not enough memory for resource {1}, attempting to free memory",
+            DS_LOG_CHANNEL_WARN(STREAMING, "Streaming Allocator '{0}': Not enough memory for resource {1}, attempting to free memory",
                 m_name, entry->info.id);
 
             // We'll need to implement a memory freeing strategy
@@ -868,6 +1577,9 @@ namespace ds::core::memory
             flags = flags | Page_Flags::ZERO;
         }
 
+        // Cached direct allocation pages give way to the resource
+        Trim_Memory_Cache(entry->info.size);
+
         // Allocate memory for the resource
         void* data = nullptr;
 
@@ -879,18 +1591,19 @@ namespace ds::core::memory
                 entry->info.size,
                 protection,
                 flags,
-                entry->info.path // Map the file directly
+                entry->info.path, // Map the file directly
+                entry->file_offset
             );
 
             // Log success or failure
             if (data)
             {
-                DS_LOG_TRACE("Streaming Allocator '{0}': Memory mapped file {1} ({2} KB)",
+                DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Memory mapped file {1} ({2} KB)",
                     m_name, entry->info.path, entry->info.size / 1024);
             }
             else
             {
-                DS_LOG_ERROR("Streaming Allocator '{0}': Failed to memory map file {1}",
+                DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Failed to memory map file {1}",
                     m_name, entry->info.path);
 
                 // Mark resource as failed
@@ -911,7 +1624,7 @@ namespace ds::core::memory
 
             if (!data)
             {
-                DS_LOG_ERROR("Streaming Allocator '{0}': Failed to allocate memory for resource {1}",
+                DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Failed to allocate memory for resource {1}",
                     m_name, entry->info.id);
 
                 entry->info.state = Resource_State::FAILED;
@@ -928,6 +1641,7 @@ namespace ds::core::memory
                 if (file)
                 {
                     // Read the file data into memory
+                    file.seekg(static_cast<std::streamoff>(entry->file_offset));
                     file.read(static_cast<char*>(data), entry->info.size);
 
                     // Check if we read the expected amount
@@ -937,17 +1651,17 @@ namespace ds::core::memory
                         // Fill the rest with zeros
                         Memory::Memset(static_cast<ds_u8*>(data) + bytes_read, 0, entry->info.size - bytes_read);
 
-                        DS_LOG_WARN("Streaming Allocator '{0}': File {1} was smaller than expected ({2} vs {3} bytes)",
+                        DS_LOG_CHANNEL_WARN(STREAMING, "Streaming Allocator '{0}': File {1} was smaller than expected ({2} vs {3} bytes)",
                             m_name, entry->info.path, bytes_read, entry->info.size);
                     }
 
-                    DS_LOG_TRACE("Streaming Allocator '{0}': Loaded file {1} ({2} bytes)",
+                    DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Loaded file {1} ({2} bytes)",
                         m_name, entry->info.path, bytes_read);
                 }
                 else
                 {
                     // File couldn't be opened
-                    DS_LOG_ERROR("Streaming Allocator '{0}': Failed to open file {1}",
+                    DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Failed to open file {1}",
                         m_name, entry->info.path);
 
                     // Initialize memory to zeros
@@ -962,32 +1676,57 @@ namespace ds::core::memory
         // Mark as resident
         entry->info.state = Resource_State::RESIDENT;
 
+        // Watch the backing file for hot reload
+        if (m_watch_fd >= 0)
+        {
+            Watch_Resource_File(entry);
+        }
+
         // Update memory usage
         Update_Memory_Usage(entry->info.category, static_cast<ds_i64>(entry->info.size));
+        entry->borrowed_budget = m_category_memory_used[category_index] > m_category_memory_budget[category_index];
 
         // Update stats
         m_stats.loading_count--;
         m_stats.bytes_loaded += entry->info.size;
         m_stats.load_operations++;
 
+        // Record telemetry before the callback so user code does not skew the I/O time
+        const ds_u64 resident_us = GetCurrentTimeUS();
+        const ds_u64 requested_us = entry->load_requested_time_us ? entry->load_requested_time_us : execute_start_us;
+        const ds_u64 total_latency_us = resident_us - requested_us;
+
+        m_telemetry.phase_latency[static_cast<int>(Load_Phase::QUEUE_WAIT)].Record(execute_start_us - requested_us);
+        m_telemetry.phase_latency[static_cast<int>(Load_Phase::IO)].Record(resident_us - execute_start_us);
+        m_telemetry.category_latency[category_index].Record(total_latency_us);
+        m_telemetry.priority_latency[static_cast<int>(entry->info.priority)].Record(total_latency_us);
+        m_telemetry.bandwidth.Add(resident_us, entry->info.size);
+
+        if (entry->was_evicted)
+        {
+            m_telemetry.reloads_after_eviction.fetch_add(1, std::memory_order_relaxed);
+        }
+
         // Call the callback if provided
         if (entry->callback)
         {
             entry->callback(entry->info.id, entry->data, entry->info.size, entry->user_data);
         }
 
-        DS_LOG_TRACE("Streaming Allocator '{0}': Loaded resource {1} ({2} KB)",
+        DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Loaded resource {1} ({2} KB)",
             m_name, entry->info.id, entry->info.size / 1024);
     }
 
     // Execute an unload operation
     void Streaming_Allocator::Execute_Resource_Unload(const IO_Operation& operation)
     {
+        DS_PROFILE_SCOPE_CATEGORY("Streaming Unload", STREAMING, operation.resource_id);
+
         // Find the resource entry
         Resource_Entry* entry = Find_Resource_Entry(operation.resource_id);
         if (!entry)
         {
-            DS_LOG_ERROR("Streaming Allocator '{0}': Cannot find resource {1} for unloading",
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Cannot find resource {1} for unloading",
                 m_name, operation.resource_id);
             return;
         }
@@ -998,7 +1737,13 @@ namespace ds::core::memory
         // Skip if resource is not resident or has references
         if (entry->info.state != Resource_State::UNLOADING || entry->info.reference_count > 0)
         {
-            DS_LOG_WARN("Streaming Allocator '{0}': Cannot unload resource {1}, state={2}, refs={3}",
+            // Referenced again after the unload was queued, so it stays in use
+            if (entry->info.state == Resource_State::UNLOADING && entry->data)
+            {
+                entry->info.state = Resource_State::RESIDENT;
+            }
+
+            DS_LOG_CHANNEL_WARN(STREAMING, "Streaming Allocator '{0}': Cannot unload resource {1}, state={2}, refs={3}",
                 m_name, entry->info.id, static_cast<int>(entry->info.state), entry->info.reference_count);
             return;
         }
@@ -1007,7 +1752,7 @@ namespace ds::core::memory
         if (entry->access_mode == Access_Mode::PERSISTENT_WRITE && entry->data)
         {
             m_page_allocator.Flush(entry->data, entry->info.size);
-            DS_LOG_TRACE("Streaming Allocator '{0}': Flushed changes to file {1}",
+            DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Flushed changes to file {1}",
                 m_name, entry->info.path);
         }
 
@@ -1028,20 +1773,162 @@ namespace ds::core::memory
         m_stats.bytes_unloaded += entry->info.size;
         m_stats.unload_operations++;
 
-        DS_LOG_TRACE("Streaming Allocator '{0}': Unloaded resource {1}",
+        // Record eviction churn
+        const int category_index = static_cast<int>(entry->info.category);
+        m_telemetry.evictions[category_index].fetch_add(1, std::memory_order_relaxed);
+        m_telemetry.evicted_bytes[category_index].fetch_add(entry->info.size, std::memory_order_relaxed);
+        m_telemetry.eviction_rate.Add(GetCurrentTimeUS(), 1);
+        entry->was_evicted = true;
+
+        DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Unloaded resource {1}",
             m_name, entry->info.id);
     }
 
     // Check if there is available memory for a resource
     bool Streaming_Allocator::Has_Available_Memory(Resource_Category category, ds_u64 size) const
+    {
+        return Fits_Budget(m_category_memory_used, category, size);
+    }
+
+    // Check if a resource fits the budgets given the memory used per category
+    bool Streaming_Allocator::Fits_Budget(const ds_u64* category_memory_used, Resource_Category category, ds_u64 size) const
     {
         int category_index = static_cast<int>(category);
 
         // Check if adding this size would exceed the category budget
-        ds_u64 category_used = m_category_memory_used[category_index];
+        ds_u64 category_used = category_memory_used[category_index];
         ds_u64 category_budget = m_category_memory_budget[category_index];
 
-        return (category_used + size <= category_budget);
+        if (!m_config.enable_adaptive_budgets)
+        {
+            return (category_used + size <= category_budget);
+        }
+
+        // With adaptive budgets, everything used above a category's budget has to be covered
+        // by the unused, non-guaranteed budget of the other categories
+        ds_u64 borrowed = 0;
+        ds_u64 lendable = 0;
+
+        for (int i = 0; i < static_cast<int>(CATEGORY_COUNT); i++)
+        {
+            ds_u64 used = category_memory_used[i] + (i == category_index ? size : 0);
+            ds_u64 budget = m_category_memory_budget[i];
+            ds_u64 reserved = std::max(used, (budget * m_config.guaranteed_budget_percent) / 100);
+
+            if (used > budget)
+            {
+                borrowed += used - budget;
+            }
+            else if (budget > reserved)
+            {
+                lendable += budget - reserved;
+            }
+        }
+
+        return borrowed <= lendable;
+    }
+
+    // Queue unloads of borrowed resources of other categories until the request fits.
+    // Returns true if the request fits once the queued unloads have run
+    bool Streaming_Allocator::Reclaim_Borrowed_Memory(Resource_Category category, ds_u64 size)
+    {
+        // Count memory that is already on its way out
+        ds_u64 used[CATEGORY_COUNT];
+        Memory::Memcpy(used, m_category_memory_used, sizeof(used));
+
+        for (ds_u64 i = 0; i < m_resource_count; i++)
+        {
+            const Resource_Entry& entry = m_resources[i];
+            if (entry.info.state == Resource_State::UNLOADING && entry.unloading_scheduled)
+            {
+                ds_u64& category_used = used[static_cast<int>(entry.info.category)];
+                category_used -= std::min(category_used, entry.info.size);
+            }
+        }
+
+        while (!Fits_Budget(used, category, size))
+        {
+            // Prefer resources that were loaded over budget, then the least important, then the oldest
+            Resource_Entry* victim = nullptr;
+
+            for (ds_u64 i = 0; i < m_resource_count; i++)
+            {
+                Resource_Entry& entry = m_resources[i];
+                int entry_category = static_cast<int>(entry.info.category);
+
+                if (entry.info.category == category ||
+                    entry.info.state != Resource_State::RESIDENT ||
+                    entry.info.priority == Resource_Priority::CRITICAL ||
+                    entry.info.reference_count > 0 ||
+                    used[entry_category] <= m_category_memory_budget[entry_category])
+                {
+                    continue;
+                }
+
+                if (!victim ||
+                    entry.borrowed_budget > victim->borrowed_budget ||
+                    (entry.borrowed_budget == victim->borrowed_budget &&
+                        (entry.info.priority > victim->info.priority ||
+                            (entry.info.priority == victim->info.priority &&
+                                entry.info.last_used_time < victim->info.last_used_time))))
+                {
+                    victim = &entry;
+                }
+            }
+
+            if (!victim)
+            {
+                return false;
+            }
+
+            DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Evicting borrowed resource {1} to return budget",
+                m_name, victim->info.id);
+
+            // The unload runs ahead of the loads in the queue
+            Schedule_Resource_Unload(victim, Resource_Priority::CRITICAL);
+
+            ds_u64& victim_used = used[static_cast<int>(victim->info.category)];
+            victim_used -= std::min(victim_used, victim->info.size);
+
+            m_stats.borrowed_evictions++;
+        }
+
+        return true;
+    }
+
+    // Recompute how much budget each category has borrowed or lent out
+    void Streaming_Allocator::Update_Lending_Stats()
+    {
+        m_stats.total_memory_borrowed = 0;
+
+        for (ds_u32 i = 0; i < CATEGORY_COUNT; i++)
+        {
+            ds_u64 used = m_category_memory_used[i];
+            ds_u64 budget = m_category_memory_budget[i];
+
+            m_stats.category_stats[i].memory_borrowed = used > budget ? used - budget : 0;
+            m_stats.category_stats[i].memory_lent = 0;
+            m_stats.total_memory_borrowed += m_stats.category_stats[i].memory_borrowed;
+        }
+
+        // Attribute the borrowed memory to lenders in category order
+        ds_u64 remaining = m_stats.total_memory_borrowed;
+
+        for (ds_u32 i = 0; i < CATEGORY_COUNT && remaining > 0; i++)
+        {
+            ds_u64 used = m_category_memory_used[i];
+            ds_u64 budget = m_category_memory_budget[i];
+            ds_u64 reserved = std::max(used, (budget * m_config.guaranteed_budget_percent) / 100);
+
+            if (reserved >= budget)
+            {
+                continue;
+            }
+
+            ds_u64 lent = std::min(remaining, budget - reserved);
+            m_stats.category_stats[i].memory_lent = lent;
+            remaining -= lent;
+        }
     }
 
     // Update memory usage statistics
@@ -1089,6 +1976,26 @@ namespace ds::core::memory
 
         // Update category stats
         m_stats.category_stats[category_index].memory_used = m_category_memory_used[category_index];
+
+        if (m_config.enable_adaptive_budgets)
+        {
+            Update_Lending_Stats();
+        }
+    }
+
+    // Free cached page runs until the memory in use, the cache and required_size fit the total budget
+    void Streaming_Allocator::Trim_Memory_Cache(ds_u64 required_size)
+    {
+        const ds_u64 budget = m_config.total_memory_budget;
+        const ds_u64 available = budget > required_size ? budget - required_size : 0;
+
+        while (m_cached_memory_block_count > 0 &&
+            m_stats.total_memory_used + m_stats.cached_memory_bytes > available)
+        {
+            const Cached_Memory_Block& block = m_cached_memory_blocks[--m_cached_memory_block_count];
+            m_page_allocator.Deallocate(block.data);
+            m_stats.cached_memory_bytes -= block.size;
+        }
     }
 
     // Get memory budget for a category
@@ -1116,16 +2023,172 @@ namespace ds::core::memory
         return (entry->info.state == Resource_State::RESIDENT && entry->data != nullptr);
     }
 
-    // Update distances for all resources based on player position
-    void Streaming_Allocator::Update_Resource_Distances(float player_x, float player_y, float player_z)
+    // Combined state of a resource's dependencies; queues the ones that are not loaded yet
+    Resource_State Streaming_Allocator::Get_Dependency_State(Resource_Entry* entry)
     {
-        // In a real implementation, we would use the resource's world position
-        // For this example, we'll use a simple formula to simulate distance
-        // based on resource ID (just for demonstration purposes)
+        Resource_State state = Resource_State::RESIDENT;
 
-        for (ds_u64 i = 0; i < m_resource_count; i++)
+        for (ds_u32 i = 0; i < entry->dependency_count; i++)
         {
-            Resource_Entry& entry = m_resources[i];
+            Resource_Entry* dependency = Find_Resource_Entry(entry->dependencies[i]);
+            if (!dependency || dependency->info.state == Resource_State::RESIDENT)
+            {
+                continue;
+            }
+
+            if (dependency->info.state == Resource_State::FAILED)
+            {
+                return Resource_State::FAILED;
+            }
+
+            if (dependency->info.state == Resource_State::UNLOADED)
+            {
+                Schedule_Resource_Load(dependency);
+            }
+
+            state = Resource_State::LOADING;
+        }
+
+        return state;
+    }
+
+    // Check if a resource depends on another, directly or through its dependencies
+    bool Streaming_Allocator::Depends_On(ds_u64 resource_id, ds_u64 dependency_id, ds_u32 depth) const
+    {
+        if (resource_id == dependency_id)
+        {
+            return true;
+        }
+
+        // Chains are short in practice; stop at an absurd depth rather than recursing forever
+        if (depth >= MAX_RESOURCES)
+        {
+            return true;
+        }
+
+        for (ds_u64 i = 0; i < m_resource_count; i++)
+        {
+            const Resource_Entry& entry = m_resources[i];
+            if (entry.info.id != resource_id)
+            {
+                continue;
+            }
+
+            for (ds_u32 j = 0; j < entry.dependency_count; j++)
+            {
+                if (Depends_On(entry.dependencies[j], dependency_id, depth + 1))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        return false;
+    }
+
+    // Find bundle entry by handle
+    Streaming_Allocator::Bundle_Entry* Streaming_Allocator::Find_Bundle_Entry(Bundle_Handle handle)
+    {
+        if (!handle.IsValid())
+        {
+            return nullptr;
+        }
+
+        for (ds_u64 i = 0; i < m_bundle_count; i++)
+        {
+            if (m_bundles[i].info.id == handle.id)
+            {
+                return &m_bundles[i];
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Requeue loads dropped from the queue until the bundle has completed once
+    void Streaming_Allocator::Schedule_Bundle_Loads(Bundle_Entry& bundle)
+    {
+        if (bundle.callback_fired)
+        {
+            return;
+        }
+
+        for (ds_u32 i = 0; i < bundle.info.resource_count; i++)
+        {
+            Resource_Entry* entry = Find_Resource_Entry(bundle.resource_ids[i]);
+            if (entry && entry->info.state == Resource_State::UNLOADED)
+            {
+                Schedule_Resource_Load(entry);
+            }
+        }
+    }
+
+    // Recount the resident and failed resources of a bundle
+    void Streaming_Allocator::Refresh_Bundle_State(Bundle_Entry& bundle)
+    {
+        bundle.info.resident_count = 0;
+        bundle.info.failed_count = 0;
+
+        for (ds_u32 i = 0; i < bundle.info.resource_count; i++)
+        {
+            Resource_Entry* entry = Find_Resource_Entry(bundle.resource_ids[i]);
+            if (!entry || entry->info.state == Resource_State::FAILED)
+            {
+                bundle.info.failed_count++;
+            }
+            else if (Is_Resource_Ready(entry))
+            {
+                bundle.info.resident_count++;
+            }
+        }
+
+        if (bundle.info.failed_count > 0)
+        {
+            bundle.info.state = Resource_State::FAILED;
+        }
+        else if (bundle.info.resident_count == bundle.info.resource_count)
+        {
+            bundle.info.state = Resource_State::RESIDENT;
+        }
+        else
+        {
+            bundle.info.state = Resource_State::LOADING;
+        }
+    }
+
+    // Refresh every bundle and notify the ones that just became resident
+    void Streaming_Allocator::Update_Bundle_States()
+    {
+        for (ds_u64 i = 0; i < m_bundle_count; i++)
+        {
+            Bundle_Entry& bundle = m_bundles[i];
+            Schedule_Bundle_Loads(bundle);
+            Refresh_Bundle_State(bundle);
+
+            if (bundle.info.state == Resource_State::RESIDENT && !bundle.callback_fired)
+            {
+                bundle.callback_fired = true;
+
+                if (bundle.callback)
+                {
+                    bundle.callback(bundle.info.id, bundle.user_data);
+                }
+            }
+        }
+    }
+
+    // Update distances for all resources based on player position
+    void Streaming_Allocator::Update_Resource_Distances(float player_x, float player_y, float player_z)
+    {
+        // In a real implementation, we would use the resource's world position
+        // For this example, we'll use a simple formula to simulate distance
+        // based on resource ID (just for demonstration purposes)
+
+        for (ds_u64 i = 0; i < m_resource_count; i++)
+        {
+            Resource_Entry& entry = m_resources[i];
 
             // In a real implementation, you would get the resource's world position
             // For this example, we'll derive a fake position from the resource ID
@@ -1184,7 +2247,7 @@ namespace ds::core::memory
                 // Resource has timed out, schedule for unloading
                 Schedule_Resource_Unload(&entry);
 
-                DS_LOG_TRACE("Streaming Allocator '{0}': Resource {1} timed out after {2} seconds of inactivity",
+                DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Resource {1} timed out after {2} seconds of inactivity",
                     m_name, entry.info.id, time_since_last_use / 1000);
             }
         }
@@ -1257,22 +2320,524 @@ namespace ds::core::memory
         }
 
         // Sort pending operations by priority
-        std::sort(m_pending_operations.begin(), m_pending_operations.end(),
-            [](const IO_Operation& a, const IO_Operation& b) {
-                // Higher priority comes first
-                return static_cast<int>(a.priority) < static_cast<int>(b.priority);
-            });
+        Sort_Pending_Operations();
 
         // Limit the number of pending operations
         if (m_pending_operations.size() > m_config.max_concurrent_operations * 4)
         {
             // Keep only the highest priority operations
             ds_u64 operations_to_keep = m_config.max_concurrent_operations * 4;
+
+            // Dropped operations return their resources to the state they were in before scheduling
+            for (ds_u64 i = operations_to_keep; i < m_pending_operations.size(); i++)
+            {
+                const IO_Operation& dropped = m_pending_operations[i];
+                Resource_Entry* entry = Find_Resource_Entry(dropped.resource_id);
+                if (!entry)
+                {
+                    continue;
+                }
+
+                if (dropped.type == IO_Operation::LOAD && entry->loading_scheduled)
+                {
+                    entry->loading_scheduled = false;
+                    entry->info.state = Resource_State::UNLOADED;
+                    m_stats.loading_count--;
+                }
+                else if (dropped.type == IO_Operation::UNLOAD && entry->unloading_scheduled)
+                {
+                    entry->unloading_scheduled = false;
+                    entry->info.state = Resource_State::RESIDENT;
+                }
+            }
+
             m_pending_operations.resize(operations_to_keep);
 
-            DS_LOG_TRACE("Streaming Allocator '{0}': Trimmed pending operations to {1}",
+            DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Trimmed pending operations to {1}",
                 m_name, operations_to_keep);
         }
     }
 
+    // Start the file watcher thread and watch every resident resource
+    void Streaming_Allocator::Start_Hot_Reload()
+    {
+#ifdef DS_PLATFORM_LINUX
+        if (m_watch_fd >= 0)
+        {
+            return;
+        }
+
+        m_watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_watch_fd < 0)
+        {
+            DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Failed to initialize inotify, hot reload disabled", m_name);
+            return;
+        }
+
+        m_watched_directory_count = 0;
+        for (ds_u64 i = 0; i < m_resource_count; i++)
+        {
+            if (m_resources[i].info.state == Resource_State::RESIDENT)
+            {
+                Watch_Resource_File(&m_resources[i]);
+            }
+        }
+
+        m_watch_running.store(true, std::memory_order_release);
+        m_watch_thread = std::thread(&Streaming_Allocator::Hot_Reload_Thread, this);
+#else
+        DS_LOG_CHANNEL_WARN(STREAMING, "Streaming Allocator '{0}': Hot reload is only supported on Linux", m_name);
+#endif
+    }
+
+    // Stop the file watcher thread and drop all watches
+    void Streaming_Allocator::Stop_Hot_Reload()
+    {
+        m_watch_running.store(false, std::memory_order_release);
+
+        if (m_watch_thread.joinable())
+        {
+            m_watch_thread.join();
+        }
+
+#ifdef DS_PLATFORM_LINUX
+        if (m_watch_fd >= 0)
+        {
+            // Closing the descriptor removes its watches
+            close(m_watch_fd);
+            m_watch_fd = -1;
+        }
+#endif
+
+        m_watched_directory_count = 0;
+    }
+
+    // Watch the directory of a file-backed resource; directories catch editors that save by renaming
+    void Streaming_Allocator::Watch_Resource_File(const Resource_Entry* entry)
+    {
+#ifdef DS_PLATFORM_LINUX
+        if (!entry->info.path[0] || entry->access_mode == Access_Mode::PERSISTENT_WRITE ||
+            !std::filesystem::exists(entry->info.path))
+        {
+            return;
+        }
+
+        std::string directory = std::filesystem::path(entry->info.path).parent_path().string();
+        if (directory.empty())
+        {
+            directory = ".";
+        }
+
+        for (ds_u64 i = 0; i < m_watched_directory_count; i++)
+        {
+            if (directory == m_watched_directories[i].path)
+            {
+                return;
+            }
+        }
+
+        if (m_watched_directory_count >= MAX_WATCHED_DIRECTORIES || directory.size() >= 256)
+        {
+            DS_LOG_CHANNEL_WARN(STREAMING, "Streaming Allocator '{0}': Cannot watch directory {1} for hot reload",
+                m_name, directory);
+            return;
+        }
+
+        ds_i32 watch_descriptor = inotify_add_watch(m_watch_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (watch_descriptor < 0)
+        {
+            DS_LOG_CHANNEL_WARN(STREAMING, "Streaming Allocator '{0}': Failed to watch directory {1} for hot reload",
+                m_name, directory);
+            return;
+        }
+
+        Watched_Directory& watched = m_watched_directories[m_watched_directory_count++];
+        watched.watch_descriptor = watch_descriptor;
+        Memory::Memcpy(watched.path, directory.c_str(), directory.size() + 1);
+#endif
+    }
+
+    // Watcher thread: wait for file change events and reload the affected resources
+    void Streaming_Allocator::Hot_Reload_Thread()
+    {
+#ifdef DS_PLATFORM_LINUX
+        alignas(inotify_event) ds_char buffer[4096];
+
+        while (m_watch_running.load(std::memory_order_acquire))
+        {
+            // Wake up regularly to notice when we are asked to stop
+            pollfd poll_fd = { m_watch_fd, POLLIN, 0 };
+            if (poll(&poll_fd, 1, 100) <= 0)
+            {
+                continue;
+            }
+
+            ssize_t length = read(m_watch_fd, buffer, sizeof(buffer));
+            if (length <= 0)
+            {
+                continue;
+            }
+
+            for (ds_char* cursor = buffer; cursor < buffer + length;)
+            {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(cursor);
+                cursor += sizeof(inotify_event) + event->len;
+
+                if (event->len > 0 && (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)))
+                {
+                    Reload_Changed_File(event->wd, event->name);
+                }
+            }
+        }
+#endif
+    }
+
+    // Map a changed file into fresh allocations for every resident resource that uses it
+    void Streaming_Allocator::Reload_Changed_File(ds_i32 watch_descriptor, const ds_char* file_name)
+    {
+        std::vector<Hot_Reload> reloads;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            const ds_char* directory = nullptr;
+            for (ds_u64 i = 0; i < m_watched_directory_count; i++)
+            {
+                if (m_watched_directories[i].watch_descriptor == watch_descriptor)
+                {
+                    directory = m_watched_directories[i].path;
+                    break;
+                }
+            }
+
+            if (!directory)
+            {
+                return;
+            }
+
+            const std::filesystem::path changed_path = std::filesystem::path(directory) / file_name;
+
+            for (ds_u64 i = 0; i < m_resource_count; i++)
+            {
+                const Resource_Entry& entry = m_resources[i];
+                if (entry.info.state != Resource_State::RESIDENT ||
+                    entry.access_mode == Access_Mode::PERSISTENT_WRITE ||
+                    !entry.info.path[0])
+                {
+                    continue;
+                }
+
+                std::error_code error;
+                if (!std::filesystem::equivalent(changed_path, entry.info.path, error))
+                {
+                    continue;
+                }
+
+                // Whole files take the new file size, resources inside a package keep theirs
+                ds_u64 file_size = std::filesystem::file_size(changed_path, error);
+                if (error || file_size <= entry.file_offset)
+                {
+                    continue;
+                }
+
+                ds_u64 size = entry.file_offset == 0 ? file_size : std::min(entry.info.size, file_size - entry.file_offset);
+                Page_Protection protection = entry.access_mode == Access_Mode::READ_ONLY ?
+                    Page_Protection::READ_ONLY : Page_Protection::READ_WRITE;
+
+                void* data = m_page_allocator.Allocate(size, protection, Page_Flags::COMMIT,
+                    entry.info.path, entry.file_offset);
+                if (!data)
+                {
+                    DS_LOG_CHANNEL_ERROR(STREAMING, "Streaming Allocator '{0}': Failed to reload file {1}", m_name, entry.info.path);
+                    continue;
+                }
+
+                reloads.push_back({ entry.info.id, data, size });
+            }
+        }
+
+        // Fault the new pages in here so Update only has to swap pointers
+        const ds_u64 system_page_size = Page_Allocator::Get_System_Page_Size();
+        for (const Hot_Reload& reload : reloads)
+        {
+            const volatile ds_u8* bytes = static_cast<const volatile ds_u8*>(reload.data);
+            for (ds_u64 offset = 0; offset < reload.size; offset += system_page_size)
+            {
+                (void)bytes[offset];
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (const Hot_Reload& reload : reloads)
+        {
+            // A newer reload replaces one that has not been applied yet
+            for (Hot_Reload& pending : m_completed_reloads)
+            {
+                if (pending.resource_id == reload.resource_id)
+                {
+                    m_page_allocator.Deallocate(pending.data);
+                    pending.data = nullptr;
+                }
+            }
+
+            std::erase_if(m_completed_reloads, [](const Hot_Reload& pending) { return pending.data == nullptr; });
+            m_completed_reloads.push_back(reload);
+        }
+    }
+
+    // Swap reloaded data into its resources and notify through their callbacks
+    void Streaming_Allocator::Apply_Hot_Reloads()
+    {
+        for (Hot_Reload& reload : m_completed_reloads)
+        {
+            Resource_Entry* entry = Find_Resource_Entry(reload.resource_id);
+            if (!entry || entry->info.state != Resource_State::RESIDENT)
+            {
+                // The resource went away while it was being reloaded
+                m_page_allocator.Deallocate(reload.data);
+                reload.data = nullptr;
+                continue;
+            }
+
+            // Referenced data may still be in use, so the swap waits until every reference is released
+            if (entry->info.reference_count > 0)
+            {
+                continue;
+            }
+
+            // A file that grew is charged to the budget like a load of the extra bytes
+            if (reload.size > entry->info.size)
+            {
+                const ds_u64 growth = reload.size - entry->info.size;
+                if (!Has_Available_Memory(entry->info.category, growth))
+                {
+                    // Retry once the evictions queued for it have run
+                    if (m_config.enable_adaptive_budgets && Reclaim_Borrowed_Memory(entry->info.category, growth))
+                    {
+                        continue;
+                    }
+
+                    DS_LOG_CHANNEL_WARN(STREAMING, "Streaming Allocator '{0}': Not enough memory to hot reload resource {1}, keeping the old data",
+                        m_name, entry->info.id);
+
+                    m_telemetry.budget_rejections[static_cast<int>(entry->info.category)].fetch_add(1, std::memory_order_relaxed);
+                    m_page_allocator.Deallocate(reload.data);
+                    reload.data = nullptr;
+                    continue;
+                }
+            }
+
+            void* old_data = entry->data;
+            const ds_i64 size_delta = static_cast<ds_i64>(reload.size) - static_cast<ds_i64>(entry->info.size);
+
+            entry->data = reload.data;
+            entry->info.size = reload.size;
+            reload.data = nullptr;
+            Update_Memory_Usage(entry->info.category, size_delta);
+
+            if (old_data)
+            {
+                m_page_allocator.Deallocate(old_data);
+            }
+
+            m_stats.hot_reload_count++;
+
+            DS_LOG_CHANNEL_TRACE(STREAMING, "Streaming Allocator '{0}': Hot reloaded resource {1} from {2}",
+                m_name, entry->info.id, entry->info.path);
+
+            if (entry->callback)
+            {
+                entry->callback(entry->info.id, entry->data, entry->info.size, entry->user_data);
+            }
+        }
+
+        // Reloads that are still waiting stay queued
+        std::erase_if(m_completed_reloads, [](const Hot_Reload& reload) { return reload.data == nullptr; });
+    }
+
+    // Upper bound of the bucket that contains the requested percentile
+    ds_u64 Streaming_Allocator::Latency_Histogram::Percentile_US(ds_f32 percentile) const
+    {
+        if (sample_count == 0)
+        {
+            return 0;
+        }
+
+        ds_u64 target = static_cast<ds_u64>(std::ceil(sample_count * (percentile / 100.0f)));
+        target = std::clamp<ds_u64>(target, 1, sample_count);
+
+        ds_u64 accumulated = 0;
+        for (ds_u32 i = 0; i < BUCKET_COUNT; i++)
+        {
+            accumulated += buckets[i];
+            if (accumulated >= target)
+            {
+                return std::min(ds_u64(1) << (i + 1), max_us);
+            }
+        }
+
+        return max_us;
+    }
+
+    void Streaming_Allocator::Atomic_Histogram::Record(ds_u64 sample_us)
+    {
+        // Bucket index is floor(log2(sample)), clamped to the last bucket
+        ds_u32 index = sample_us ? static_cast<ds_u32>(std::bit_width(sample_us) - 1) : 0;
+        index = std::min(index, Latency_Histogram::BUCKET_COUNT - 1);
+
+        buckets[index].fetch_add(1, std::memory_order_relaxed);
+        sample_count.fetch_add(1, std::memory_order_relaxed);
+        total_us.fetch_add(sample_us, std::memory_order_relaxed);
+
+        // Writers are serialized by the allocator mutex, so a plain compare is enough
+        if (sample_us > max_us.load(std::memory_order_relaxed))
+        {
+            max_us.store(sample_us, std::memory_order_relaxed);
+        }
+    }
+
+    void Streaming_Allocator::Atomic_Histogram::Load(Latency_Histogram& out) const
+    {
+        for (ds_u32 i = 0; i < Latency_Histogram::BUCKET_COUNT; i++)
+        {
+            out.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+        }
+        out.sample_count = sample_count.load(std::memory_order_relaxed);
+        out.total_us = total_us.load(std::memory_order_relaxed);
+        out.max_us = max_us.load(std::memory_order_relaxed);
+    }
+
+    void Streaming_Allocator::Atomic_Histogram::Store(const Latency_Histogram& in)
+    {
+        for (ds_u32 i = 0; i < Latency_Histogram::BUCKET_COUNT; i++)
+        {
+            buckets[i].store(in.buckets[i], std::memory_order_relaxed);
+        }
+        sample_count.store(in.sample_count, std::memory_order_relaxed);
+        total_us.store(in.total_us, std::memory_order_relaxed);
+        max_us.store(in.max_us, std::memory_order_relaxed);
+    }
+
+    void Streaming_Allocator::Rolling_Counter::Add(ds_u64 now_us, ds_u64 value)
+    {
+        // Slots store second + 1 so that zero means "never used"
+        const ds_u64 stamp = now_us / 1000000 + 1;
+        const ds_u32 slot = static_cast<ds_u32>(stamp % WINDOW_SECONDS);
+
+        if (slot_second[slot].load(std::memory_order_relaxed) != stamp)
+        {
+            slot_value[slot].store(value, std::memory_order_relaxed);
+            slot_second[slot].store(stamp, std::memory_order_release);
+        }
+        else
+        {
+            slot_value[slot].fetch_add(value, std::memory_order_relaxed);
+        }
+    }
+
+    void Streaming_Allocator::Rolling_Counter::Reset(ds_u64 now_us)
+    {
+        for (ds_u32 i = 0; i < WINDOW_SECONDS; i++)
+        {
+            slot_second[i].store(0, std::memory_order_relaxed);
+            slot_value[i].store(0, std::memory_order_relaxed);
+        }
+        start_us.store(now_us, std::memory_order_relaxed);
+    }
+
+    ds_f64 Streaming_Allocator::Rolling_Counter::Rate_Per_Second(ds_u64 now_us) const
+    {
+        const ds_u64 now_stamp = now_us / 1000000 + 1;
+        ds_u64 total = 0;
+
+        for (ds_u32 i = 0; i < WINDOW_SECONDS; i++)
+        {
+            const ds_u64 stamp = slot_second[i].load(std::memory_order_acquire);
+            if (stamp != 0 && now_stamp - stamp < WINDOW_SECONDS)
+            {
+                total += slot_value[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        // The window spans the previous whole seconds plus the elapsed part of the current one,
+        // and cannot reach back before the counter started
+        const ds_u64 now_second = now_us / 1000000;
+        ds_u64 window_start_us = now_second >= WINDOW_SECONDS - 1 ? (now_second - (WINDOW_SECONDS - 1)) * 1000000 : 0;
+        window_start_us = std::max(window_start_us, start_us.load(std::memory_order_relaxed));
+
+        const ds_u64 covered_us = now_us > window_start_us ? now_us - window_start_us : 1;
+        return static_cast<ds_f64>(total) * 1000000.0 / static_cast<ds_f64>(covered_us);
+    }
+
+    void Streaming_Allocator::Rolling_Counter::Copy_From(const Rolling_Counter& other)
+    {
+        for (ds_u32 i = 0; i < WINDOW_SECONDS; i++)
+        {
+            slot_second[i].store(other.slot_second[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            slot_value[i].store(other.slot_value[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        start_us.store(other.start_us.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    void Streaming_Allocator::Telemetry::Copy_From(const Telemetry& other)
+    {
+        Latency_Histogram histogram;
+
+        for (ds_u32 i = 0; i < CATEGORY_COUNT; i++)
+        {
+            other.category_latency[i].Load(histogram);
+            category_latency[i].Store(histogram);
+            budget_rejections[i].store(other.budget_rejections[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            evictions[i].store(other.evictions[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            evicted_bytes[i].store(other.evicted_bytes[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        for (ds_u32 i = 0; i < PRIORITY_COUNT; i++)
+        {
+            other.priority_latency[i].Load(histogram);
+            priority_latency[i].Store(histogram);
+        }
+
+        for (ds_u32 i = 0; i < PHASE_COUNT; i++)
+        {
+            other.phase_latency[i].Load(histogram);
+            phase_latency[i].Store(histogram);
+        }
+
+        reloads_after_eviction.store(other.reloads_after_eviction.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        bandwidth.Copy_From(other.bandwidth);
+        eviction_rate.Copy_From(other.eviction_rate);
+    }
+
+    void Streaming_Allocator::Telemetry::Reset()
+    {
+        Telemetry_Snapshot empty;
+        Memory::Memset(&empty, 0, sizeof(empty));
+
+        for (ds_u32 i = 0; i < CATEGORY_COUNT; i++)
+        {
+            category_latency[i].Store(empty.category_latency[i]);
+            budget_rejections[i].store(0, std::memory_order_relaxed);
+            evictions[i].store(0, std::memory_order_relaxed);
+            evicted_bytes[i].store(0, std::memory_order_relaxed);
+        }
+
+        for (ds_u32 i = 0; i < PRIORITY_COUNT; i++)
+        {
+            priority_latency[i].Store(empty.priority_latency[i]);
+        }
+
+        for (ds_u32 i = 0; i < PHASE_COUNT; i++)
+        {
+            phase_latency[i].Store(empty.phase_latency[i]);
+        }
+
+        reloads_after_eviction.store(0, std::memory_order_relaxed);
+
+        const ds_u64 now_us = GetCurrentTimeUS();
+        bandwidth.Reset(now_us);
+        eviction_rate.Reset(now_us);
+    }
+
 }
\ No newline at end of file
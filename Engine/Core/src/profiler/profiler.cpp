@@ -0,0 +1,514 @@
+#include <core/ds_pch.h>
+#include <core/profiler/profiler.h>
+#include <core/containers/dspsc_ring.h>
+
+#include <map>
+
+namespace ds::core::profiler
+{
+    /////////////////////////////////////////////////////////
+    // Profile_Clock
+    /////////////////////////////////////////////////////////
+
+    void Profile_Clock::Calibrate(ds_u32 milliseconds)
+    {
+        Platform_Time::Initialize();
+
+#ifdef DS_PROFILER_RDTSC
+        ds_u64 start_microseconds = Platform_Time::Get_Time_Microseconds();
+        ds_u64 start_ticks = Now();
+        Platform_Time::Sleep(milliseconds);
+        ds_u64 end_microseconds = Platform_Time::Get_Time_Microseconds();
+        ds_u64 end_ticks = Now();
+
+        if (end_microseconds > start_microseconds)
+        {
+            s_ticks_per_microsecond = static_cast<ds_f64>(end_ticks - start_ticks) / static_cast<ds_f64>(end_microseconds - start_microseconds);
+        }
+        s_anchor_ticks = end_ticks;
+        s_anchor_microseconds = end_microseconds;
+#else
+        // Ticks already are Platform_Time microseconds
+        (void)milliseconds;
+        s_ticks_per_microsecond = 1.0;
+        s_anchor_ticks = 0;
+        s_anchor_microseconds = 0;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////
+    // Profile_Frame
+    /////////////////////////////////////////////////////////
+
+    const Profile_Node* Profile_Frame::Find_Node(ds_u32 thread, std::string_view name) const
+    {
+        for (const Profile_Thread& profile_thread : threads)
+        {
+            if (profile_thread.id != thread)
+            {
+                continue;
+            }
+
+            for (const Profile_Node& node : profile_thread.nodes)
+            {
+                if (name == node.name)
+                {
+                    return &node;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////
+    // Profiler
+    /////////////////////////////////////////////////////////
+
+    // Heap storage for thread rings, the profiler has to work without the Memory system so
+    // allocators can be profiled too
+    template<typename T>
+    class Profile_Ring_Allocator
+    {
+    public:
+        using value_type = T;
+
+        Profile_Ring_Allocator() = default;
+
+        template<typename U>
+        Profile_Ring_Allocator(const Profile_Ring_Allocator<U>&) {}
+
+        T* allocate(ds_u64 n)
+        {
+            return static_cast<T*>(::operator new(sizeof(T) * n, std::align_val_t{ alignof(T) }));
+        }
+
+        void deallocate(T* p, ds_u64)
+        {
+            ::operator delete(p, std::align_val_t{ alignof(T) });
+        }
+    };
+
+    struct Profile_Thread_Buffer_Owner;
+
+    /**
+     * One recording thread's zones and allocator events. The thread is the only producer and
+     * End_Frame the only consumer.
+     */
+    struct Profile_Thread_Buffer
+    {
+        Profile_Thread_Buffer(const Profiler::Config& config, ds_u32 thread_id)
+            : ring(config.thread_buffer_capacity),
+              allocations(config.record_allocations ? config.allocation_buffer_capacity : 1),
+              id(thread_id)
+        {
+        }
+
+        containers::DSPSC_Ring<Profile_Zone, Profile_Ring_Allocator<Profile_Zone>> ring;
+        containers::DSPSC_Ring<Profile_Allocation, Profile_Ring_Allocator<Profile_Allocation>> allocations;
+        ds_u32 id;
+        std::string name;                       ///< Guarded by s_profiler_mutex
+        std::atomic<bool> retired{ false };     ///< Set once the owning thread has exited
+        Profile_Thread_Buffer_Owner* owner = nullptr;   ///< Guarded by s_profiler_mutex, nullptr once retired
+        std::atomic<ds_u64> dropped{ 0 };       ///< Producer counts, End_Frame collects
+    };
+
+    struct Profiler::State
+    {
+        Config config;
+        std::vector<Profile_Thread_Buffer*> buffers;    ///< Guarded by s_profiler_mutex
+        ds_u32 next_thread_id = 0;
+        ds_u64 generation = 0;
+
+        ds_u64 next_frame_index = 0;
+        ds_u64 frame_begin = 0;
+        Profile_Frame last_frame;
+        std::atomic<ds_u64> dropped_zone_count{ 0 };
+    };
+
+    // Guards the thread buffer list and s_state against threads registering and exiting
+    static std::mutex s_profiler_mutex;
+
+    // Counts Initialize calls, buffers of an earlier initialization are gone
+    static std::atomic<ds_u64> s_profiler_generation{ 0 };
+
+    // Name given with Set_Thread_Name, kept for buffers registered after it
+    static thread_local std::string t_profile_thread_name;
+
+    // Retires the calling thread's buffer when the thread exits, End_Frame frees it once drained
+    struct Profile_Thread_Buffer_Owner
+    {
+        Profile_Thread_Buffer* buffer = nullptr;
+        ds_u64 generation = 0;
+        std::atomic<bool> writing{ false };     ///< Set while the thread pushes into buffer
+
+        ~Profile_Thread_Buffer_Owner()
+        {
+            std::lock_guard<std::mutex> lock(s_profiler_mutex);
+            if (buffer && generation == s_profiler_generation.load(std::memory_order_relaxed))
+            {
+                buffer->owner = nullptr;
+                buffer->retired.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    static thread_local Profile_Thread_Buffer_Owner t_profile_thread_buffer;
+
+    // Helper function to get the calling thread's buffer without the lock once it is registered
+    static Profile_Thread_Buffer* Find_Thread_Buffer()
+    {
+        Profile_Thread_Buffer* buffer = t_profile_thread_buffer.buffer;
+        if (buffer && t_profile_thread_buffer.generation == s_profiler_generation.load(std::memory_order_relaxed))
+        {
+            return buffer;
+        }
+        return nullptr;
+    }
+
+    // Helper function to get the calling thread's registered buffer and flag the thread as
+    // writing to it, End_Write has to follow. Returns nullptr if the buffer is not registered
+    // or belongs to an earlier initialization.
+    static Profile_Thread_Buffer* Begin_Write()
+    {
+        Profile_Thread_Buffer_Owner& owner = t_profile_thread_buffer;
+        if (!owner.buffer)
+        {
+            return nullptr;
+        }
+
+        // Pairs with Shutdown, which moves the generation on before checking the flag: either
+        // this sees the new generation or Shutdown waits for End_Write
+        owner.writing.store(true, std::memory_order_seq_cst);
+        if (owner.generation == s_profiler_generation.load(std::memory_order_seq_cst))
+        {
+            return owner.buffer;
+        }
+
+        owner.writing.store(false, std::memory_order_release);
+        return nullptr;
+    }
+
+    static void End_Write()
+    {
+        t_profile_thread_buffer.writing.store(false, std::memory_order_release);
+    }
+
+    Profile_Thread_Buffer* Profiler::Get_Thread_Buffer()
+    {
+        if (Profile_Thread_Buffer* buffer = Find_Thread_Buffer())
+        {
+            return buffer;
+        }
+
+        State& state = *s_state;
+        Profile_Thread_Buffer* buffer = new Profile_Thread_Buffer(state.config, state.next_thread_id++);
+        buffer->name = t_profile_thread_name;
+        buffer->owner = &t_profile_thread_buffer;
+        state.buffers.push_back(buffer);
+
+        t_profile_thread_buffer.buffer = buffer;
+        t_profile_thread_buffer.generation = s_profiler_generation.load(std::memory_order_relaxed);
+        return buffer;
+    }
+
+    // Helper function to merge one thread's zones, sorted by begin, into a call tree
+    static void Build_Call_Tree(const Profile_Zone* zones, ds_u64 count, std::vector<Profile_Node>& nodes)
+    {
+        // Nodes in the order they were first seen, with their children in the same order
+        std::vector<Profile_Node> found;
+        std::vector<std::vector<ds_u32>> children;
+        std::vector<ds_u32> roots;
+        std::map<std::pair<ds_u32, std::string_view>, ds_u32> lookup;
+        std::vector<ds_u32> open;
+
+        for (ds_u64 i = 0; i < count; i++)
+        {
+            const Profile_Zone& zone = zones[i];
+
+            // A zone whose parents ended in an earlier frame hangs off the deepest one still open
+            while (open.size() > zone.depth)
+            {
+                open.pop_back();
+            }
+
+            ds_u32 parent = open.empty() ? PROFILE_NO_PARENT : open.back();
+            auto [it, inserted] = lookup.try_emplace({ parent, zone.name }, static_cast<ds_u32>(found.size()));
+            if (inserted)
+            {
+                ds_u32 depth = parent == PROFILE_NO_PARENT ? 0 : found[parent].depth + 1;
+                found.push_back(Profile_Node{ zone.name, parent, depth, 0, 0.0, 0.0 });
+                children.emplace_back();
+                (parent == PROFILE_NO_PARENT ? roots : children[parent]).push_back(it->second);
+            }
+
+            Profile_Node& node = found[it->second];
+            node.call_count++;
+            node.total_microseconds += Profile_Clock::Get_Microseconds(zone.end - zone.begin);
+            open.push_back(it->second);
+        }
+
+        for (Profile_Node& node : found)
+        {
+            node.self_microseconds = node.total_microseconds;
+        }
+        for (const Profile_Node& node : found)
+        {
+            if (node.parent != PROFILE_NO_PARENT)
+            {
+                found[node.parent].self_microseconds -= node.total_microseconds;
+            }
+        }
+
+        // Write the nodes out depth first, remapping the parent indices
+        std::vector<ds_u32> new_index(found.size());
+        std::vector<ds_u32> pending(roots.rbegin(), roots.rend());
+        nodes.clear();
+        nodes.reserve(found.size());
+        while (!pending.empty())
+        {
+            ds_u32 index = pending.back();
+            pending.pop_back();
+
+            Profile_Node node = found[index];
+            node.self_microseconds = std::max(node.self_microseconds, 0.0);
+            if (node.parent != PROFILE_NO_PARENT)
+            {
+                node.parent = new_index[node.parent];
+            }
+            new_index[index] = static_cast<ds_u32>(nodes.size());
+            nodes.push_back(node);
+
+            pending.insert(pending.end(), children[index].rbegin(), children[index].rend());
+        }
+    }
+
+    void Profiler::Initialize()
+    {
+        Initialize(Config{});
+    }
+
+    void Profiler::Initialize(const Config& config)
+    {
+        if (s_state)
+        {
+            DS_LOG_CHANNEL_WARN(PROFILER, "Profiler: Already initialized");
+            return;
+        }
+
+        Profile_Clock::Calibrate(config.calibration_milliseconds);
+
+        {
+            std::lock_guard<std::mutex> lock(s_profiler_mutex);
+            s_state = new State();
+            s_state->config = config;
+            s_state->generation = s_profiler_generation.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        s_recording_allocations.store(config.record_allocations);
+        s_recording.store(true);
+
+        DS_LOG_CHANNEL_INFO(PROFILER, "Profiler: Clock runs at {0} ticks per microsecond", Profile_Clock::Get_Ticks_Per_Microsecond());
+    }
+
+    void Profiler::Shutdown()
+    {
+        if (!s_state)
+        {
+            return;
+        }
+
+        s_recording.store(false);
+        s_recording_allocations.store(false);
+
+        std::lock_guard<std::mutex> lock(s_profiler_mutex);
+
+        // Owners of the deleted buffers see a new generation and leave them alone. Threads
+        // flagged as writing after this got their buffer before and are waited for.
+        s_profiler_generation.fetch_add(1, std::memory_order_seq_cst);
+        for (Profile_Thread_Buffer* buffer : s_state->buffers)
+        {
+            // Owners only go away under the mutex, and writers never take it
+            while (buffer->owner && buffer->owner->writing.load(std::memory_order_seq_cst))
+            {
+                std::this_thread::yield();
+            }
+            delete buffer;
+        }
+
+        delete s_state;
+        s_state = nullptr;
+    }
+
+    void Profiler::Set_Thread_Name(std::string_view name)
+    {
+        t_profile_thread_name.assign(name);
+
+        std::lock_guard<std::mutex> lock(s_profiler_mutex);
+        if (s_state)
+        {
+            Get_Thread_Buffer()->name = t_profile_thread_name;
+        }
+    }
+
+    void Profiler::Begin_Frame()
+    {
+        if (!s_state)
+        {
+            return;
+        }
+
+        s_state->frame_begin = Profile_Clock::Now();
+    }
+
+    void Profiler::End_Frame()
+    {
+        if (!s_state)
+        {
+            return;
+        }
+
+        State& state = *s_state;
+        Profile_Frame& frame = state.last_frame;
+        frame.index = state.next_frame_index++;
+        frame.begin = state.frame_begin;
+        frame.end = Profile_Clock::Now();
+        frame.dropped_zone_count = 0;
+        frame.zones.clear();
+        frame.allocations.clear();
+        frame.threads.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(s_profiler_mutex);
+
+            ds_u64 i = 0;
+            while (i < state.buffers.size())
+            {
+                Profile_Thread_Buffer* buffer = state.buffers[i];
+
+                // Read before draining: a thread retires only after its last zone
+                bool retired = buffer->retired.load(std::memory_order_acquire);
+
+                ds_u64 first_zone = frame.zones.size();
+                Profile_Zone zone;
+                while (buffer->ring.try_pop(zone))
+                {
+                    frame.zones.push_back(zone);
+                }
+
+                ds_u64 first_allocation = frame.allocations.size();
+                Profile_Allocation allocation;
+                while (buffer->allocations.try_pop(allocation))
+                {
+                    frame.allocations.push_back(allocation);
+                }
+
+                if (frame.zones.size() > first_zone || frame.allocations.size() > first_allocation)
+                {
+                    frame.threads.push_back(Profile_Thread{ buffer->id, buffer->name, {} });
+                }
+                frame.dropped_zone_count += buffer->dropped.exchange(0, std::memory_order_relaxed);
+
+                if (retired)
+                {
+                    delete buffer;
+                    state.buffers[i] = state.buffers.back();
+                    state.buffers.pop_back();
+                }
+                else
+                {
+                    i++;
+                }
+            }
+        }
+
+        state.dropped_zone_count.fetch_add(frame.dropped_zone_count, std::memory_order_relaxed);
+
+        // Parents begin before their children, and at the same tick sit less deep
+        std::sort(frame.zones.begin(), frame.zones.end(), [](const Profile_Zone& a, const Profile_Zone& b) {
+            if (a.thread != b.thread)
+                return a.thread < b.thread;
+            if (a.begin != b.begin)
+                return a.begin < b.begin;
+            return a.depth < b.depth;
+        });
+        std::stable_sort(frame.allocations.begin(), frame.allocations.end(), [](const Profile_Allocation& a, const Profile_Allocation& b) {
+            return a.time < b.time;
+        });
+        std::sort(frame.threads.begin(), frame.threads.end(), [](const Profile_Thread& a, const Profile_Thread& b) {
+            return a.id < b.id;
+        });
+
+        ds_u64 first = 0;
+        for (Profile_Thread& thread : frame.threads)
+        {
+            ds_u64 last = first;
+            while (last < frame.zones.size() && frame.zones[last].thread == thread.id)
+            {
+                last++;
+            }
+
+            Build_Call_Tree(frame.zones.data() + first, last - first, thread.nodes);
+            first = last;
+        }
+    }
+
+    const Profile_Frame& Profiler::Get_Last_Frame()
+    {
+        static const Profile_Frame empty_frame;
+        return s_state ? s_state->last_frame : empty_frame;
+    }
+
+    ds_u64 Profiler::Get_Dropped_Zone_Count()
+    {
+        return s_state ? s_state->dropped_zone_count.load(std::memory_order_relaxed) : 0;
+    }
+
+    void Profiler::Record_Zone(const char* name, ds_u64 begin, ds_u64 end, ds_u32 depth, Profile_Category category, ds_u64 value)
+    {
+        Profile_Thread_Buffer* buffer = Begin_Write();
+        if (!buffer)
+        {
+            std::lock_guard<std::mutex> lock(s_profiler_mutex);
+            if (!s_state)
+            {
+                return;
+            }
+
+            // Can't fail with the mutex held, Shutdown has to wait for it
+            Get_Thread_Buffer();
+            buffer = Begin_Write();
+        }
+
+        if (!buffer->ring.try_emplace(Profile_Zone{ name, begin, end, value, depth, buffer->id, category }))
+        {
+            buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        End_Write();
+    }
+
+    void Profiler::Record_Allocation_Event(const char* allocator, const void* address, ds_u64 size, bool is_free)
+    {
+        ds_u64 time = Profile_Clock::Now();
+
+        Profile_Thread_Buffer* buffer = Begin_Write();
+        if (!buffer)
+        {
+            std::lock_guard<std::mutex> lock(s_profiler_mutex);
+            if (!s_state)
+            {
+                return;
+            }
+
+            // Can't fail with the mutex held, Shutdown has to wait for it
+            Get_Thread_Buffer();
+            buffer = Begin_Write();
+        }
+
+        if (!buffer->allocations.try_emplace(Profile_Allocation{ allocator, address, size, time, buffer->id, is_free }))
+        {
+            buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        End_Write();
+    }
+}
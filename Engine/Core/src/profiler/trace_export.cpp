@@ -0,0 +1,615 @@
+#include <core/ds_pch.h>
+#include <core/profiler/trace_export.h>
+
+#include <charconv>
+
+namespace ds::core::profiler
+{
+    namespace
+    {
+        const char* Get_Category_Name(Profile_Category category)
+        {
+            switch (category)
+            {
+            case Profile_Category::STREAMING: return "streaming";
+            case Profile_Category::LOGGER:    return "logger";
+            default:                          return "zone";
+            }
+        }
+
+        // Name of a zone's value in the exported event arguments
+        const char* Get_Value_Name(Profile_Category category)
+        {
+            switch (category)
+            {
+            case Profile_Category::STREAMING: return "resource_id";
+            case Profile_Category::LOGGER:    return "messages";
+            default:                          return "value";
+            }
+        }
+
+        template<typename T>
+        void Append_Number(std::string& out, T value, int base = 10)
+        {
+            char digits[32];
+            auto result = std::to_chars(digits, digits + sizeof(digits), value, base);
+            out.append(digits, result.ptr);
+        }
+
+        // Chrome traces count microseconds, three decimals keep the nanoseconds
+        void Append_Microseconds(std::string& out, ds_u64 nanoseconds)
+        {
+            Append_Number(out, nanoseconds / 1000);
+            ds_u64 fraction = nanoseconds % 1000;
+            out += '.';
+            out += static_cast<char>('0' + fraction / 100);
+            out += static_cast<char>('0' + fraction / 10 % 10);
+            out += static_cast<char>('0' + fraction % 10);
+        }
+
+        void Append_Json_String(std::string& out, std::string_view text)
+        {
+            out += '"';
+            for (char c : text)
+            {
+                switch (c)
+                {
+                case '"':  out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        out += "\\u00";
+                        out += "0123456789abcdef"[(c >> 4) & 0xF];
+                        out += "0123456789abcdef"[c & 0xF];
+                    }
+                    else
+                    {
+                        out += c;
+                    }
+                    break;
+                }
+            }
+            out += '"';
+        }
+
+        /////////////////////////////////////////////////////////
+        // Protobuf encoding, see protos/perfetto/trace in the Perfetto repository
+        /////////////////////////////////////////////////////////
+
+        enum Wire_Type : ds_u32
+        {
+            WIRE_VARINT = 0,
+            WIRE_LENGTH_DELIMITED = 2
+        };
+
+        // Trace
+        constexpr ds_u32 TRACE_PACKET = 1;
+
+        // TracePacket
+        constexpr ds_u32 PACKET_TIMESTAMP = 8;
+        constexpr ds_u32 PACKET_SEQUENCE_ID = 10;
+        constexpr ds_u32 PACKET_TRACK_EVENT = 11;
+        constexpr ds_u32 PACKET_SEQUENCE_FLAGS = 13;
+        constexpr ds_u32 PACKET_TRACK_DESCRIPTOR = 60;
+        constexpr ds_u64 SEQUENCE_INCREMENTAL_STATE_CLEARED = 1;
+
+        // TrackDescriptor
+        constexpr ds_u32 TRACK_UUID = 1;
+        constexpr ds_u32 TRACK_NAME = 2;
+        constexpr ds_u32 TRACK_PROCESS = 3;
+        constexpr ds_u32 TRACK_THREAD = 4;
+        constexpr ds_u32 TRACK_PARENT_UUID = 5;
+        constexpr ds_u32 TRACK_COUNTER = 8;
+
+        // ProcessDescriptor, ThreadDescriptor and CounterDescriptor
+        constexpr ds_u32 PROCESS_PID = 1;
+        constexpr ds_u32 PROCESS_NAME = 6;
+        constexpr ds_u32 THREAD_PID = 1;
+        constexpr ds_u32 THREAD_TID = 2;
+        constexpr ds_u32 THREAD_NAME = 5;
+        constexpr ds_u32 COUNTER_UNIT = 3;
+        constexpr ds_u64 COUNTER_UNIT_SIZE_BYTES = 3;
+
+        // TrackEvent
+        constexpr ds_u32 EVENT_DEBUG_ANNOTATION = 4;
+        constexpr ds_u32 EVENT_TYPE = 9;
+        constexpr ds_u32 EVENT_TRACK_UUID = 11;
+        constexpr ds_u32 EVENT_CATEGORY = 22;
+        constexpr ds_u32 EVENT_NAME = 23;
+        constexpr ds_u32 EVENT_COUNTER_VALUE = 30;
+        constexpr ds_u64 EVENT_SLICE_BEGIN = 1;
+        constexpr ds_u64 EVENT_SLICE_END = 2;
+        constexpr ds_u64 EVENT_INSTANT = 3;
+        constexpr ds_u64 EVENT_COUNTER = 4;
+
+        // DebugAnnotation
+        constexpr ds_u32 ANNOTATION_UINT = 3;
+        constexpr ds_u32 ANNOTATION_STRING = 6;
+        constexpr ds_u32 ANNOTATION_POINTER = 7;
+        constexpr ds_u32 ANNOTATION_NAME = 10;
+
+        // Track uuids, all tracks belong to one process track
+        constexpr ds_u64 PROCESS_TRACK = 1;
+        constexpr ds_u64 FRAME_TRACK = 2;
+        constexpr ds_u64 THREAD_TRACK_BASE = 0x100;
+        constexpr ds_u64 COUNTER_TRACK_BASE = 0x10000;
+        constexpr ds_u64 TRACE_PID = 1;
+        constexpr ds_u64 TRACE_SEQUENCE_ID = 1;
+
+        void Append_Varint(std::string& out, ds_u64 value)
+        {
+            while (value >= 0x80)
+            {
+                out += static_cast<char>((value & 0x7F) | 0x80);
+                value >>= 7;
+            }
+            out += static_cast<char>(value);
+        }
+
+        void Append_Varint_Field(std::string& out, ds_u32 field, ds_u64 value)
+        {
+            Append_Varint(out, (field << 3) | WIRE_VARINT);
+            Append_Varint(out, value);
+        }
+
+        // Strings and nested messages
+        void Append_Bytes_Field(std::string& out, ds_u32 field, std::string_view bytes)
+        {
+            Append_Varint(out, (field << 3) | WIRE_LENGTH_DELIMITED);
+            Append_Varint(out, bytes.size());
+            out.append(bytes);
+        }
+
+        std::string Encode_Track_Event(ds_u64 type, ds_u64 track, const char* category, std::string_view name)
+        {
+            std::string event;
+            Append_Varint_Field(event, EVENT_TYPE, type);
+            Append_Varint_Field(event, EVENT_TRACK_UUID, track);
+            if (category)
+            {
+                Append_Bytes_Field(event, EVENT_CATEGORY, category);
+            }
+            if (!name.empty())
+            {
+                Append_Bytes_Field(event, EVENT_NAME, name);
+            }
+            return event;
+        }
+
+        void Append_Annotation(std::string& event, std::string_view name, ds_u32 field, ds_u64 value)
+        {
+            std::string annotation;
+            Append_Bytes_Field(annotation, ANNOTATION_NAME, name);
+            Append_Varint_Field(annotation, field, value);
+            Append_Bytes_Field(event, EVENT_DEBUG_ANNOTATION, annotation);
+        }
+
+        void Append_Annotation(std::string& event, std::string_view name, std::string_view value)
+        {
+            std::string annotation;
+            Append_Bytes_Field(annotation, ANNOTATION_NAME, name);
+            Append_Bytes_Field(annotation, ANNOTATION_STRING, value);
+            Append_Bytes_Field(event, EVENT_DEBUG_ANNOTATION, annotation);
+        }
+    }
+
+    /////////////////////////////////////////////////////////
+    // Trace_Exporter
+    /////////////////////////////////////////////////////////
+
+    Trace_Exporter::Trace_Exporter(const std::string& path, ds_u64 buffer_size)
+        : m_buffer_size(buffer_size)
+    {
+        m_file.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_file.is_open())
+        {
+            DS_LOG_CHANNEL_ERROR(PROFILER, "Trace_Exporter: Failed to open {0}", path);
+            return;
+        }
+
+        m_buffer.reserve(m_buffer_size);
+    }
+
+    void Trace_Exporter::Add_Frame(const Profile_Frame& frame)
+    {
+        if (!m_file.is_open() || m_finished)
+        {
+            return;
+        }
+
+        Begin();
+
+        for (const Profile_Thread& thread : frame.threads)
+        {
+            auto [it, inserted] = m_thread_names.try_emplace(thread.id, thread.name);
+            if (inserted || it->second != thread.name)
+            {
+                it->second = thread.name;
+                Write_Thread(thread.id, thread.name);
+            }
+        }
+
+        Write_Frame(frame);
+
+        // Zones are ordered by thread first
+        ds_u64 first = 0;
+        while (first < frame.zones.size())
+        {
+            ds_u32 thread = frame.zones[first].thread;
+            ds_u64 last = first + 1;
+            while (last < frame.zones.size() && frame.zones[last].thread == thread)
+            {
+                last++;
+            }
+
+            Write_Zones(thread, std::span<const Profile_Zone>(frame.zones.data() + first, last - first));
+            first = last;
+
+            if (m_buffer.size() >= m_buffer_size)
+            {
+                Write_Buffer();
+            }
+        }
+
+        for (const Profile_Allocation& allocation : frame.allocations)
+        {
+            ds_u32 index = Get_Allocator_Index(allocation.allocator);
+            Allocator_Track& track = m_allocators[index];
+
+            if (allocation.is_free)
+            {
+                // Blocks allocated before the first frame have no known size
+                auto it = track.sizes.find(allocation.address);
+                if (it != track.sizes.end())
+                {
+                    track.live_bytes -= it->second;
+                    track.sizes.erase(it);
+                }
+            }
+            else
+            {
+                auto [it, inserted] = track.sizes.try_emplace(allocation.address, allocation.size);
+                if (!inserted)
+                {
+                    // The free of the previous block at this address was never recorded
+                    track.live_bytes -= it->second;
+                    it->second = allocation.size;
+                }
+                track.live_bytes += allocation.size;
+            }
+
+            Write_Allocation(allocation, index, track.live_bytes);
+
+            if (m_buffer.size() >= m_buffer_size)
+            {
+                Write_Buffer();
+            }
+        }
+
+        m_frame_count++;
+    }
+
+    bool Trace_Exporter::Finish()
+    {
+        if (!m_file.is_open())
+        {
+            return false;
+        }
+
+        if (!m_finished)
+        {
+            Begin();
+            Write_Footer();
+            Write_Buffer();
+            m_finished = true;
+        }
+
+        bool written = m_file.good();
+        m_file.close();
+        return written;
+    }
+
+    ds_u64 Trace_Exporter::To_Nanoseconds(ds_u64 ticks)
+    {
+        ds_f64 microseconds = Profile_Clock::Get_Platform_Microseconds(ticks);
+        return microseconds > 0.0 ? static_cast<ds_u64>(microseconds * 1000.0) : 0;
+    }
+
+    void Trace_Exporter::Begin()
+    {
+        if (!m_started)
+        {
+            Write_Header();
+            m_started = true;
+        }
+    }
+
+    void Trace_Exporter::Write_Buffer()
+    {
+        m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+
+    ds_u32 Trace_Exporter::Get_Allocator_Index(const char* name)
+    {
+        // Allocator names may not outlive the frame, the track keeps a copy
+        auto [it, inserted] = m_allocator_indices.try_emplace(name, static_cast<ds_u32>(m_allocators.size()));
+        if (inserted)
+        {
+            m_allocators.push_back(Allocator_Track{ it->first, 0, {} });
+            Write_Allocator(it->second, it->first);
+        }
+
+        return it->second;
+    }
+
+    /////////////////////////////////////////////////////////
+    // Chrome_Trace_Exporter
+    /////////////////////////////////////////////////////////
+
+    Chrome_Trace_Exporter::Chrome_Trace_Exporter()
+        : Chrome_Trace_Exporter(Config{})
+    {
+    }
+
+    Chrome_Trace_Exporter::Chrome_Trace_Exporter(const Config& config)
+        : Trace_Exporter(config.path, config.buffer_size)
+    {
+    }
+
+    Chrome_Trace_Exporter::~Chrome_Trace_Exporter()
+    {
+        Finish();
+    }
+
+    void Chrome_Trace_Exporter::Write_Header()
+    {
+        m_buffer += "{\"traceEvents\":[";
+
+        // Thread 0 holds the frames and counters, profiler thread ids are shifted by one
+        m_buffer += "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Destan\"}}";
+        m_buffer += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}}";
+        m_first_event = false;
+    }
+
+    void Chrome_Trace_Exporter::Write_Footer()
+    {
+        m_buffer += "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    void Chrome_Trace_Exporter::Write_Thread(ds_u32 thread, std::string_view name)
+    {
+        m_buffer += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+        Append_Number(m_buffer, thread + 1);
+        m_buffer += ",\"args\":{\"name\":";
+        Append_Json_String(m_buffer, name.empty() ? "Thread " + std::to_string(thread) : std::string(name));
+        m_buffer += "}}";
+    }
+
+    void Chrome_Trace_Exporter::Write_Allocator(ds_u32 allocator, std::string_view name)
+    {
+        m_allocator_names.resize(allocator + 1);
+        m_allocator_names[allocator] = std::string(name) + " live bytes";
+    }
+
+    void Chrome_Trace_Exporter::Write_Frame(const Profile_Frame& frame)
+    {
+        ds_u64 begin = To_Nanoseconds(frame.begin);
+        ds_u64 end = To_Nanoseconds(frame.end);
+
+        Begin_Event("Frame " + std::to_string(frame.index), "X", 0, begin);
+        m_buffer += ",\"cat\":\"frame\",\"dur\":";
+        Append_Microseconds(m_buffer, end > begin ? end - begin : 0);
+        m_buffer += ",\"args\":{\"dropped\":";
+        Append_Number(m_buffer, frame.dropped_zone_count);
+        m_buffer += "}}";
+    }
+
+    void Chrome_Trace_Exporter::Write_Zones(ds_u32 thread, std::span<const Profile_Zone> zones)
+    {
+        for (const Profile_Zone& zone : zones)
+        {
+            ds_u64 begin = To_Nanoseconds(zone.begin);
+            ds_u64 end = To_Nanoseconds(zone.end);
+
+            Begin_Event(zone.name, "X", thread + 1, begin);
+            m_buffer += ",\"cat\":\"";
+            m_buffer += Get_Category_Name(zone.category);
+            m_buffer += "\",\"dur\":";
+            Append_Microseconds(m_buffer, end > begin ? end - begin : 0);
+            if (zone.category != Profile_Category::ZONE)
+            {
+                m_buffer += ",\"args\":{\"";
+                m_buffer += Get_Value_Name(zone.category);
+                m_buffer += "\":";
+                Append_Number(m_buffer, zone.value);
+                m_buffer += '}';
+            }
+            m_buffer += '}';
+        }
+    }
+
+    void Chrome_Trace_Exporter::Write_Allocation(const Profile_Allocation& allocation, ds_u32 allocator, ds_u64 live_bytes)
+    {
+        ds_u64 time = To_Nanoseconds(allocation.time);
+
+        Begin_Event(allocation.is_free ? "Free" : "Allocate", "i", allocation.thread + 1, time);
+        m_buffer += ",\"cat\":\"memory\",\"s\":\"t\",\"args\":{\"allocator\":";
+        Append_Json_String(m_buffer, allocation.allocator);
+        m_buffer += ",\"address\":\"0x";
+        Append_Number(m_buffer, reinterpret_cast<std::uintptr_t>(allocation.address), 16);
+        m_buffer += "\",\"size\":";
+        Append_Number(m_buffer, allocation.size);
+        m_buffer += "}}";
+
+        Begin_Event(m_allocator_names[allocator], "C", 0, time);
+        m_buffer += ",\"args\":{\"bytes\":";
+        Append_Number(m_buffer, live_bytes);
+        m_buffer += "}}";
+    }
+
+    void Chrome_Trace_Exporter::Begin_Event(std::string_view name, const char* phase, ds_u32 tid, ds_u64 nanoseconds)
+    {
+        m_buffer += m_first_event ? "\n{\"name\":" : ",\n{\"name\":";
+        m_first_event = false;
+        Append_Json_String(m_buffer, name);
+        m_buffer += ",\"ph\":\"";
+        m_buffer += phase;
+        m_buffer += "\",\"pid\":1,\"tid\":";
+        Append_Number(m_buffer, tid);
+        m_buffer += ",\"ts\":";
+        Append_Microseconds(m_buffer, nanoseconds);
+    }
+
+    /////////////////////////////////////////////////////////
+    // Perfetto_Trace_Exporter
+    /////////////////////////////////////////////////////////
+
+    Perfetto_Trace_Exporter::Perfetto_Trace_Exporter()
+        : Perfetto_Trace_Exporter(Config{})
+    {
+    }
+
+    Perfetto_Trace_Exporter::Perfetto_Trace_Exporter(const Config& config)
+        : Trace_Exporter(config.path, config.buffer_size)
+    {
+    }
+
+    Perfetto_Trace_Exporter::~Perfetto_Trace_Exporter()
+    {
+        Finish();
+    }
+
+    void Perfetto_Trace_Exporter::Write_Header()
+    {
+        std::string process;
+        Append_Varint_Field(process, PROCESS_PID, TRACE_PID);
+        Append_Bytes_Field(process, PROCESS_NAME, "Destan");
+
+        std::string process_track;
+        Append_Varint_Field(process_track, TRACK_UUID, PROCESS_TRACK);
+        Append_Bytes_Field(process_track, TRACK_PROCESS, process);
+        Write_Descriptor(process_track);
+
+        std::string frame_track;
+        Append_Varint_Field(frame_track, TRACK_UUID, FRAME_TRACK);
+        Append_Varint_Field(frame_track, TRACK_PARENT_UUID, PROCESS_TRACK);
+        Append_Bytes_Field(frame_track, TRACK_NAME, "Frames");
+        Write_Descriptor(frame_track);
+    }
+
+    void Perfetto_Trace_Exporter::Write_Footer()
+    {
+    }
+
+    void Perfetto_Trace_Exporter::Write_Thread(ds_u32 thread, std::string_view name)
+    {
+        std::string descriptor;
+        Append_Varint_Field(descriptor, THREAD_PID, TRACE_PID);
+        Append_Varint_Field(descriptor, THREAD_TID, thread + 1);
+        if (!name.empty())
+        {
+            Append_Bytes_Field(descriptor, THREAD_NAME, name);
+        }
+
+        std::string track;
+        Append_Varint_Field(track, TRACK_UUID, THREAD_TRACK_BASE + thread);
+        Append_Bytes_Field(track, TRACK_THREAD, descriptor);
+        Write_Descriptor(track);
+    }
+
+    void Perfetto_Trace_Exporter::Write_Allocator(ds_u32 allocator, std::string_view name)
+    {
+        std::string counter;
+        Append_Varint_Field(counter, COUNTER_UNIT, COUNTER_UNIT_SIZE_BYTES);
+
+        std::string track;
+        Append_Varint_Field(track, TRACK_UUID, COUNTER_TRACK_BASE + allocator);
+        Append_Varint_Field(track, TRACK_PARENT_UUID, PROCESS_TRACK);
+        Append_Bytes_Field(track, TRACK_NAME, std::string(name) + " live bytes");
+        Append_Bytes_Field(track, TRACK_COUNTER, counter);
+        Write_Descriptor(track);
+    }
+
+    void Perfetto_Trace_Exporter::Write_Frame(const Profile_Frame& frame)
+    {
+        std::string begin = Encode_Track_Event(EVENT_SLICE_BEGIN, FRAME_TRACK, "frame", "Frame " + std::to_string(frame.index));
+        Append_Annotation(begin, "dropped", ANNOTATION_UINT, frame.dropped_zone_count);
+        Write_Event(To_Nanoseconds(frame.begin), begin);
+        Write_Event(To_Nanoseconds(frame.end), Encode_Track_Event(EVENT_SLICE_END, FRAME_TRACK, nullptr, {}));
+    }
+
+    void Perfetto_Trace_Exporter::Write_Zones(ds_u32 thread, std::span<const Profile_Zone> zones)
+    {
+        const ds_u64 track = THREAD_TRACK_BASE + thread;
+
+        // Slices on a track nest by begin and end events, a zone ends before the next one at its depth begins
+        std::vector<const Profile_Zone*> open;
+        auto close_to_depth = [&](ds_u32 depth)
+        {
+            while (!open.empty() && open.back()->depth >= depth)
+            {
+                Write_Event(To_Nanoseconds(open.back()->end), Encode_Track_Event(EVENT_SLICE_END, track, nullptr, {}));
+                open.pop_back();
+            }
+        };
+
+        for (const Profile_Zone& zone : zones)
+        {
+            close_to_depth(zone.depth);
+
+            std::string event = Encode_Track_Event(EVENT_SLICE_BEGIN, track, Get_Category_Name(zone.category), zone.name);
+            if (zone.category != Profile_Category::ZONE)
+            {
+                Append_Annotation(event, Get_Value_Name(zone.category), ANNOTATION_UINT, zone.value);
+            }
+            Write_Event(To_Nanoseconds(zone.begin), event);
+            open.push_back(&zone);
+        }
+
+        close_to_depth(0);
+    }
+
+    void Perfetto_Trace_Exporter::Write_Allocation(const Profile_Allocation& allocation, ds_u32 allocator, ds_u64 live_bytes)
+    {
+        ds_u64 time = To_Nanoseconds(allocation.time);
+
+        std::string event = Encode_Track_Event(EVENT_INSTANT, THREAD_TRACK_BASE + allocation.thread, "memory",
+            allocation.is_free ? "Free" : "Allocate");
+        Append_Annotation(event, "allocator", allocation.allocator);
+        Append_Annotation(event, "address", ANNOTATION_POINTER, reinterpret_cast<std::uintptr_t>(allocation.address));
+        Append_Annotation(event, "size", ANNOTATION_UINT, allocation.size);
+        Write_Event(time, event);
+
+        std::string counter = Encode_Track_Event(EVENT_COUNTER, COUNTER_TRACK_BASE + allocator, nullptr, {});
+        Append_Varint_Field(counter, EVENT_COUNTER_VALUE, live_bytes);
+        Write_Event(time, counter);
+    }
+
+    void Perfetto_Trace_Exporter::Write_Event(ds_u64 nanoseconds, const std::string& event)
+    {
+        std::string packet;
+        Append_Varint_Field(packet, PACKET_TIMESTAMP, nanoseconds);
+        Append_Varint_Field(packet, PACKET_SEQUENCE_ID, TRACE_SEQUENCE_ID);
+        Append_Bytes_Field(packet, PACKET_TRACK_EVENT, event);
+        Append_Bytes_Field(m_buffer, TRACE_PACKET, packet);
+    }
+
+    void Perfetto_Trace_Exporter::Write_Descriptor(const std::string& descriptor)
+    {
+        std::string packet;
+        Append_Varint_Field(packet, PACKET_SEQUENCE_ID, TRACE_SEQUENCE_ID);
+        if (m_first_packet)
+        {
+            // Track events are only read from sequences that start with cleared incremental state
+            Append_Varint_Field(packet, PACKET_SEQUENCE_FLAGS, SEQUENCE_INCREMENTAL_STATE_CLEARED);
+            m_first_packet = false;
+        }
+        Append_Bytes_Field(packet, PACKET_TRACK_DESCRIPTOR, descriptor);
+        Append_Bytes_Field(m_buffer, TRACE_PACKET, packet);
+    }
+}
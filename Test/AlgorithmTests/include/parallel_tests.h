@@ -0,0 +1,217 @@
+#pragma once
+#include <core/ds_pch.h>
+#include <core/algorithms/parallel.h>
+#include <core/algorithms/worker_pool.h>
+#include <core/containers/dvector.h>
+#include <test_framework.h>
+
+using namespace ds::core::algorithms;
+using namespace ds::core::containers;
+using namespace ds::test;
+
+namespace ds::test::parallel
+{
+	// Deterministic pseudo random values for test inputs
+	static DVector<ds_u32> Make_Random_Values(ds_u64 count, ds_u32 seed)
+	{
+		DVector<ds_u32> values;
+		values.reserve(count);
+		ds_u32 state = seed;
+		for (ds_u64 i = 0; i < count; i++)
+		{
+			state = state * 1664525u + 1013904223u;
+			values.push_back(state >> 8);
+		}
+		return values;
+	}
+
+	// Test that Run hands out every task exactly once, including nested runs
+	static ds_bool Test_Worker_Pool_Run()
+	{
+		DS_EXPECT(Worker_Pool::Is_Initialized());
+		DS_EXPECT_EQ(Worker_Pool::Get_Concurrency(), 5u);
+
+		DVector<ds_u32> hits(1000, 0);
+		std::atomic<ds_u64> nested_total{ 0 };
+		Worker_Pool::Run(hits.size(), [&](ds_u64 task)
+		{
+			hits[task]++;
+
+			// Running from inside a task must not deadlock
+			if (task % 100 == 0)
+			{
+				Worker_Pool::Run(10, [&](ds_u64 inner) { nested_total.fetch_add(inner); });
+			}
+		});
+
+		DS_EXPECT(std::all_of(hits.begin(), hits.end(), [](ds_u32 count) { return count == 1; }));
+		DS_EXPECT_EQ(nested_total.load(), 10ull * 45);
+
+		return true;
+	}
+
+	// Test that a throwing task surfaces on the caller after every thread has left the job
+	static ds_bool Test_Worker_Pool_Exceptions()
+	{
+		std::atomic<ds_u64> completed{ 0 };
+		ds_bool caught = false;
+
+		try
+		{
+			Worker_Pool::Run(1000, [&](ds_u64 task)
+			{
+				if (task % 97 == 13)
+				{
+					throw std::runtime_error("task failed");
+				}
+				completed.fetch_add(1);
+			});
+		}
+		catch (const std::runtime_error& error)
+		{
+			caught = std::string(error.what()) == "task failed";
+		}
+
+		DS_EXPECT(caught);
+		DS_EXPECT_LT(completed.load(), 1000ull);
+
+		// The pool keeps working after a failed run
+		std::atomic<ds_u64> total{ 0 };
+		Worker_Pool::Run(100, [&](ds_u64 task) { total.fetch_add(task); });
+		DS_EXPECT_EQ(total.load(), 100ull * 99 / 2);
+
+		return true;
+	}
+
+	// Test for_each, transform and reduce against their sequential results
+	static ds_bool Test_Parallel_For_Each_Transform_Reduce()
+	{
+		const ds_u64 count = 100003;
+		DVector<ds_u32> values = Make_Random_Values(count, 7);
+
+		DVector<ds_u64> doubled(count, 0);
+		ds::core::algorithms::transform(values.begin(), values.end(), doubled.begin(), [](ds_u32 v) { return static_cast<ds_u64>(v) * 2; });
+		for (ds_u64 i = 0; i < count; i++)
+		{
+			DS_EXPECT_EQ(doubled[i], static_cast<ds_u64>(values[i]) * 2);
+		}
+
+		ds::core::algorithms::for_each(doubled.begin(), doubled.end(), [](ds_u64& v) { v += 1; });
+		DS_EXPECT_EQ(doubled[count - 1], static_cast<ds_u64>(values[count - 1]) * 2 + 1);
+
+		ds_u64 expected = std::accumulate(doubled.begin(), doubled.end(), ds_u64(5));
+		ds_u64 sum = ds::core::algorithms::reduce(doubled.begin(), doubled.end(), ds_u64(5));
+		DS_EXPECT_EQ(sum, expected);
+
+		// Non-commutative operations still see the elements in order
+		DVector<std::string> words;
+		for (ds_u64 i = 0; i < 5000; i++)
+		{
+			words.push_back(std::string(1, static_cast<char>('a' + i % 26)));
+		}
+		std::string joined = ds::core::algorithms::reduce(words.begin(), words.end(), std::string(">"));
+		DS_EXPECT(joined == std::accumulate(words.begin(), words.end(), std::string(">")));
+
+		// Small ranges take the sequential path
+		DVector<ds_u32> few = { 1, 2, 3 };
+		DS_EXPECT_EQ(ds::core::algorithms::reduce(few.begin(), few.end(), 0u), 6u);
+
+		return true;
+	}
+
+	// Test parallel sorts on sizes around the grain boundaries
+	static ds_bool Test_Parallel_Sort()
+	{
+		for (ds_u64 count : { 10ull, 4096ull, 50000ull, 262147ull })
+		{
+			DVector<ds_u32> values = Make_Random_Values(count, static_cast<ds_u32>(count));
+			DVector<ds_u32> expected = values;
+			std::sort(expected.begin(), expected.end());
+
+			ds::core::algorithms::sort(values.begin(), values.end());
+			DS_EXPECT(values == expected);
+
+			// Custom comparator
+			ds::core::algorithms::sort(values.begin(), values.end(), std::greater<>());
+			DS_EXPECT(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+		}
+
+		// Stable sort keeps equal keys in their original order
+		struct Keyed
+		{
+			ds_u32 key = 0;
+			ds_u32 order = 0;
+		};
+
+		DVector<ds_u32> keys = Make_Random_Values(100000, 3);
+		DVector<Keyed> items;
+		for (ds_u32 i = 0; i < keys.size(); i++)
+		{
+			items.push_back({ keys[i] % 64, i });
+		}
+
+		ds::core::algorithms::stable_sort(items.begin(), items.end(), [](const Keyed& a, const Keyed& b) { return a.key < b.key; });
+		ds_bool stable = true;
+		for (ds_u64 i = 1; i < items.size(); i++)
+		{
+			stable = stable && (items[i - 1].key < items[i].key ||
+				(items[i - 1].key == items[i].key && items[i - 1].order < items[i].order));
+		}
+		DS_EXPECT(stable);
+
+		return true;
+	}
+
+	// Test stable partition keeps order on both sides
+	static ds_bool Test_Parallel_Stable_Partition()
+	{
+		const ds_u64 count = 77777;
+		DVector<ds_u32> values;
+		for (ds_u32 i = 0; i < count; i++)
+		{
+			values.push_back(i);
+		}
+
+		auto is_multiple_of_3 = [](ds_u32 v) { return v % 3 == 0; };
+		auto middle = ds::core::algorithms::stable_partition(values.begin(), values.end(), is_multiple_of_3);
+		DS_EXPECT_EQ(static_cast<ds_u64>(middle - values.begin()), (count + 2) / 3);
+
+		DS_EXPECT(std::all_of(values.begin(), middle, is_multiple_of_3));
+		DS_EXPECT(std::none_of(middle, values.end(), is_multiple_of_3));
+		DS_EXPECT(std::is_sorted(values.begin(), middle));
+		DS_EXPECT(std::is_sorted(middle, values.end()));
+
+		return true;
+	}
+
+	// Add all tests to the test suite
+	static ds_bool Add_All_Tests(Test_Suite& test_suite)
+	{
+		DS_TEST(test_suite, "Worker Pool Run")
+		{
+			return Test_Worker_Pool_Run();
+		});
+
+		DS_TEST(test_suite, "Worker Pool Exceptions")
+		{
+			return Test_Worker_Pool_Exceptions();
+		});
+
+		DS_TEST(test_suite, "Parallel For Each Transform Reduce")
+		{
+			return Test_Parallel_For_Each_Transform_Reduce();
+		});
+
+		DS_TEST(test_suite, "Parallel Sort")
+		{
+			return Test_Parallel_Sort();
+		});
+
+		DS_TEST(test_suite, "Parallel Stable Partition")
+		{
+			return Test_Parallel_Stable_Partition();
+		});
+
+		return true;
+	}
+}
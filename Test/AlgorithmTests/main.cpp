@@ -0,0 +1,33 @@
+#include <core/ds_pch.h>
+#include <core/defines.h>
+#include <core/memory/memory.h>
+#include <core/algorithms/worker_pool.h>
+#include <test_framework.h>
+
+#include <parallel_tests.h>
+
+using namespace ds::core::memory;
+using namespace ds::core::algorithms;
+using namespace ds::test;
+using namespace ds;
+
+// Run all algorithm tests
+int main(int argc, char** argv)
+{
+	return Test_Runner::Run_Tests([]()
+	{
+		Memory::Initialize();
+		Worker_Pool::Initialize(4);
+
+		Test_Suite algorithm_tests("Core Algorithm Tests");
+
+		ds::test::parallel::Add_All_Tests(algorithm_tests);
+
+		bool result = algorithm_tests.Run_All();
+
+		Worker_Pool::Shutdown();
+		Memory::Shutdown();
+
+		return result;
+	});
+}
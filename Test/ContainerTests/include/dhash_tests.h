@@ -0,0 +1,256 @@
+#pragma once
+#include <core/ds_pch.h>
+#include <core/containers/dhash_map.h>
+#include <core/containers/dhash_set.h>
+#include <core/memory/allocator_adapters.h>
+#include <test_framework.h>
+#include <dvector_tests.h>
+
+using namespace ds::core::containers;
+using namespace ds::core::memory;
+using namespace ds::test;
+
+namespace ds::test::dhash
+{
+	using ds::test::dvector::Tracked_Object;
+
+	static_assert(ds_is_trivially_relocatable_v<std::pair<ds_i32, ds_u64>>);
+	static_assert(!ds_is_trivially_relocatable_v<std::pair<ds_i32, Tracked_Object>>);
+
+	// Test insertion, lookup and erasure across several rehashes
+	static ds_bool Test_DHash_Map_Basic_Operations()
+	{
+		DHash_Map<ds_i32, ds_i32> map;
+		DS_EXPECT(map.empty());
+		DS_EXPECT(map.find(1) == map.end());
+
+		const ds_i32 count = 10000;
+		for (ds_i32 i = 0; i < count; i++)
+		{
+			auto [it, inserted] = map.insert({ i, i * 2 });
+			DS_EXPECT(inserted);
+			DS_EXPECT_EQ(it->second, i * 2);
+		}
+
+		DS_EXPECT_EQ(map.size(), static_cast<ds_u64>(count));
+		DS_EXPECT(map.load_factor() <= 0.875f);
+
+		// Duplicate keys are rejected and leave the value alone
+		auto [existing, inserted] = map.insert({ 5, 0 });
+		DS_EXPECT(!inserted);
+		DS_EXPECT_EQ(existing->second, 10);
+
+		for (ds_i32 i = 0; i < count; i++)
+		{
+			DS_EXPECT(map.contains(i));
+			DS_EXPECT_EQ(map.at(i), i * 2);
+		}
+		DS_EXPECT(!map.contains(count));
+
+		// Remove every odd key
+		for (ds_i32 i = 1; i < count; i += 2)
+		{
+			DS_EXPECT_EQ(map.erase(i), 1ull);
+		}
+		DS_EXPECT_EQ(map.erase(1), 0ull);
+		DS_EXPECT_EQ(map.size(), static_cast<ds_u64>(count / 2));
+
+		ds_i64 sum = 0;
+		for (const auto& [key, value] : map)
+		{
+			DS_EXPECT_EQ(key % 2, 0);
+			sum += value;
+		}
+		DS_EXPECT_EQ(sum, static_cast<ds_i64>(count / 2) * (count - 2));
+
+		// operator[], try_emplace and insert_or_assign
+		map[1] = 100;
+		DS_EXPECT_EQ(map.at(1), 100);
+		DS_EXPECT_EQ(map[3], 0);
+		DS_EXPECT(!map.try_emplace(1, 7).second);
+		DS_EXPECT_EQ(map[1], 100);
+		DS_EXPECT(!map.insert_or_assign(1, 7).second);
+		DS_EXPECT_EQ(map[1], 7);
+
+		// Erasing through iterators while walking the map
+		for (auto it = map.begin(); it != map.end();)
+		{
+			it = it->first < 100 ? map.erase(it) : ++it;
+		}
+		DS_EXPECT(!map.contains(0));
+		DS_EXPECT(map.contains(100));
+
+		map.clear();
+		DS_EXPECT(map.empty());
+		DS_EXPECT(map.begin() == map.end());
+		DS_EXPECT_GT(map.capacity(), 0ull);
+
+		return true;
+	}
+
+	// Test that churn through tombstones doesn't grow the table
+	static ds_bool Test_DHash_Map_Tombstone_Reuse()
+	{
+		DHash_Map<ds_u64, ds_u64> map;
+		map.reserve(64);
+		const ds_u64 capacity = map.capacity();
+
+		// Keep 48 live keys while thousands of others come and go
+		for (ds_u64 i = 0; i < 48; i++)
+		{
+			map[i] = i;
+		}
+
+		for (ds_u64 i = 48; i < 20000; i++)
+		{
+			map[i] = i;
+			map.erase(i - 1 < 48 ? i : i - 1);
+		}
+
+		DS_EXPECT_EQ(map.capacity(), capacity);
+		DS_EXPECT_EQ(map.size(), 49ull);
+		for (ds_u64 i = 0; i < 48; i++)
+		{
+			DS_EXPECT_EQ(map.at(i), i);
+		}
+
+		// An explicit rehash with no size request fits the live elements
+		map.rehash(0);
+		DS_EXPECT_EQ(map.size(), 49ull);
+		DS_EXPECT(map.contains(19999));
+
+		return true;
+	}
+
+	// Test non-trivial keys and values are constructed and destroyed exactly once
+	static ds_bool Test_DHash_Map_Object_Lifetimes()
+	{
+		Tracked_Object::Reset();
+		{
+			DHash_Map<std::string, Tracked_Object> map;
+			for (ds_i32 i = 0; i < 500; i++)
+			{
+				map.try_emplace("key_" + std::to_string(i), i);
+			}
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 500);
+			DS_EXPECT_EQ(map.at("key_123").value, 123);
+
+			DHash_Map<std::string, Tracked_Object> copy(map);
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 1000);
+			DS_EXPECT_EQ(copy["key_499"].value, 499);
+
+			DHash_Map<std::string, Tracked_Object> moved(std::move(copy));
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 1000);
+			DS_EXPECT(copy.empty());
+			DS_EXPECT_EQ(moved.size(), 500ull);
+
+			for (ds_i32 i = 0; i < 250; i++)
+			{
+				moved.erase("key_" + std::to_string(i));
+			}
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 750);
+
+			map = moved;
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 500);
+			DS_EXPECT(!map.contains("key_0"));
+			DS_EXPECT(map.contains("key_250"));
+
+			bool threw = false;
+			try
+			{
+				map.at("missing");
+			}
+			catch (const std::out_of_range&)
+			{
+				threw = true;
+			}
+			DS_EXPECT(threw);
+		}
+
+		DS_EXPECT_EQ(Tracked_Object::s_live_count, 0);
+		return true;
+	}
+
+	// Test set membership operations
+	static ds_bool Test_DHash_Set_Operations()
+	{
+		DHash_Set<ds_u64> set = { 1, 2, 3, 2, 1 };
+		DS_EXPECT_EQ(set.size(), 3ull);
+		DS_EXPECT(set.contains(2));
+		DS_EXPECT_EQ(set.count(4), 0ull);
+
+		for (ds_u64 i = 0; i < 1000; i++)
+		{
+			set.insert(i * 7);
+		}
+		DS_EXPECT_EQ(set.size(), 1003ull);
+
+		DHash_Set<ds_u64> other;
+		other.swap(set);
+		DS_EXPECT(set.empty());
+		DS_EXPECT(other.contains(6993));
+		DS_EXPECT(other.contains(1));
+
+		ds_u64 multiples = 0;
+		for (ds_u64 value : other)
+		{
+			multiples += (value % 7 == 0) ? 1 : 0;
+		}
+		DS_EXPECT_EQ(multiples, 1000ull);
+
+		return true;
+	}
+
+	// Test a map backed by an engine allocator
+	static ds_bool Test_DHash_Map_Custom_Allocator()
+	{
+		using Entry = std::pair<ds_u64, ds_u64>;
+
+		Free_List_Allocator free_list(1024 * 1024, Free_List_Allocator::Allocation_Strategy::FIND_FIRST, "Hash Map Free List");
+		{
+			DHash_Map<ds_u64, ds_u64, std::hash<ds_u64>, std::equal_to<ds_u64>, Free_List_Allocator_Adapter<Entry>> map{ Free_List_Allocator_Adapter<Entry>(free_list) };
+			for (ds_u64 i = 0; i < 2000; i++)
+			{
+				map.try_emplace(i, i * i);
+			}
+			DS_EXPECT_GT(free_list.Get_Used_Size(), 2000 * sizeof(Entry));
+			DS_EXPECT_EQ(map.at(1999), 1999ull * 1999ull);
+		}
+
+		// Every table generation went back to the free list
+		DS_EXPECT_EQ(free_list.Get_Used_Size(), 0ull);
+
+		return true;
+	}
+
+	// Add all tests to the test suite
+	static ds_bool Add_All_Tests(Test_Suite& test_suite)
+	{
+		DS_TEST(test_suite, "DHash_Map Basic Operations")
+		{
+			return Test_DHash_Map_Basic_Operations();
+		});
+
+		DS_TEST(test_suite, "DHash_Map Tombstone Reuse")
+		{
+			return Test_DHash_Map_Tombstone_Reuse();
+		});
+
+		DS_TEST(test_suite, "DHash_Map Object Lifetimes")
+		{
+			return Test_DHash_Map_Object_Lifetimes();
+		});
+
+		DS_TEST(test_suite, "DHash_Set Operations")
+		{
+			return Test_DHash_Set_Operations();
+		});
+
+		DS_TEST(test_suite, "DHash_Map Custom Allocator")
+		{
+			return Test_DHash_Map_Custom_Allocator();
+		});
+
+		return true;
+	}
+}
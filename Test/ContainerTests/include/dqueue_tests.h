@@ -0,0 +1,200 @@
+#pragma once
+#include <core/ds_pch.h>
+#include <core/containers/dspsc_ring.h>
+#include <core/containers/dmpmc_queue.h>
+#include <core/memory/allocator_adapters.h>
+#include <test_framework.h>
+#include <dvector_tests.h>
+
+using namespace ds::core::containers;
+using namespace ds::core::memory;
+using namespace ds::test;
+
+namespace ds::test::dqueue
+{
+	using ds::test::dvector::Tracked_Object;
+
+	// Test ring semantics on a single thread
+	static ds_bool Test_DSPSC_Ring_Basic_Operations()
+	{
+		DSPSC_Ring<ds_i32> ring(5);
+		DS_EXPECT_EQ(ring.capacity(), 8ull);
+		DS_EXPECT(ring.empty());
+		DS_EXPECT(ring.front() == nullptr);
+
+		ds_i32 value = 0;
+		DS_EXPECT(!ring.try_pop(value));
+
+		// Wrap around the buffer a few times
+		ds_i32 next_push = 0;
+		ds_i32 next_pop = 0;
+		for (ds_i32 round = 0; round < 10; round++)
+		{
+			while (ring.try_push(next_push))
+			{
+				next_push++;
+			}
+			DS_EXPECT_EQ(ring.size(), 8ull);
+
+			for (ds_i32 i = 0; i < 5; i++)
+			{
+				DS_EXPECT(ring.try_pop(value));
+				DS_EXPECT_EQ(value, next_pop++);
+			}
+		}
+
+		DS_EXPECT_EQ(*ring.front(), next_pop);
+		ring.pop();
+		DS_EXPECT_EQ(ring.size(), 2ull);
+
+		return true;
+	}
+
+	// Test that elements are handed from one thread to another in order
+	static ds_bool Test_DSPSC_Ring_Threaded()
+	{
+		const ds_u64 count = 200000;
+		DSPSC_Ring<ds_u64> ring(64);
+
+		std::thread producer([&]()
+		{
+			for (ds_u64 i = 0; i < count; i++)
+			{
+				while (!ring.try_push(i))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		ds_bool in_order = true;
+		ds_u64 expected = 0;
+		while (expected < count)
+		{
+			ds_u64 value;
+			if (ring.try_pop(value))
+			{
+				in_order = in_order && value == expected;
+				expected++;
+			}
+		}
+
+		producer.join();
+		DS_EXPECT(in_order);
+		DS_EXPECT(ring.empty());
+
+		return true;
+	}
+
+	// Test that every element pushed by several producers is popped exactly once
+	static ds_bool Test_DMPMC_Queue_Threaded()
+	{
+		const ds_u64 thread_count = 4;
+		const ds_u64 per_thread = 50000;
+		DMPMC_Queue<ds_u64> queue(128);
+		DS_EXPECT_EQ(queue.capacity(), 128ull);
+
+		std::atomic<ds_u64> popped_count{ 0 };
+		std::atomic<ds_u64> popped_sum{ 0 };
+		DVector<std::thread> threads;
+
+		for (ds_u64 t = 0; t < thread_count; t++)
+		{
+			threads.emplace_back([&, t]()
+			{
+				for (ds_u64 i = 0; i < per_thread; i++)
+				{
+					while (!queue.try_push(t * per_thread + i + 1))
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+
+			threads.emplace_back([&]()
+			{
+				ds_u64 value;
+				while (popped_count.load() < thread_count * per_thread)
+				{
+					if (queue.try_pop(value))
+					{
+						popped_sum.fetch_add(value);
+						popped_count.fetch_add(1);
+					}
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		const ds_u64 total = thread_count * per_thread;
+		DS_EXPECT_EQ(popped_count.load(), total);
+		DS_EXPECT_EQ(popped_sum.load(), total * (total + 1) / 2);
+		DS_EXPECT_EQ(queue.size_approx(), 0ull);
+
+		return true;
+	}
+
+	// Test full queues, element lifetimes and engine allocator storage
+	static ds_bool Test_Queues_Lifetimes_And_Allocators()
+	{
+		Free_List_Allocator free_list(64 * 1024, Free_List_Allocator::Allocation_Strategy::FIND_FIRST, "Queue Free List");
+		Tracked_Object::Reset();
+		{
+			DMPMC_Queue<Tracked_Object, Free_List_Allocator_Adapter<Tracked_Object>> queue(4, Free_List_Allocator_Adapter<Tracked_Object>(free_list));
+			DSPSC_Ring<Tracked_Object, Free_List_Allocator_Adapter<Tracked_Object>> ring(4, Free_List_Allocator_Adapter<Tracked_Object>(free_list));
+			DS_EXPECT_GT(free_list.Get_Used_Size(), 0ull);
+
+			for (ds_i32 i = 0; i < 4; i++)
+			{
+				DS_EXPECT(queue.try_emplace(i));
+				DS_EXPECT(ring.try_emplace(i));
+			}
+			DS_EXPECT(!queue.try_emplace(4));
+			DS_EXPECT(!ring.try_emplace(4));
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 8);
+
+			Tracked_Object out;
+			DS_EXPECT(queue.try_pop(out));
+			DS_EXPECT_EQ(out.value, 0);
+			DS_EXPECT(ring.try_pop(out));
+			DS_EXPECT_EQ(out.value, 0);
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 7);
+		}
+
+		// Remaining elements were destroyed and the storage returned
+		DS_EXPECT_EQ(Tracked_Object::s_live_count, 0);
+		DS_EXPECT_EQ(free_list.Get_Used_Size(), 0ull);
+
+		return true;
+	}
+
+	// Add all tests to the test suite
+	static ds_bool Add_All_Tests(Test_Suite& test_suite)
+	{
+		DS_TEST(test_suite, "DSPSC_Ring Basic Operations")
+		{
+			return Test_DSPSC_Ring_Basic_Operations();
+		});
+
+		DS_TEST(test_suite, "DSPSC_Ring Threaded")
+		{
+			return Test_DSPSC_Ring_Threaded();
+		});
+
+		DS_TEST(test_suite, "DMPMC_Queue Threaded")
+		{
+			return Test_DMPMC_Queue_Threaded();
+		});
+
+		DS_TEST(test_suite, "Queues Lifetimes And Allocators")
+		{
+			return Test_Queues_Lifetimes_And_Allocators();
+		});
+
+		return true;
+	}
+}
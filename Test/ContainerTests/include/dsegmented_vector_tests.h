@@ -0,0 +1,165 @@
+#pragma once
+#include <core/ds_pch.h>
+#include <core/containers/dsegmented_vector.h>
+#include <core/memory/allocator_adapters.h>
+#include <test_framework.h>
+#include <dvector_tests.h>
+
+using namespace ds::core::containers;
+using namespace ds::core::memory;
+using namespace ds::test;
+
+namespace ds::test::dsegmented_vector
+{
+	using ds::test::dvector::Tracked_Object;
+
+	// Test indexing, iteration and chunk access
+	static ds_bool Test_DSegmented_Vector_Basic_Operations()
+	{
+		static_assert(SEGMENTED_VECTOR_DEFAULT_CHUNK_SIZE<ds_u32> == 4096);
+		static_assert(SEGMENTED_VECTOR_DEFAULT_CHUNK_SIZE<ds_u8[3000]> == 4);
+
+		DSegmented_Vector<ds_u32, 64> vector;
+		for (ds_u32 i = 0; i < 1000; i++)
+		{
+			vector.push_back(i);
+		}
+		DS_EXPECT_EQ(vector.size(), 1000ull);
+		DS_EXPECT_EQ(vector.capacity(), 1024ull);
+		DS_EXPECT_EQ(vector.chunk_count(), 16ull);
+
+		for (ds_u32 i = 0; i < 1000; i++)
+		{
+			DS_EXPECT_EQ(vector[i], i);
+		}
+		DS_EXPECT_EQ(vector.back(), 999u);
+
+		// Iterators visit elements in order across chunk boundaries
+		ds_u64 sum = 0;
+		for (ds_u32 value : vector)
+		{
+			sum += value;
+		}
+		DS_EXPECT_EQ(sum, 499500ull);
+		DS_EXPECT_EQ(vector.end() - vector.begin(), 1000ll);
+		DS_EXPECT_EQ(*(vector.begin() + 130), 130u);
+
+		// Chunks cover every element exactly once, the last one is partial
+		ds_u64 chunk_sum = 0;
+		for (ds_u64 c = 0; c < vector.chunk_count(); c++)
+		{
+			auto chunk = vector.chunk(c);
+			DS_EXPECT_EQ(chunk.size(), c + 1 < vector.chunk_count() ? 64ull : 1000ull - 15 * 64);
+			for (ds_u32 value : chunk)
+			{
+				chunk_sum += value;
+			}
+		}
+		DS_EXPECT_EQ(chunk_sum, sum);
+
+		// Standard algorithms work on the random access iterators
+		std::reverse(vector.begin(), vector.end());
+		DS_EXPECT_EQ(vector.front(), 999u);
+		std::sort(vector.begin(), vector.end());
+		DS_EXPECT_EQ(vector[500], 500u);
+
+		vector.resize(10);
+		DS_EXPECT_EQ(vector.chunk_count(), 1ull);
+		vector.shrink_to_fit();
+		DS_EXPECT_EQ(vector.capacity(), 64ull);
+
+		return true;
+	}
+
+	// Test that growing never moves existing elements
+	static ds_bool Test_DSegmented_Vector_Stable_Addresses()
+	{
+		Tracked_Object::Reset();
+		{
+			DSegmented_Vector<Tracked_Object, 16> vector;
+			DVector<Tracked_Object*> addresses;
+			for (ds_i32 i = 0; i < 500; i++)
+			{
+				addresses.push_back(&vector.emplace_back(i));
+			}
+
+			// No element was ever moved or copied
+			DS_EXPECT_EQ(Tracked_Object::s_move_count, 0);
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 500);
+			for (ds_i32 i = 0; i < 500; i++)
+			{
+				DS_EXPECT(&vector[i] == addresses[i]);
+				DS_EXPECT_EQ(addresses[i]->value, i);
+			}
+
+			DSegmented_Vector<Tracked_Object, 16> copy(vector);
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 1000);
+
+			// Moving the container hands over the chunks themselves
+			DSegmented_Vector<Tracked_Object, 16> moved(std::move(vector));
+			DS_EXPECT(&moved[250] == addresses[250]);
+			DS_EXPECT(vector.empty());
+
+			copy.pop_back();
+			copy.clear();
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 500);
+		}
+
+		DS_EXPECT_EQ(Tracked_Object::s_live_count, 0);
+		return true;
+	}
+
+	// Test chunks coming from pool and page allocators
+	static ds_bool Test_DSegmented_Vector_Chunk_Allocators()
+	{
+		using Pool_Vector = DSegmented_Vector<ds_u64, 32, Pool_Allocator_Adapter<ds_u64>>;
+
+		Pool_Allocator pool(32 * sizeof(ds_u64), 8, "Segment Pool");
+		{
+			Pool_Vector vector{ Pool_Allocator_Adapter<ds_u64>(pool) };
+			for (ds_u64 i = 0; i < 200; i++)
+			{
+				vector.push_back(i);
+			}
+
+			// 200 elements take 7 chunks of 32
+			DS_EXPECT_EQ(pool.Get_Allocated_Block_Count(), 7ull);
+			DS_EXPECT_EQ(vector[199], 199ull);
+		}
+		DS_EXPECT_EQ(pool.Get_Allocated_Block_Count(), 0ull);
+
+		Page_Allocator pages(0, 0, "Segment Pages");
+		{
+			DSegmented_Vector<ds_u32, 1024, Page_Allocator_Adapter<ds_u32>> vector{ Page_Allocator_Adapter<ds_u32>(pages) };
+			vector.resize(5000);
+			DS_EXPECT_EQ(vector.chunk_count(), 5ull);
+
+			// Each chunk is its own page allocation
+			DS_EXPECT_EQ(reinterpret_cast<ds_uiptr>(vector.chunk(1).data()) % pages.Get_Page_Size(), 0ull);
+			DS_EXPECT_EQ(vector[4999], 0u);
+		}
+
+		return true;
+	}
+
+	// Add all tests to the test suite
+	static ds_bool Add_All_Tests(Test_Suite& test_suite)
+	{
+		DS_TEST(test_suite, "DSegmented_Vector Basic Operations")
+		{
+			return Test_DSegmented_Vector_Basic_Operations();
+		});
+
+		DS_TEST(test_suite, "DSegmented_Vector Stable Addresses")
+		{
+			return Test_DSegmented_Vector_Stable_Addresses();
+		});
+
+		DS_TEST(test_suite, "DSegmented_Vector Chunk Allocators")
+		{
+			return Test_DSegmented_Vector_Chunk_Allocators();
+		});
+
+		return true;
+	}
+}
@@ -0,0 +1,181 @@
+#pragma once
+#include <core/ds_pch.h>
+#include <core/containers/dslot_map.h>
+#include <core/memory/allocator_adapters.h>
+#include <test_framework.h>
+#include <dvector_tests.h>
+
+using namespace ds::core::containers;
+using namespace ds::core::memory;
+using namespace ds::test;
+
+namespace ds::test::dslot_map
+{
+	using ds::test::dvector::Tracked_Object;
+
+	// Test insertion, lookup and swap-and-pop erasure
+	static ds_bool Test_DSlot_Map_Basic_Operations()
+	{
+		DSlot_Map<ds_i32> map;
+		DSlot_Map<ds_i32>::Handle handles[100];
+
+		DS_EXPECT(!DSlot_Map<ds_i32>::Handle().IsValid());
+		DS_EXPECT(map.get(DSlot_Map<ds_i32>::Handle()) == nullptr);
+
+		for (ds_i32 i = 0; i < 100; i++)
+		{
+			handles[i] = map.insert(i);
+			DS_EXPECT(handles[i].IsValid());
+		}
+		DS_EXPECT_EQ(map.size(), 100ull);
+
+		// Erase every third element, the survivors stay reachable through their handles
+		for (ds_i32 i = 0; i < 100; i += 3)
+		{
+			DS_EXPECT(map.erase(handles[i]));
+		}
+		DS_EXPECT(!map.erase(handles[0]));
+		DS_EXPECT_EQ(map.size(), 66ull);
+
+		for (ds_i32 i = 0; i < 100; i++)
+		{
+			if (i % 3 == 0)
+			{
+				DS_EXPECT(!map.contains(handles[i]));
+			}
+			else
+			{
+				DS_EXPECT_EQ(map[handles[i]], i);
+			}
+		}
+
+		// Dense iteration sees exactly the live elements
+		ds_i32 sum = 0;
+		for (ds_i32 value : map)
+		{
+			DS_EXPECT(value % 3 != 0);
+			sum += value;
+		}
+		DS_EXPECT_EQ(sum, 4950 - 1683);
+
+		// Handles recovered from dense positions resolve back to the same element
+		for (ds_u64 i = 0; i < map.size(); i++)
+		{
+			DS_EXPECT(map.get(map.handle_at(i)) == map.data() + i);
+		}
+
+		return true;
+	}
+
+	// Test that reused slots don't resolve old handles
+	static ds_bool Test_DSlot_Map_Stale_Handles()
+	{
+		DSlot_Map<ds_u64> map;
+
+		auto first = map.insert(1);
+		map.erase(first);
+
+		// The slot is reused with a new generation
+		auto second = map.insert(2);
+		DS_EXPECT_EQ(second.index, first.index);
+		DS_EXPECT(second.generation != first.generation);
+		DS_EXPECT(!map.contains(first));
+		DS_EXPECT_EQ(map[second], 2ull);
+
+		// Clearing invalidates everything, new handles keep working
+		auto third = map.insert(3);
+		map.clear();
+		DS_EXPECT(map.empty());
+		DS_EXPECT(!map.contains(second));
+		DS_EXPECT(!map.contains(third));
+
+		auto fourth = map.insert(4);
+		DS_EXPECT(fourth != second && fourth != third);
+		DS_EXPECT_EQ(map[fourth], 4ull);
+
+		// Handles from out of range indices are rejected
+		DS_EXPECT(map.get({ 1000, 1 }) == nullptr);
+
+		return true;
+	}
+
+	// Test element lifetimes through moves on erase and copies of the map
+	static ds_bool Test_DSlot_Map_Object_Lifetimes()
+	{
+		Tracked_Object::Reset();
+		{
+			DSlot_Map<Tracked_Object> map;
+			DVector<DSlot_Map<Tracked_Object>::Handle> handles;
+			for (ds_i32 i = 0; i < 64; i++)
+			{
+				handles.push_back(map.emplace(i));
+			}
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 64);
+
+			for (ds_i32 i = 0; i < 32; i++)
+			{
+				map.erase(handles[i * 2]);
+			}
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 32);
+
+			DSlot_Map<Tracked_Object> copy(map);
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 64);
+			DS_EXPECT_EQ(copy[handles[63]].value, 63);
+
+			DSlot_Map<Tracked_Object> moved(std::move(copy));
+			DS_EXPECT_EQ(moved[handles[1]].value, 1);
+		}
+
+		DS_EXPECT_EQ(Tracked_Object::s_live_count, 0);
+		return true;
+	}
+
+	// Test that all arrays come from the map's allocator
+	static ds_bool Test_DSlot_Map_Custom_Allocator()
+	{
+		Free_List_Allocator free_list(256 * 1024, Free_List_Allocator::Allocation_Strategy::FIND_FIRST, "Slot Map Free List");
+		{
+			DSlot_Map<ds_u64, Free_List_Allocator_Adapter<ds_u64>> map{ Free_List_Allocator_Adapter<ds_u64>(free_list) };
+			map.reserve(1000);
+
+			// Elements, slots and the dense to slot table all live in the free list
+			DS_EXPECT_GT(free_list.Get_Used_Size(), 1000 * (sizeof(ds_u64) * 2 + sizeof(ds_u32)));
+
+			for (ds_u64 i = 0; i < 1000; i++)
+			{
+				map.insert(i);
+			}
+			DS_EXPECT_EQ(map.size(), 1000ull);
+		}
+
+		DS_EXPECT_EQ(free_list.Get_Used_Size(), 0ull);
+
+		return true;
+	}
+
+	// Add all tests to the test suite
+	static ds_bool Add_All_Tests(Test_Suite& test_suite)
+	{
+		DS_TEST(test_suite, "DSlot_Map Basic Operations")
+		{
+			return Test_DSlot_Map_Basic_Operations();
+		});
+
+		DS_TEST(test_suite, "DSlot_Map Stale Handles")
+		{
+			return Test_DSlot_Map_Stale_Handles();
+		});
+
+		DS_TEST(test_suite, "DSlot_Map Object Lifetimes")
+		{
+			return Test_DSlot_Map_Object_Lifetimes();
+		});
+
+		DS_TEST(test_suite, "DSlot_Map Custom Allocator")
+		{
+			return Test_DSlot_Map_Custom_Allocator();
+		});
+
+		return true;
+	}
+}
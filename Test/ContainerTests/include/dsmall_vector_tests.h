@@ -0,0 +1,202 @@
+#pragma once
+#include <core/ds_pch.h>
+#include <core/containers/dsmall_vector.h>
+#include <core/memory/allocator_adapters.h>
+#include <test_framework.h>
+#include <dvector_tests.h>
+
+using namespace ds::core::containers;
+using namespace ds::core::memory;
+using namespace ds::test;
+
+namespace ds::test::dsmall_vector
+{
+	using ds::test::dvector::Tracked_Object;
+
+	// Check that a vector's storage lies inside the vector object itself
+	template <typename Vector>
+	static ds_bool Is_Stored_Inside(const Vector& vector)
+	{
+		const ds_u8* begin = reinterpret_cast<const ds_u8*>(&vector);
+		const ds_u8* data = reinterpret_cast<const ds_u8*>(vector.data());
+		return data >= begin && data < begin + sizeof(Vector);
+	}
+
+	// Test that small sizes stay inline and larger ones spill to the allocator
+	static ds_bool Test_DSmall_Vector_Inline_Storage()
+	{
+		DSmall_Vector<ds_i32, 8> vector;
+		DS_EXPECT(vector.is_inline());
+		DS_EXPECT_EQ(vector.capacity(), 8ull);
+
+		for (ds_i32 i = 0; i < 8; i++)
+		{
+			vector.push_back(i);
+		}
+
+		DS_EXPECT(vector.is_inline());
+		DS_EXPECT(Is_Stored_Inside(vector));
+
+		// The ninth element moves everything to the heap
+		vector.push_back(8);
+		DS_EXPECT(!vector.is_inline());
+		DS_EXPECT(!Is_Stored_Inside(vector));
+		DS_EXPECT_GT(vector.capacity(), 8ull);
+		for (ds_i32 i = 0; i < 9; i++)
+		{
+			DS_EXPECT_EQ(vector[i], i);
+		}
+
+		// Shrinking back below N returns to the inline buffer
+		vector.erase(vector.begin() + 4, vector.end());
+		vector.shrink_to_fit();
+		DS_EXPECT(vector.is_inline());
+		DS_EXPECT_EQ(vector.size(), 4ull);
+		DS_EXPECT_EQ(vector[3], 3);
+
+		// Iterators and algorithms work as with DVector
+		ds_i32 sum = 0;
+		for (ds_i32 value : vector)
+		{
+			sum += value;
+		}
+		DS_EXPECT_EQ(sum, 6);
+
+		vector.insert(vector.begin(), 42);
+		DS_EXPECT_EQ(vector.front(), 42);
+
+		// The DVector base is private, so its pointer-stealing move and swap can't be reached
+		static_assert(!std::is_convertible_v<DSmall_Vector<ds_i32, 8>&,
+			DVector<ds_i32, Small_Buffer_Allocator<ds_i32, 8, Default_Allocator<ds_i32>>>&>);
+
+		return true;
+	}
+
+	// Test copy, move and swap across inline and heap storage
+	static ds_bool Test_DSmall_Vector_Copy_And_Move()
+	{
+		DSmall_Vector<ds_i32, 4> small = { 1, 2, 3 };
+		DSmall_Vector<ds_i32, 4> large = { 1, 2, 3, 4, 5, 6 };
+		DS_EXPECT(small.is_inline());
+		DS_EXPECT(!large.is_inline());
+
+		// Copies get their own storage
+		DSmall_Vector<ds_i32, 4> small_copy(small);
+		DS_EXPECT(small_copy == small);
+		DS_EXPECT(small_copy.data() != small.data());
+		DS_EXPECT(Is_Stored_Inside(small_copy));
+
+		DSmall_Vector<ds_i32, 4> large_copy;
+		large_copy = large;
+		DS_EXPECT(large_copy == large);
+		DS_EXPECT(large_copy.data() != large.data());
+
+		// Moving inline elements copies them into the destination's buffer
+		DSmall_Vector<ds_i32, 4> small_moved(std::move(small_copy));
+		DS_EXPECT(small_moved == small);
+		DS_EXPECT(Is_Stored_Inside(small_moved));
+		DS_EXPECT(small_copy.empty());
+
+		// Moving heap storage hands the buffer over
+		const ds_i32* large_data = large_copy.data();
+		DSmall_Vector<ds_i32, 4> large_moved;
+		large_moved = std::move(large_copy);
+		DS_EXPECT(large_moved.data() == large_data);
+		DS_EXPECT(large_copy.empty());
+		DS_EXPECT(large_copy.is_inline());
+
+		// Moved-from vectors are usable again
+		large_copy.push_back(7);
+		DS_EXPECT_EQ(large_copy[0], 7);
+
+		swap(small_moved, large_moved);
+		DS_EXPECT(small_moved == large);
+		DS_EXPECT(large_moved == small);
+		DS_EXPECT(!small_moved.is_inline());
+		DS_EXPECT(Is_Stored_Inside(large_moved));
+
+		return true;
+	}
+
+	// Test that non-trivial elements are constructed and destroyed exactly once
+	static ds_bool Test_DSmall_Vector_Object_Lifetimes()
+	{
+		Tracked_Object::Reset();
+		{
+			DSmall_Vector<Tracked_Object, 4> first;
+			for (ds_i32 i = 0; i < 3; i++)
+			{
+				first.emplace_back(i);
+			}
+
+			DSmall_Vector<Tracked_Object, 4> second(std::move(first));
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 3);
+			DS_EXPECT_EQ(second[2].value, 2);
+
+			for (ds_i32 i = 3; i < 10; i++)
+			{
+				second.emplace_back(i);
+			}
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 10);
+
+			first = second;
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 20);
+
+			first.swap(second);
+			second.resize(2);
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 12);
+		}
+
+		DS_EXPECT_EQ(Tracked_Object::s_live_count, 0);
+		return true;
+	}
+
+	// Test spilling to a custom allocator
+	static ds_bool Test_DSmall_Vector_Custom_Allocator()
+	{
+		Free_List_Allocator free_list(64 * 1024, Free_List_Allocator::Allocation_Strategy::FIND_FIRST, "Small Vector Free List");
+		{
+			DSmall_Vector<ds_u64, 4, Free_List_Allocator_Adapter<ds_u64>> vector{ Free_List_Allocator_Adapter<ds_u64>(free_list) };
+			for (ds_u64 i = 0; i < 4; i++)
+			{
+				vector.push_back(i);
+			}
+			DS_EXPECT_EQ(free_list.Get_Used_Size(), 0ull);
+
+			vector.push_back(4);
+			DS_EXPECT_GT(free_list.Get_Used_Size(), 0ull);
+			DS_EXPECT_EQ(vector[4], 4ull);
+		}
+
+		// The spilled buffer went back to the free list
+		DS_EXPECT_EQ(free_list.Get_Used_Size(), 0ull);
+
+		return true;
+	}
+
+	// Add all tests to the test suite
+	static ds_bool Add_All_Tests(Test_Suite& test_suite)
+	{
+		DS_TEST(test_suite, "DSmall_Vector Inline Storage")
+		{
+			return Test_DSmall_Vector_Inline_Storage();
+		});
+
+		DS_TEST(test_suite, "DSmall_Vector Copy And Move")
+		{
+			return Test_DSmall_Vector_Copy_And_Move();
+		});
+
+		DS_TEST(test_suite, "DSmall_Vector Object Lifetimes")
+		{
+			return Test_DSmall_Vector_Object_Lifetimes();
+		});
+
+		DS_TEST(test_suite, "DSmall_Vector Custom Allocator")
+		{
+			return Test_DSmall_Vector_Custom_Allocator();
+		});
+
+		return true;
+	}
+}
@@ -0,0 +1,162 @@
+#pragma once
+#include <core/ds_pch.h>
+#include <core/containers/dsoa_vector.h>
+#include <core/memory/allocator_adapters.h>
+#include <test_framework.h>
+#include <dvector_tests.h>
+
+using namespace ds::core::containers;
+using namespace ds::core::memory;
+using namespace ds::test;
+
+namespace ds::test::dsoa_vector
+{
+	using ds::test::dvector::Tracked_Object;
+
+	// Check that a column starts on a SIMD boundary
+	template <typename Span>
+	static ds_bool Is_Simd_Aligned(const Span& span)
+	{
+		return reinterpret_cast<ds_uiptr>(span.data()) % SIMD_ALIGNMENT == 0;
+	}
+
+	// Test pushing tuples and reading back through columns and rows
+	static ds_bool Test_DSoA_Vector_Columns()
+	{
+		DSoA_Vector<ds_f32, ds_u8, ds_u64> particles;
+		DS_EXPECT(particles.empty());
+
+		for (ds_u64 i = 0; i < 1000; i++)
+		{
+			if (i % 2 == 0)
+			{
+				particles.push_back({ static_cast<ds_f32>(i), static_cast<ds_u8>(i), i * 3 });
+			}
+			else
+			{
+				particles.emplace_back(static_cast<ds_f32>(i), static_cast<ds_u8>(i), i * 3);
+			}
+		}
+		DS_EXPECT_EQ(particles.size(), 1000ull);
+
+		auto positions = particles.column<0>();
+		auto flags = particles.column<1>();
+		auto ids = particles.column<2>();
+		DS_EXPECT_EQ(positions.size(), 1000ull);
+		DS_EXPECT(Is_Simd_Aligned(positions));
+		DS_EXPECT(Is_Simd_Aligned(flags));
+		DS_EXPECT(Is_Simd_Aligned(ids));
+
+		// Column loops see the same data as the rows
+		for (ds_f32& position : positions)
+		{
+			position *= 2.0f;
+		}
+
+		for (ds_u64 i = 0; i < particles.size(); i++)
+		{
+			auto [position, flag, id] = particles[i];
+			DS_EXPECT_EQ(position, static_cast<ds_f32>(i) * 2.0f);
+			DS_EXPECT_EQ(flag, static_cast<ds_u8>(i));
+			DS_EXPECT_EQ(id, i * 3);
+		}
+
+		// Rows can be written through
+		std::get<2>(particles[5]) = 42;
+		DS_EXPECT_EQ(ids[5], 42ull);
+
+		// Swap removal moves the last row into the hole
+		particles.swap_remove(0);
+		DS_EXPECT_EQ(particles.size(), 999ull);
+		DS_EXPECT_EQ(particles.column<2>()[0], 999ull * 3);
+
+		particles.resize(10);
+		particles.resize(12);
+		DS_EXPECT_EQ(particles.column<2>()[11], 0ull);
+		DS_EXPECT_EQ(std::get<0>(particles.back()), 0.0f);
+
+		return true;
+	}
+
+	// Test element lifetimes across growth, copies and removal
+	static ds_bool Test_DSoA_Vector_Object_Lifetimes()
+	{
+		Tracked_Object::Reset();
+		{
+			DSoA_Vector<std::string, Tracked_Object> vector;
+			for (ds_i32 i = 0; i < 100; i++)
+			{
+				vector.emplace_back(std::to_string(i), i);
+			}
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 100);
+
+			DSoA_Vector<std::string, Tracked_Object> copy(vector);
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 200);
+			DS_EXPECT(copy.column<0>()[57] == "57");
+
+			copy.swap_remove(3);
+			copy.pop_back();
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 198);
+			DS_EXPECT_EQ(copy.column<1>()[3].value, 99);
+
+			vector = std::move(copy);
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 98);
+			DS_EXPECT(copy.empty());
+
+			vector.shrink_to_fit();
+			DS_EXPECT_EQ(vector.capacity(), 98ull);
+			DS_EXPECT(vector.column<0>()[97] == "97");
+		}
+
+		DS_EXPECT_EQ(Tracked_Object::s_live_count, 0);
+		return true;
+	}
+
+	// Test that all columns share one allocation from an engine allocator
+	static ds_bool Test_DSoA_Vector_Custom_Allocator()
+	{
+		Free_List_Allocator free_list(64 * 1024, Free_List_Allocator::Allocation_Strategy::FIND_FIRST, "SoA Free List");
+		{
+			Basic_SoA_Vector<Free_List_Allocator_Adapter<ds_u8>, ds_f32, ds_f32, ds_u16> vector{ Free_List_Allocator_Adapter<ds_u8>(free_list) };
+			vector.reserve(100);
+
+			// One block for all three columns
+			const ds_u64 free_blocks = free_list.Get_Free_Block_Count();
+			ds_u8* first = reinterpret_cast<ds_u8*>(vector.column<0>().data());
+			ds_u8* last = reinterpret_cast<ds_u8*>(vector.column<2>().data());
+			DS_EXPECT_EQ(static_cast<ds_u64>(last - first), 2 * Memory::Align_Size(100 * sizeof(ds_f32), SIMD_ALIGNMENT));
+
+			for (ds_u16 i = 0; i < 100; i++)
+			{
+				vector.emplace_back(1.0f, 2.0f, i);
+			}
+			DS_EXPECT_EQ(free_list.Get_Free_Block_Count(), free_blocks);
+			DS_EXPECT_GT(free_list.Get_Used_Size(), 100 * (2 * sizeof(ds_f32) + sizeof(ds_u16)));
+		}
+
+		DS_EXPECT_EQ(free_list.Get_Used_Size(), 0ull);
+
+		return true;
+	}
+
+	// Add all tests to the test suite
+	static ds_bool Add_All_Tests(Test_Suite& test_suite)
+	{
+		DS_TEST(test_suite, "DSoA_Vector Columns")
+		{
+			return Test_DSoA_Vector_Columns();
+		});
+
+		DS_TEST(test_suite, "DSoA_Vector Object Lifetimes")
+		{
+			return Test_DSoA_Vector_Object_Lifetimes();
+		});
+
+		DS_TEST(test_suite, "DSoA_Vector Custom Allocator")
+		{
+			return Test_DSoA_Vector_Custom_Allocator();
+		});
+
+		return true;
+	}
+}
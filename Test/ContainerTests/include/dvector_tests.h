@@ -0,0 +1,333 @@
+#pragma once
+#include <core/ds_pch.h>
+#include <core/containers/dvector.h>
+#include <core/memory/allocator_adapters.h>
+#include <test_framework.h>
+
+using namespace ds::core::containers;
+using namespace ds::core::memory;
+using namespace ds::test;
+
+namespace ds::test::dvector
+{
+	// Counts constructions and destructions so the per-element paths can be checked
+	struct Tracked_Object
+	{
+		static inline ds_i32 s_live_count = 0;
+		static inline ds_i32 s_move_count = 0;
+
+		ds_i32 value;
+
+		Tracked_Object(ds_i32 v = 0) : value(v) { s_live_count++; }
+		Tracked_Object(const Tracked_Object& other) : value(other.value) { s_live_count++; }
+		Tracked_Object(Tracked_Object&& other) noexcept : value(other.value) { s_live_count++; s_move_count++; }
+		Tracked_Object& operator=(const Tracked_Object& other) = default;
+		~Tracked_Object() { s_live_count--; }
+
+		static void Reset() { s_live_count = 0; s_move_count = 0; }
+	};
+
+	// Same as Tracked_Object but opted into memcpy relocation
+	struct Relocatable_Object
+	{
+		static inline ds_i32 s_live_count = 0;
+		static inline ds_i32 s_move_count = 0;
+
+		ds_i32 value;
+
+		Relocatable_Object(ds_i32 v = 0) : value(v) { s_live_count++; }
+		Relocatable_Object(const Relocatable_Object& other) : value(other.value) { s_live_count++; }
+		Relocatable_Object(Relocatable_Object&& other) noexcept : value(other.value) { s_live_count++; s_move_count++; }
+		Relocatable_Object& operator=(const Relocatable_Object& other) = default;
+		~Relocatable_Object() { s_live_count--; }
+
+		static void Reset() { s_live_count = 0; s_move_count = 0; }
+	};
+}
+
+DS_DECLARE_TRIVIALLY_RELOCATABLE(ds::test::dvector::Relocatable_Object);
+
+namespace ds::test::dvector
+{
+	static_assert(ds_is_trivially_relocatable_v<ds_i32>);
+	static_assert(ds_is_trivially_relocatable_v<Relocatable_Object>);
+	static_assert(!ds_is_trivially_relocatable_v<Tracked_Object>);
+
+	// Check that a vector holds exactly the given values
+	template <typename Vector>
+	static ds_bool Matches(const Vector& vector, std::initializer_list<ds_i32> expected)
+	{
+		if (vector.size() != expected.size())
+		{
+			return false;
+		}
+
+		ds_u64 i = 0;
+		for (ds_i32 value : expected)
+		{
+			if (static_cast<ds_i32>(vector[i++]) != value)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// Test growth, insert and erase with trivially copyable elements
+	static ds_bool Test_DVector_Trivial_Elements()
+	{
+		DVector<ds_i32> vector;
+		for (ds_i32 i = 0; i < 1000; i++)
+		{
+			vector.push_back(i);
+		}
+
+		DS_EXPECT_EQ(vector.size(), 1000ull);
+		for (ds_i32 i = 0; i < 1000; i++)
+		{
+			DS_EXPECT_EQ(vector[i], i);
+		}
+
+		DVector<ds_i32> small = { 1, 2, 3, 4, 5 };
+		small.insert(small.begin() + 2, 9);
+		DS_EXPECT(Matches(small, { 1, 2, 9, 3, 4, 5 }));
+
+		small.insert(small.begin() + 1, 2, 7);
+		DS_EXPECT(Matches(small, { 1, 7, 7, 2, 9, 3, 4, 5 }));
+
+		small.erase(small.begin());
+		DS_EXPECT(Matches(small, { 7, 7, 2, 9, 3, 4, 5 }));
+
+		small.erase(small.begin() + 1, small.begin() + 4);
+		DS_EXPECT(Matches(small, { 7, 3, 4, 5 }));
+
+		// Inserting an element of the vector into itself must use the value before the shift
+		small.insert(small.begin(), small[2]);
+		DS_EXPECT(Matches(small, { 4, 7, 3, 4, 5 }));
+
+		DVector<ds_i32> copy(small);
+		DS_EXPECT(copy == small);
+
+		DVector<ds_i32> assigned;
+		assigned = small;
+		DS_EXPECT(assigned == small);
+
+		small.clear();
+		DS_EXPECT(small.empty());
+		DS_EXPECT(copy.size() == 5);
+
+		return true;
+	}
+
+	// Test that opted-in types are relocated without move constructors or destructors
+	static ds_bool Test_DVector_Relocatable_Elements()
+	{
+		Relocatable_Object::Reset();
+		{
+			DVector<Relocatable_Object> vector;
+			for (ds_i32 i = 0; i < 100; i++)
+			{
+				vector.emplace_back(i);
+			}
+
+			// Growth and shifting only copy bytes
+			DS_EXPECT_EQ(Relocatable_Object::s_move_count, 0);
+			DS_EXPECT_EQ(Relocatable_Object::s_live_count, 100);
+
+			vector.insert(vector.begin() + 10, Relocatable_Object(-1));
+			DS_EXPECT_EQ(vector[10].value, -1);
+			DS_EXPECT_EQ(vector[11].value, 10);
+
+			vector.erase(vector.begin(), vector.begin() + 5);
+			DS_EXPECT_EQ(vector.size(), 96ull);
+			DS_EXPECT_EQ(vector[0].value, 5);
+			DS_EXPECT_EQ(Relocatable_Object::s_live_count, 96);
+		}
+
+		// Non-trivial destructors still run
+		DS_EXPECT_EQ(Relocatable_Object::s_live_count, 0);
+		return true;
+	}
+
+	// Test that other types still go through their move constructors and destructors
+	static ds_bool Test_DVector_Non_Relocatable_Elements()
+	{
+		Tracked_Object::Reset();
+		{
+			DVector<Tracked_Object> vector;
+			for (ds_i32 i = 0; i < 100; i++)
+			{
+				vector.emplace_back(i);
+			}
+
+			DS_EXPECT_GT(Tracked_Object::s_move_count, 0);
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 100);
+
+			vector.insert(vector.begin() + 10, 3, Tracked_Object(-1));
+			DS_EXPECT_EQ(vector[12].value, -1);
+			DS_EXPECT_EQ(vector[13].value, 10);
+
+			vector.erase(vector.begin() + 1);
+			DS_EXPECT_EQ(vector[0].value, 0);
+			DS_EXPECT_EQ(vector[1].value, 2);
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 102);
+
+			DVector<Tracked_Object> copy(vector);
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 204);
+
+			copy.clear();
+			DS_EXPECT_EQ(Tracked_Object::s_live_count, 102);
+		}
+
+		DS_EXPECT_EQ(Tracked_Object::s_live_count, 0);
+
+		DVector<std::string> strings;
+		for (ds_i32 i = 0; i < 50; i++)
+		{
+			strings.push_back(std::string(32, static_cast<char>('a' + i % 26)));
+		}
+		strings.erase(strings.begin() + 3, strings.begin() + 10);
+		DS_EXPECT_EQ(strings.size(), 43ull);
+		DS_EXPECT(strings[3] == std::string(32, 'k'));
+
+		// Inserting an element into its own full vector, so the insert reallocates and shifts
+		DVector<std::string> full;
+		full.reserve(4);
+		for (ds_i32 i = 0; i < 4; i++)
+		{
+			full.push_back(std::string(32, static_cast<char>('a' + i)));
+		}
+		DS_EXPECT_EQ(full.size(), full.capacity());
+		full.insert(full.begin(), full[2]);
+		DS_EXPECT_EQ(full.size(), 5ull);
+		DS_EXPECT(full[0] == std::string(32, 'c'));
+		DS_EXPECT(full[3] == std::string(32, 'c'));
+
+		full.shrink_to_fit();
+		full.insert(full.begin() + 1, 2, full[4]);
+		DS_EXPECT_EQ(full.size(), 7ull);
+		DS_EXPECT(full[1] == std::string(32, 'd'));
+		DS_EXPECT(full[2] == std::string(32, 'd'));
+		DS_EXPECT(full[6] == std::string(32, 'd'));
+
+		return true;
+	}
+
+	// Test that growth extends the buffer in place when the allocator allows it
+	static ds_bool Test_DVector_In_Place_Growth()
+	{
+		Arena_Allocator arena(64 * 1024, "DVector Arena");
+		{
+			DVector<ds_i32, Arena_Allocator_Adapter<ds_i32>> vector{ Arena_Allocator_Adapter<ds_i32>(arena) };
+			vector.push_back(0);
+			const ds_i32* data = vector.data();
+
+			// The vector owns the last arena allocation, so every growth step stays in place
+			for (ds_i32 i = 1; i < 4096; i++)
+			{
+				vector.push_back(i);
+			}
+
+			DS_EXPECT(vector.data() == data);
+			for (ds_i32 i = 0; i < 4096; i++)
+			{
+				DS_EXPECT_EQ(vector[i], i);
+			}
+
+			// Another allocation behind the buffer forces the next growth to move
+			void* blocker = arena.Allocate(16);
+			DS_EXPECT(blocker != nullptr);
+
+			vector.reserve(vector.capacity() + 1);
+			DS_EXPECT(vector.data() != data);
+			DS_EXPECT_EQ(vector[4095], 4095);
+		}
+		arena.Reset();
+
+		Free_List_Allocator free_list(256 * 1024, Free_List_Allocator::Allocation_Strategy::FIND_FIRST, "DVector Free List");
+		{
+			DVector<ds_i32, Free_List_Allocator_Adapter<ds_i32>> vector{ Free_List_Allocator_Adapter<ds_i32>(free_list) };
+			vector.reserve(16);
+			const ds_i32* data = vector.data();
+
+			for (ds_i32 i = 0; i < 10000; i++)
+			{
+				vector.push_back(i);
+			}
+
+			// Nothing sits after the buffer, so it absorbs the free space behind it
+			DS_EXPECT(vector.data() == data);
+			DS_EXPECT_EQ(vector[9999], 9999);
+		}
+
+		return true;
+	}
+
+	// Stateless allocators add nothing to the vector, adapters add one pointer
+	static_assert(sizeof(DVector<ds_i32>) == sizeof(void*) + 2 * sizeof(ds_u64));
+	static_assert(sizeof(DVector<ds_i32, Arena_Allocator_Adapter<ds_i32>>) == 2 * sizeof(void*) + 2 * sizeof(ds_u64));
+
+	// Test allocators chosen at runtime through the type-erased wrapper
+	static ds_bool Test_DVector_Polymorphic_Allocator()
+	{
+		Arena_Allocator arena(64 * 1024, "Polymorphic Arena");
+		Free_List_Allocator free_list(64 * 1024, Free_List_Allocator::Allocation_Strategy::FIND_FIRST, "Polymorphic Free List");
+
+		Allocator_Model<Arena_Allocator_Adapter<ds_i32>> arena_model{ Arena_Allocator_Adapter<ds_i32>(arena) };
+		Allocator_Model<Free_List_Allocator_Adapter<ds_i32>> free_list_model{ Free_List_Allocator_Adapter<ds_i32>(free_list) };
+		Allocator_Model<Default_Allocator<ds_i32>> default_model{ Default_Allocator<ds_i32>() };
+
+		Allocator_Interface<ds_i32>* resources[] = { &arena_model, &free_list_model, &default_model };
+		for (Allocator_Interface<ds_i32>* resource : resources)
+		{
+			DVector<ds_i32, Polymorphic_Allocator<ds_i32>> vector{ Polymorphic_Allocator<ds_i32>(*resource) };
+			for (ds_i32 i = 0; i < 1000; i++)
+			{
+				vector.push_back(i);
+			}
+
+			DS_EXPECT_EQ(vector.size(), 1000ull);
+			DS_EXPECT_EQ(vector[999], 999);
+
+			// Copies keep using the same resource
+			DVector<ds_i32, Polymorphic_Allocator<ds_i32>> copy(vector);
+			DS_EXPECT(copy == vector);
+		}
+
+		arena.Reset();
+
+		return true;
+	}
+
+	// Add all tests to the test suite
+	static ds_bool Add_All_Tests(Test_Suite& test_suite)
+	{
+		DS_TEST(test_suite, "DVector Trivial Elements")
+		{
+			return Test_DVector_Trivial_Elements();
+		});
+
+		DS_TEST(test_suite, "DVector Relocatable Elements")
+		{
+			return Test_DVector_Relocatable_Elements();
+		});
+
+		DS_TEST(test_suite, "DVector Non-Relocatable Elements")
+		{
+			return Test_DVector_Non_Relocatable_Elements();
+		});
+
+		DS_TEST(test_suite, "DVector In-Place Growth")
+		{
+			return Test_DVector_In_Place_Growth();
+		});
+
+		DS_TEST(test_suite, "DVector Polymorphic Allocator")
+		{
+			return Test_DVector_Polymorphic_Allocator();
+		});
+
+		return true;
+	}
+}
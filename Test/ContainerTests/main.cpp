@@ -0,0 +1,41 @@
+#include <core/ds_pch.h>
+#include <core/defines.h>
+#include <core/memory/memory.h>
+#include <test_framework.h>
+
+#include <dvector_tests.h>
+#include <dsmall_vector_tests.h>
+#include <dhash_tests.h>
+#include <dslot_map_tests.h>
+#include <dqueue_tests.h>
+#include <dsoa_vector_tests.h>
+#include <dsegmented_vector_tests.h>
+
+using namespace ds::core::memory;
+using namespace ds::test;
+using namespace ds;
+
+// Run all container tests
+int main(int argc, char** argv)
+{
+	return Test_Runner::Run_Tests([]()
+	{
+		Memory::Initialize();
+
+		Test_Suite container_tests("Core Container Tests");
+
+		ds::test::dvector::Add_All_Tests(container_tests);
+		ds::test::dsmall_vector::Add_All_Tests(container_tests);
+		ds::test::dhash::Add_All_Tests(container_tests);
+		ds::test::dslot_map::Add_All_Tests(container_tests);
+		ds::test::dqueue::Add_All_Tests(container_tests);
+		ds::test::dsoa_vector::Add_All_Tests(container_tests);
+		ds::test::dsegmented_vector::Add_All_Tests(container_tests);
+
+		bool result = container_tests.Run_All();
+
+		Memory::Shutdown();
+
+		return result;
+	});
+}
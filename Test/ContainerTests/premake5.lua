@@ -7,9 +7,12 @@ project "ContainerTests"
 
     targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
     objdir ("%{wks.location}/bin-int/" .. outputdir .. "/%{prj.name}")
-
+    
     files
     {
+        "include/**.h",
+        "include/**.hpp",
+        "include/**.inl",        
         "src/**.h",
         "src/**.cpp",
         "src/**.hpp",
@@ -31,8 +34,8 @@ project "ContainerTests"
 
     -- Define precompiled header for C++ files only
     filter "files:src/**.cpp"
-        pchheader "core/destan_pch.h"
-        pchsource "%{wks.location}/Engine/Core/src/destan_pch.cpp"
+        pchheader "core/ds_pch.h"
+        pchsource "%{wks.location}/Engine/Core/src/ds_pch.cpp"
 
     -- Explicitly disable PCH for header files
     filter "files:**.h or **.hpp or **.inl"
@@ -45,13 +48,13 @@ project "ContainerTests"
         systemversion "latest"
         defines
         {
-            "DESTAN_PLATFORM_WINDOWS"
+            "DS_PLATFORM_WINDOWS"
         }
 
     filter "system:linux"
         defines
         {
-            "DESTAN_PLATFORM_LINUX"
+            "DS_PLATFORM_LINUX"
         }
         
         links
@@ -62,5 +65,5 @@ project "ContainerTests"
     filter "system:macosx"
         defines
         {
-            "DESTAN_PLATFORM_MACOS"
+            "DS_PLATFORM_MACOS"
         }
\ No newline at end of file
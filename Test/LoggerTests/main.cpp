@@ -1,5 +1,8 @@
 #include <core/ds_pch.h>
 #include <core/logger/logger.h>
+#include <core/logger/log_sink.h>
+#include <core/logger/binary_log.h>
+#include <core/logger/crash_log.h>
 #include <test_framework.h>
 #include <fstream>
 #include <sstream>
@@ -68,7 +71,7 @@ int main(int argc, char** argv)
     // Delete previous log file if it exists
     std::remove("ds.log");
 
-    return ds::test::Test_Runner::Run_Tests([]()
+    int result = ds::test::Test_Runner::Run_Tests([]()
     {
         ds::test::Test_Suite logger_tests("Logger Theme and Style Tests");
 
@@ -397,7 +400,482 @@ int main(int argc, char** argv)
             return true;
         });
 
+        // Test asynchronous logging from many threads through the per-thread rings
+        DS_TEST(logger_tests, "Multi-Threaded Async Logging")
+        {
+            const int thread_count = 16;
+            const int messages_per_thread = 1000;
+
+            ds::core::Logger::Get_Instance().Set_File_Output_Mode(true);
+            ds::core::Logger::Get_Instance().Set_Synchronous_Mode(false);
+
+            std::vector<std::thread> threads;
+            for (int t = 0; t < thread_count; t++)
+            {
+                threads.emplace_back([t]()
+                {
+                    for (int i = 0; i < messages_per_thread; i++)
+                    {
+                        DS_LOG_TRACE("async thread {} message {}", t, i);
+                    }
+                });
+            }
+
+            // A message longer than one ring record is split and put back together
+            std::string long_message = "long message start " + std::string(1000, 'x') + " long message end";
+            DS_LOG_INFO("{}", long_message);
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            // Flushing drains every ring, exited threads included
+            ds::core::Logger::Get_Instance().Flush();
+            ds::core::Logger::Get_Instance().Set_Synchronous_Mode(true);
+
+            std::string log_content = Read_Log_File();
+            ds::core::Logger::Get_Instance().Set_File_Output_Mode(false);
+
+            int line_count = 0;
+            std::istringstream lines(log_content);
+            for (std::string line; std::getline(lines, line);)
+            {
+                if (Log_Contains(line, "async thread "))
+                {
+                    line_count++;
+                }
+            }
+
+            DS_EXPECT_EQ(line_count, thread_count * messages_per_thread);
+            DS_EXPECT(Log_Contains(log_content, "async thread 15 message 999"));
+            DS_EXPECT(Log_Contains(log_content, long_message));
+
+            return true;
+        });
+
+        // Test that deferred and caller-side formatting produce the same text
+        DS_TEST(logger_tests, "Deferred Formatting")
+        {
+            ds::core::Logger::Get_Instance().Set_File_Output_Mode(true);
+            ds::core::Logger::Get_Instance().Set_Synchronous_Mode(false);
+
+            const int value = -42;
+            const unsigned long long big_value = 18446744073709551615ull;
+            const char* c_string = "c string";
+            for (bool deferred : { true, false })
+            {
+                ds::core::Logger::Get_Instance().Set_Deferred_Formatting(deferred);
+
+                // The temporary string is gone long before the logger thread formats the message
+                DS_LOG_INFO("deferred {} int {} u64 {} double {} bool {} char {} text {} {}",
+                    deferred, value, big_value, 2.5, true, 'z', c_string, std::string("temporary"));
+                DS_LOG_WARN("positional {1} {0}", "second", 1);
+            }
+
+            ds::core::Logger::Get_Instance().Flush();
+            ds::core::Logger::Get_Instance().Set_Synchronous_Mode(true);
+            ds::core::Logger::Get_Instance().Set_Deferred_Formatting(true);
+
+            std::string log_content = Read_Log_File();
+            ds::core::Logger::Get_Instance().Set_File_Output_Mode(false);
+
+            const std::string expected = " int -42 u64 18446744073709551615 double 2.5 bool true char z text c string temporary";
+            DS_EXPECT(Log_Contains(log_content, "deferred true" + expected));
+            DS_EXPECT(Log_Contains(log_content, "deferred false" + expected));
+            DS_EXPECT(Log_Contains(log_content, "positional 1 second"));
+
+            return true;
+        });
+
+        // Test runtime channel levels and that filtered calls skip their arguments
+        DS_TEST(logger_tests, "Log Channels")
+        {
+            using ds::core::Logger;
+            using ds::core::Log_Channel;
+            using ds::core::Log_Level;
+
+            Logger::Get_Instance().Set_File_Output_Mode(true);
+            Logger::Set_Channel_Level(Log_Channel::MEMORY, Log_Level::WARN);
+
+            int evaluations = 0;
+            auto count_evaluation = [&evaluations]() { return ++evaluations; };
+
+            DS_LOG_CHANNEL_TRACE(MEMORY, "filtered memory trace {}", count_evaluation());
+            DS_LOG_CHANNEL_INFO(MEMORY, "filtered memory info {}", count_evaluation());
+            DS_LOG_CHANNEL_WARN(MEMORY, "visible memory warning {}", count_evaluation());
+            DS_LOG_CHANNEL_TRACE(STREAMING, "visible streaming trace {}", count_evaluation());
+            DS_EXPECT_EQ(evaluations, 2);
+
+            DS_EXPECT(!Logger::Is_Enabled(Log_Channel::MEMORY, Log_Level::INFO));
+            DS_EXPECT(Logger::Is_Enabled(Log_Channel::MEMORY, Log_Level::ERR));
+            DS_EXPECT(Logger::Get_Channel_Level(Log_Channel::MEMORY) == Log_Level::WARN);
+
+            // NONE silences a channel completely
+            Logger::Set_Channel_Level(Log_Channel::PHYSICS, Log_Level::NONE);
+            DS_EXPECT(!Logger::Is_Enabled(Log_Channel::PHYSICS, Log_Level::FATAL));
+
+            DS_EXPECT(Logger::Find_Channel("streaming") == Log_Channel::STREAMING);
+            DS_EXPECT(Logger::Find_Channel("no such channel") == Log_Channel::COUNT);
+
+            Logger::Set_Level(Log_Level::TRACE);
+            DS_EXPECT(Logger::Is_Enabled(Log_Channel::PHYSICS, Log_Level::TRACE));
+
+            std::string log_content = Read_Log_File();
+            Logger::Get_Instance().Set_File_Output_Mode(false);
+
+            DS_EXPECT(!Log_Contains(log_content, "filtered memory"));
+            DS_EXPECT(Log_Contains(log_content, "[WARN] [memory] visible memory warning 1"));
+            DS_EXPECT(Log_Contains(log_content, "[TRACE] [streaming] visible streaming trace 2"));
+
+            return true;
+        });
+
+        // Test the buffered file sink: rotation by size and plain text output
+        DS_TEST(logger_tests, "File Sink Rotation")
+        {
+            ds::core::File_Log_Sink::Config config;
+            config.path = "rotation_test.log";
+            config.max_file_size = 1024;
+            config.max_rotated_files = 2;
+            config.buffer_size = 256;
+
+            auto file_sink = std::make_unique<ds::core::File_Log_Sink>(config);
+            std::string rotated_1 = file_sink->Get_Rotated_Path(1);
+            std::string rotated_2 = file_sink->Get_Rotated_Path(2);
+            std::string rotated_3 = file_sink->Get_Rotated_Path(3);
+            for (const std::string& path : { config.path, rotated_1, rotated_2, rotated_3 })
+            {
+                std::remove(path.c_str());
+            }
+
+            ds::core::Logger::Get_Instance().Set_Synchronous_Mode(false);
+            ds::core::Log_Sink* sink = ds::core::Logger::Get_Instance().Add_Sink(std::move(file_sink));
+            for (int i = 0; i < 100; i++)
+            {
+                DS_LOG_INFO("rotation message {} {}", i, DS_STYLED(DS_CONSOLE_FG_RED, "styled"));
+            }
+            ds::core::Logger::Get_Instance().Flush();
+            ds::core::Logger::Get_Instance().Remove_Sink(sink);
+            ds::core::Logger::Get_Instance().Set_Synchronous_Mode(true);
+
+            auto read_file = [](const std::string& path)
+            {
+                std::ifstream file(path, std::ios::binary);
+                std::stringstream buffer;
+                buffer << file.rdbuf();
+                return buffer.str();
+            };
+
+            std::string active = read_file(config.path);
+            std::string newest_rotated = read_file(rotated_1);
+
+            DS_EXPECT(std::filesystem::exists(rotated_2));
+            DS_EXPECT(!std::filesystem::exists(rotated_3));
+            DS_EXPECT(active.size() <= config.max_file_size);
+            DS_EXPECT(newest_rotated.size() <= config.max_file_size);
+            DS_EXPECT(Log_Contains(active, "rotation message 99 styled"));
+            DS_EXPECT(!Log_Contains(active + newest_rotated, "\x1B"));
+
+            for (const std::string& path : { config.path, rotated_1, rotated_2 })
+            {
+                std::remove(path.c_str());
+            }
+
+            return true;
+        });
+
+        // Test cached timestamp formatting with the monotonic suffix
+        DS_TEST(logger_tests, "Monotonic Timestamps")
+        {
+            // Keeps the formatted times it is handed
+            class Time_Capture_Sink : public ds::core::Log_Sink
+            {
+            public:
+                void Write(const ds::core::Log_Message& message) override
+                {
+                    if (message.text.find(" time") != std::string_view::npos)
+                    {
+                        times.emplace_back(message.time_text);
+                        monotonic.push_back(message.time.monotonic_microseconds);
+                    }
+                }
+                void Flush() override {}
+
+                std::vector<std::string> times;
+                std::vector<unsigned long long> monotonic;
+            };
+
+            auto capture_sink = std::make_unique<Time_Capture_Sink>();
+            Time_Capture_Sink* capture = capture_sink.get();
+            ds::core::Log_Sink* sink = ds::core::Logger::Get_Instance().Add_Sink(std::move(capture_sink));
+
+            DS_LOG_INFO("plain time");
+            ds::core::Logger::Get_Instance().Set_Monotonic_Time_Mode(true);
+            DS_LOG_INFO("monotonic time 1");
+            DS_LOG_INFO("monotonic time 2");
+            ds::core::Logger::Get_Instance().Set_Monotonic_Time_Mode(false);
+            DS_LOG_INFO("plain time again");
+            ds::core::Logger::Get_Instance().Flush();
+
+            // Removing the sink destroys it, keep what it captured
+            std::vector<std::string> times = std::move(capture->times);
+            std::vector<unsigned long long> monotonic_times = std::move(capture->monotonic);
+            ds::core::Logger::Get_Instance().Remove_Sink(sink);
+
+            DS_EXPECT_EQ(times.size(), 4);
+
+            // [YYYY-MM-DD HH:MM:SS] and [YYYY-MM-DD HH:MM:SS +s.uuuuuu]
+            const std::string& plain = times[0];
+            const std::string& monotonic = times[1];
+            DS_EXPECT(plain.size() == 21 && plain.front() == '[' && plain.back() == ']');
+            DS_EXPECT(monotonic.find(" +") == 20 && monotonic.back() == ']');
+            DS_EXPECT(monotonic[monotonic.size() - 8] == '.');
+            DS_EXPECT(times[3].size() == 21);
+            DS_EXPECT(monotonic_times[1] <= monotonic_times[2]);
+
+            return true;
+        });
+
+        // Test the binary sink against the text the logger formats for the same messages
+        DS_TEST(logger_tests, "Binary Log Sink")
+        {
+            // Keeps the text of binary test messages
+            class Text_Capture_Sink : public ds::core::Log_Sink
+            {
+            public:
+                void Write(const ds::core::Log_Message& message) override
+                {
+                    if (message.text.find("binary") != std::string_view::npos)
+                    {
+                        texts.emplace_back(message.text);
+                    }
+                }
+                void Flush() override {}
+
+                std::vector<std::string> texts;
+            };
+
+            ds::core::Binary_Log_Sink::Config config;
+            config.path = "binary_test.dslog";
+            std::remove(config.path.c_str());
+
+            auto capture_sink = std::make_unique<Text_Capture_Sink>();
+            Text_Capture_Sink* capture = capture_sink.get();
+
+            ds::core::Logger::Get_Instance().Set_Synchronous_Mode(false);
+            ds::core::Log_Sink* text_sink = ds::core::Logger::Get_Instance().Add_Sink(std::move(capture_sink));
+            ds::core::Log_Sink* binary_sink = ds::core::Logger::Get_Instance().Add_Sink(std::make_unique<ds::core::Binary_Log_Sink>(config));
+
+            std::string long_text(600, 'x');
+            for (int i = 0; i < 3; i++)
+            {
+                DS_LOG_INFO("binary message {} of {} with {}", i, 3u, "text");
+            }
+            DS_LOG_WARN("binary {1} before {0}, {{escaped}} {2} {3}", -7, 'c', true, 2.5);
+            DS_LOG_CHANNEL_ERROR(MEMORY, "binary long {}", long_text);
+            DS_LOG_INFO_TEXT("binary plain text");
+            ds::core::Logger::Get_Instance().Flush();
+
+            std::vector<std::string> expected = std::move(capture->texts);
+            ds::core::Logger::Get_Instance().Remove_Sink(text_sink);
+            ds::core::Logger::Get_Instance().Remove_Sink(binary_sink);
+            ds::core::Logger::Get_Instance().Set_Synchronous_Mode(true);
+
+            ds::core::Binary_Log_Reader reader;
+            DS_EXPECT(reader.Open(config.path));
+
+            std::vector<std::string> decoded;
+            ds::core::Log_Message message;
+            bool memory_channel = false;
+            while (reader.Next(message))
+            {
+                if (message.text.find("binary") != std::string_view::npos)
+                {
+                    decoded.emplace_back(message.text);
+                    memory_channel |= message.channel == ds::core::Log_Channel::MEMORY && message.level == ds::core::Log_Level::ERR;
+                }
+            }
+
+            DS_EXPECT(!reader.Is_Truncated());
+            DS_EXPECT_EQ(reader.Get_Format_Count(), 3);
+            DS_EXPECT_EQ(decoded.size(), 6);
+            DS_EXPECT(decoded == expected);
+            DS_EXPECT(memory_channel);
+
+            // A file cut inside its last entry still reads up to that entry
+            std::string truncated_path = "binary_test_truncated.dslog";
+            std::ifstream source(config.path, std::ios::binary);
+            std::string bytes((std::istreambuf_iterator<char>(source)), std::istreambuf_iterator<char>());
+            std::ofstream(truncated_path, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 5));
+
+            ds::core::Binary_Log_Reader truncated_reader;
+            DS_EXPECT(truncated_reader.Open(truncated_path));
+            int truncated_count = 0;
+            while (truncated_reader.Next(message))
+            {
+                if (message.text.find("binary") != std::string_view::npos)
+                {
+                    truncated_count++;
+                }
+            }
+            DS_EXPECT(truncated_reader.Is_Truncated());
+            DS_EXPECT_EQ(truncated_count, 5);
+
+            std::remove(config.path.c_str());
+            std::remove(truncated_path.c_str());
+
+            return true;
+        });
+
+        // Test dropping by level while the logger thread is stuck in a sink
+        DS_TEST(logger_tests, "Overflow Policies")
+        {
+            // Holds the logger thread inside Write on the gate message until it is opened
+            class Gate_Sink : public ds::core::Log_Sink
+            {
+            public:
+                void Write(const ds::core::Log_Message& message) override
+                {
+                    if (message.text == "overflow gate")
+                    {
+                        entered = true;
+                        while (!open)
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                    else if (message.text.starts_with("overflow") || message.text.starts_with("Logger dropped"))
+                    {
+                        texts.emplace_back(message.text);
+                    }
+                }
+                void Flush() override {}
+
+                std::atomic<bool> entered{ false };
+                std::atomic<bool> open{ false };
+                std::vector<std::string> texts;
+            };
+
+            ds::core::Logger& logger = ds::core::Logger::Get_Instance();
+            unsigned long long dropped_before = logger.Get_Dropped_Message_Count();
+
+            auto gate_sink = std::make_unique<Gate_Sink>();
+            Gate_Sink* gate = gate_sink.get();
+
+            logger.Set_Synchronous_Mode(false);
+            logger.Set_Overflow_Policy(ds::core::Log_Overflow_Policy::DROP_BY_LEVEL);
+            logger.Set_Overflow_Level(ds::core::Log_Level::WARN);
+            ds::core::Log_Sink* sink = logger.Add_Sink(std::move(gate_sink));
+
+            DS_LOG_INFO("overflow gate");
+            while (!gate->entered)
+            {
+                std::this_thread::yield();
+            }
+
+            // The ring is empty now and takes 512 records, the rest of the trace messages are dropped
+            for (int i = 0; i < 1000; i++)
+            {
+                DS_LOG_TRACE("overflow trace {}", i);
+            }
+
+            // Warnings wait for room instead
+            std::thread opener([gate] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                gate->open = true;
+            });
+            for (int i = 0; i < 3; i++)
+            {
+                DS_LOG_WARN("overflow warn {}", i);
+            }
+            opener.join();
+            logger.Flush();
+
+            std::vector<std::string> texts = std::move(gate->texts);
+            logger.Remove_Sink(sink);
+            logger.Set_Overflow_Policy(ds::core::Log_Overflow_Policy::BLOCK);
+            logger.Set_Synchronous_Mode(true);
+
+            int traces = 0;
+            int warnings = 0;
+            bool reported = false;
+            for (const std::string& text : texts)
+            {
+                traces += text.starts_with("overflow trace");
+                warnings += text.starts_with("overflow warn");
+                reported |= text.starts_with("Logger dropped 488 messages: 488 trace");
+            }
+
+            DS_EXPECT_EQ(logger.Get_Dropped_Message_Count() - dropped_before, 488);
+            DS_EXPECT_EQ(traces, 512);
+            DS_EXPECT_EQ(warnings, 3);
+            DS_EXPECT(reported);
+
+            return true;
+        });
+
+        // Test the crash log, last because it stays enabled. Threads that logged before keep their
+        // heap rings, so the messages come from a new thread.
+        DS_TEST(logger_tests, "Crash Log")
+        {
+            ds::core::Logger& logger = ds::core::Logger::Get_Instance();
+            std::string path = "crash_test.dscrash";
+            DS_EXPECT(logger.Enable_Crash_Log(path, 128 * 1024));
+
+            // A second call must leave the enabled file alone
+            DS_EXPECT(!logger.Enable_Crash_Log(path, 128 * 1024));
+
+            logger.Set_Synchronous_Mode(false);
+            std::string long_text(400, 'y');
+            std::thread writer([&long_text] {
+                // 603 records in a ring of 512, the first 91 messages are overwritten
+                for (int i = 0; i < 600; i++)
+                {
+                    DS_LOG_INFO("crash message {} {}", i, "deferred");
+                }
+                DS_LOG_CHANNEL_WARN(MEMORY, "crash long {}", long_text);
+                DS_LOG_INFO_TEXT("crash plain text");
+            });
+            writer.join();
+            logger.Flush();
+            logger.Set_Synchronous_Mode(true);
+
+            // The mapping is shared, so the file already reads as it would after a crash
+            ds::core::Crash_Log_Reader reader;
+            DS_EXPECT(reader.Open(path));
+
+            std::vector<std::string> texts;
+            ds::core::Log_Message message;
+            bool memory_channel = false;
+            while (reader.Next(message))
+            {
+                if (message.text.starts_with("crash"))
+                {
+                    texts.emplace_back(message.text);
+                    memory_channel |= message.channel == ds::core::Log_Channel::MEMORY && message.level == ds::core::Log_Level::WARN;
+                }
+            }
+
+            DS_EXPECT_EQ(texts.size(), 511);
+            DS_EXPECT(texts.front() == "crash message 91 deferred");
+            DS_EXPECT(texts[508] == "crash message 599 deferred");
+            DS_EXPECT(texts[509] == "crash long " + long_text);
+            DS_EXPECT(texts[510] == "crash plain text");
+            DS_EXPECT(memory_channel);
+
+            // The logger keeps its mapping, only the name goes
+            std::remove(path.c_str());
+
+            return true;
+        });
+
         // Run all tests
         return logger_tests.Run_All();
     });
+
+    // The file output tests write here
+    std::remove("ds.log");
+
+    return result;
 }
\ No newline at end of file
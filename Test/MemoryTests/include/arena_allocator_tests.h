@@ -274,6 +274,35 @@ namespace ds::test::arena_allocator
         return true;
     }
 
+    // Test growing the latest allocation in place
+    static bool Test_Arena_Expand()
+    {
+        Arena_Allocator arena(4096, "ExpandArena");
+
+        void* first = arena.Allocate(128);
+        void* second = arena.Allocate(128);
+        DS_EXPECT(first != nullptr && second != nullptr);
+
+        // Only the latest allocation has free space behind it
+        DS_EXPECT(!arena.Try_Expand(first, 128, 256));
+        DS_EXPECT(arena.Try_Expand(second, 128, 512));
+
+        ds_u64 used = arena.Get_Used_Size();
+        DS_EXPECT(static_cast<ds_u8*>(second) + 512 == static_cast<ds_u8*>(first) + used);
+
+        // Can't grow past the end of the arena
+        DS_EXPECT(!arena.Try_Expand(second, 512, 8192));
+        DS_EXPECT(arena.Get_Used_Size() == used);
+
+        // New allocations start after the expanded block
+        void* third = arena.Allocate(64);
+        DS_EXPECT(static_cast<ds_u8*>(third) >= static_cast<ds_u8*>(second) + 512);
+
+        arena.Reset();
+
+        return true;
+    }
+
     static bool Add_All_Tests(Test_Suite& test_suite)
     {
         DS_TEST(test_suite, "Basic Arena Operations")
@@ -306,6 +335,11 @@ namespace ds::test::arena_allocator
             return Test_Arena_Multiple_Allocations();
         });
 
+        DS_TEST(test_suite, "Arena Expand")
+        {
+            return Test_Arena_Expand();
+        });
+
         return true;
     }
 }
\ No newline at end of file
@@ -441,6 +441,43 @@ namespace ds::test::free_list_allocator
         return true;
     }
 
+    // Test growing an allocation into the free block after it
+    static ds_bool Test_Free_List_Expand()
+    {
+        Free_List_Allocator allocator(64 * 1024, Free_List_Allocator::Allocation_Strategy::FIND_FIRST, "ExpandFreeList");
+
+        void* first = allocator.Allocate(256);
+        void* second = allocator.Allocate(256);
+        void* third = allocator.Allocate(256);
+        DS_EXPECT(first != nullptr && second != nullptr && third != nullptr);
+
+        Memory::Memset(first, 0xAB, 256);
+
+        // The block after 'first' is in use
+        DS_EXPECT(!allocator.Try_Expand(first, 1024));
+
+        // Once it is freed, 'first' can grow into it without moving
+        DS_EXPECT(allocator.Deallocate(second));
+        DS_EXPECT(allocator.Try_Expand(first, 400));
+        DS_EXPECT(static_cast<ds_u8*>(first)[255] == 0xAB);
+        Memory::Memset(first, 0xCD, 400);
+
+        // Growing beyond the freed block is refused
+        DS_EXPECT(!allocator.Try_Expand(first, 4096));
+
+        // The last block can grow into the remaining free space
+        DS_EXPECT(allocator.Try_Expand(third, 8 * 1024));
+        Memory::Memset(third, 0xEF, 8 * 1024);
+
+        DS_EXPECT(allocator.Deallocate(first));
+        DS_EXPECT(allocator.Deallocate(third));
+
+        // Everything coalesces back into one block
+        DS_EXPECT(allocator.Get_Largest_Free_Block_Size() == allocator.Get_Size() - sizeof(Free_List_Allocator::Block_Header));
+
+        return true;
+    }
+
     // Test move operations
     static ds_bool Test_Free_List_Move_Operations()
     {
@@ -570,6 +607,11 @@ namespace ds::test::free_list_allocator
             return Test_Free_List_Largest_Free_Block();
         });
 
+        DS_TEST(test_suite, "Free List Expand")
+        {
+            return Test_Free_List_Expand();
+        });
+
         DS_TEST(test_suite, "Free List Move Operations")
         {
             return Test_Free_List_Move_Operations();
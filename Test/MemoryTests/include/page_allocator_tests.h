@@ -261,6 +261,42 @@ namespace ds::test::page_allocator
         return true;
     }
 
+    // Test growing the latest allocation into the reserved address space
+    static ds_bool Test_Page_Expand()
+    {
+        Page_Allocator allocator(0, 1024 * 1024, "ExpandPageAllocator");
+        ds_u64 page_size = allocator.Get_Page_Size();
+
+        void* first = allocator.Allocate(page_size);
+        void* second = allocator.Allocate(page_size);
+        DS_EXPECT(first != nullptr && second != nullptr);
+        Memory::Memset(second, 0x5A, page_size);
+
+        // Only the last allocation borders uncommitted reserved space
+        DS_EXPECT(!allocator.Try_Expand(first, page_size * 2));
+        DS_EXPECT(allocator.Try_Expand(second, page_size * 4));
+        DS_EXPECT(allocator.Get_Page_Info(second)->size == page_size * 4);
+        DS_EXPECT(allocator.Get_Allocated_Page_Count() == 5);
+
+        // The new pages are committed and zeroed, the old ones keep their contents
+        ds_u8* bytes = static_cast<ds_u8*>(second);
+        DS_EXPECT(bytes[page_size - 1] == 0x5A);
+        DS_EXPECT(bytes[page_size] == 0);
+        Memory::Memset(bytes + page_size, 0x11, page_size * 3);
+
+        // Sizes that already fit succeed without committing anything
+        DS_EXPECT(allocator.Try_Expand(second, page_size * 3));
+        DS_EXPECT(allocator.Get_Allocated_Page_Count() == 5);
+
+        // Can't grow past the reserved range
+        DS_EXPECT(!allocator.Try_Expand(second, 4 * 1024 * 1024));
+
+        DS_EXPECT(allocator.Deallocate(first));
+        DS_EXPECT(allocator.Deallocate(second));
+
+        return true;
+    }
+
     // Test validation of pointers
     static ds_bool Test_Page_Pointer_Validation()
     {
@@ -455,6 +491,11 @@ namespace ds::test::page_allocator
             return Test_Page_Reserved_Address_Space();
         });
 
+        DS_TEST(test_suite, "Page Expand")
+        {
+            return Test_Page_Expand();
+        });
+
         DS_TEST(test_suite, "Page Pointer Validation")
         {
             return Test_Page_Pointer_Validation();
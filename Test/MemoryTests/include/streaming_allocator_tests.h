@@ -1,6 +1,7 @@
 #pragma once
 #include <core/ds_pch.h>
 #include <core/memory/streaming_allocator.h>
+#include <core/memory/allocator_adapters.h>
 #include <test_framework.h>
 
 using namespace ds::core::memory;
@@ -804,6 +805,378 @@ namespace ds::test::streaming_allocator
         return true;
     }
 
+    // Test telemetry snapshot and dump
+    static ds_bool Test_Streaming_Telemetry()
+    {
+        Streaming_Allocator::Config config;
+        config.total_memory_budget = 16 * 1024 * 1024; // 16MB, generic budget is 3% (~491KB)
+        std::unique_ptr<Streaming_Allocator> allocator =
+            std::make_unique<Streaming_Allocator>(config, "TelemetryStreamingAllocator");
+
+        // A fresh allocator should report empty telemetry
+        auto snapshot = allocator->Get_Telemetry_Snapshot();
+        const int generic = static_cast<int>(Streaming_Allocator::Resource_Category::GENERIC);
+        DS_EXPECT(snapshot.category_latency[generic].sample_count == 0);
+        DS_EXPECT(snapshot.budget_rejections[generic] == 0);
+
+        Streaming_Allocator::Resource_Request request;
+        request.resource_id = 0;
+        request.path = "test_data/stats_resource.bin";
+        request.category = Streaming_Allocator::Resource_Category::GENERIC;
+        request.priority = Resource_Priority::MEDIUM;
+        request.access_mode = Streaming_Allocator::Access_Mode::READ_ONLY;
+        request.callback = nullptr;
+        request.user_data = nullptr;
+        request.auto_unload = true;
+        request.estimated_size = 64 * 1024;
+
+        Resource_Handle handle = allocator->Request_Resource(request);
+        DS_EXPECT(handle.IsValid());
+        allocator->Update(0.016f);
+
+        // One load should show up in the category, priority and phase histograms
+        snapshot = allocator->Get_Telemetry_Snapshot();
+        DS_EXPECT(snapshot.category_latency[generic].sample_count == 1);
+        DS_EXPECT(snapshot.priority_latency[static_cast<int>(Resource_Priority::MEDIUM)].sample_count == 1);
+        DS_EXPECT(snapshot.phase_latency[static_cast<int>(Streaming_Allocator::Load_Phase::QUEUE_WAIT)].sample_count == 1);
+        DS_EXPECT(snapshot.phase_latency[static_cast<int>(Streaming_Allocator::Load_Phase::IO)].sample_count == 1);
+        DS_EXPECT(snapshot.bandwidth_bytes_per_second > 0.0);
+
+        // A request larger than the generic budget should count as a budget rejection
+        Streaming_Allocator::Resource_Request large_request = request;
+        large_request.path = "memory://telemetry_large";
+        large_request.estimated_size = 4 * 1024 * 1024;
+        Resource_Handle large_handle = allocator->Request_Resource(large_request);
+        DS_EXPECT(large_handle.IsValid());
+        allocator->Update(0.016f);
+
+        snapshot = allocator->Get_Telemetry_Snapshot();
+        DS_EXPECT(snapshot.budget_rejections[generic] == 1);
+
+        // Unloading counts as an eviction
+        DS_EXPECT(allocator->Unload_Resource(handle));
+        allocator->Update(0.016f);
+
+        snapshot = allocator->Get_Telemetry_Snapshot();
+        DS_EXPECT(snapshot.evictions[generic] == 1);
+        DS_EXPECT(snapshot.evicted_bytes[generic] == 64 * 1024);
+        DS_EXPECT(snapshot.evictions_per_second > 0.0);
+
+        // Both dump formats should produce a file
+        DS_EXPECT(allocator->Dump_Telemetry("test_data/telemetry.json", Streaming_Allocator::Telemetry_Format::JSON));
+        DS_EXPECT(allocator->Dump_Telemetry("test_data/telemetry.csv", Streaming_Allocator::Telemetry_Format::CSV));
+        DS_EXPECT(std::filesystem::file_size("test_data/telemetry.json") > 0);
+        DS_EXPECT(std::filesystem::file_size("test_data/telemetry.csv") > 0);
+
+        return true;
+    }
+
+    static ds_bool Test_Streaming_Bundles()
+    {
+        Streaming_Allocator::Config config;
+        config.total_memory_budget = 64 * 1024 * 1024;
+        config.max_concurrent_operations = 4;
+        std::unique_ptr<Streaming_Allocator> allocator =
+            std::make_unique<Streaming_Allocator>(config, "BundleStreamingAllocator");
+
+        // Resources record their load order; the bundle counts its completions
+        struct Load_Order
+        {
+            ds_u64 ids[8];
+            ds_u32 count;
+            ds_u32 bundle_callbacks;
+        } order = {};
+
+        auto resource_callback = [](ds_u64 resource_id, void*, ds_u64, void* user_data) {
+            Load_Order* load_order = static_cast<Load_Order*>(user_data);
+            load_order->ids[load_order->count++] = resource_id;
+        };
+
+        auto bundle_callback = [](ds_u64, void* user_data) {
+            static_cast<Load_Order*>(user_data)->bundle_callbacks++;
+        };
+
+        // Six resources from one package, requested in reverse file order
+        const ds_u32 resource_count = 6;
+        Streaming_Allocator::Resource_Request requests[resource_count];
+        for (ds_u32 i = 0; i < resource_count; i++)
+        {
+            requests[i].resource_id = 0;
+            requests[i].path = "memory://bundle_package";
+            requests[i].category = Streaming_Allocator::Resource_Category::GENERIC;
+            requests[i].priority = Resource_Priority::MEDIUM;
+            requests[i].access_mode = Streaming_Allocator::Access_Mode::READ_WRITE;
+            requests[i].callback = resource_callback;
+            requests[i].user_data = &order;
+            requests[i].auto_unload = false;
+            requests[i].estimated_size = 4096;
+            requests[i].file_offset = (resource_count - 1 - i) * 4096;
+        }
+
+        Streaming_Allocator::Bundle_Request bundle_request;
+        bundle_request.requests = requests;
+        bundle_request.request_count = resource_count;
+        bundle_request.callback = bundle_callback;
+        bundle_request.user_data = &order;
+
+        Bundle_Handle bundle = allocator->Request_Bundle(bundle_request);
+        DS_EXPECT(bundle.IsValid());
+        DS_EXPECT(bundle.state == Resource_State::LOADING);
+
+        // Only four operations run per update, so the bundle is not complete yet
+        allocator->Update(0.016f);
+        const Streaming_Allocator::Bundle_Info* info = allocator->Get_Bundle_Info(bundle);
+        DS_EXPECT(info != nullptr);
+        DS_EXPECT_EQ(info->resource_count, resource_count);
+        DS_EXPECT_EQ(info->resident_count, 4u);
+        DS_EXPECT(info->state == Resource_State::LOADING);
+        DS_EXPECT_EQ(order.bundle_callbacks, 0u);
+
+        allocator->Update(0.016f);
+        info = allocator->Get_Bundle_Info(bundle);
+        DS_EXPECT(info->state == Resource_State::RESIDENT);
+        DS_EXPECT_EQ(order.bundle_callbacks, 1u);
+
+        // Loads were issued in file offset order, which is the reverse of the request order
+        DS_EXPECT_EQ(order.count, resource_count);
+        for (ds_u32 i = 0; i < resource_count; i++)
+        {
+            Resource_Handle resource = allocator->Get_Bundle_Resource(bundle, resource_count - 1 - i);
+            DS_EXPECT(resource.IsReady());
+            DS_EXPECT_EQ(order.ids[i], resource.id);
+        }
+
+        // The callback fires only once
+        allocator->Update(0.016f);
+        DS_EXPECT_EQ(order.bundle_callbacks, 1u);
+
+        DS_EXPECT(allocator->Unload_Bundle(bundle));
+        allocator->Update(0.016f);
+        allocator->Update(0.016f);
+        DS_EXPECT(allocator->Get_Bundle_Info(bundle) == nullptr);
+        DS_EXPECT(allocator->Get_Stats().total_memory_used == 0);
+
+        return true;
+    }
+
+    static ds_bool Test_Streaming_Dependencies()
+    {
+        std::unique_ptr<Streaming_Allocator> allocator =
+            std::make_unique<Streaming_Allocator>(Streaming_Allocator::Config(), "DependencyStreamingAllocator");
+
+        Streaming_Allocator::Resource_Request request;
+        request.resource_id = 0;
+        request.path = "memory://dependency";
+        request.category = Streaming_Allocator::Resource_Category::GENERIC;
+        request.priority = Resource_Priority::LOW;
+        request.access_mode = Streaming_Allocator::Access_Mode::READ_WRITE;
+        request.callback = nullptr;
+        request.user_data = nullptr;
+        request.auto_unload = false;
+        request.estimated_size = 4096;
+
+        Resource_Handle dependency = allocator->Request_Resource(request);
+
+        // The dependent is more urgent, so it is dequeued first and has to wait
+        request.path = "memory://dependent";
+        request.priority = Resource_Priority::HIGH;
+        Resource_Handle dependent = allocator->Request_Resource(request);
+
+        DS_EXPECT(allocator->Add_Resource_Dependency(dependent, dependency));
+        DS_EXPECT(!allocator->Add_Resource_Dependency(dependency, dependent));
+        DS_EXPECT(!allocator->Add_Resource_Dependency(dependent, dependent));
+
+        allocator->Update(0.016f);
+        DS_EXPECT(allocator->Get_Resource_Info(dependency)->state == Resource_State::RESIDENT);
+        DS_EXPECT(allocator->Get_Resource_Info(dependent)->state == Resource_State::LOADING);
+
+        allocator->Update(0.016f);
+        DS_EXPECT(allocator->Get_Resource_Info(dependent)->state == Resource_State::RESIDENT);
+
+        return true;
+    }
+
+    static ds_bool Test_Streaming_Adaptive_Budgets()
+    {
+        Streaming_Allocator::Config config;
+        config.total_memory_budget = 16 * 1024 * 1024; // Texture 8MB, geometry ~4.8MB
+        config.enable_adaptive_budgets = true;
+        config.guaranteed_budget_percent = 50;
+        std::unique_ptr<Streaming_Allocator> allocator =
+            std::make_unique<Streaming_Allocator>(config, "AdaptiveStreamingAllocator");
+
+        Streaming_Allocator::Resource_Request request;
+        request.resource_id = 0;
+        request.path = "memory://adaptive_texture";
+        request.category = Streaming_Allocator::Resource_Category::TEXTURE;
+        request.priority = Resource_Priority::MEDIUM;
+        request.access_mode = Streaming_Allocator::Access_Mode::READ_WRITE;
+        request.callback = nullptr;
+        request.user_data = nullptr;
+        request.auto_unload = false;
+        request.estimated_size = 10 * 1024 * 1024;
+
+        // The texture is 2MB over its budget and borrows from the other categories
+        Resource_Handle texture = allocator->Request_Resource(request);
+        allocator->Update(0.016f);
+        DS_EXPECT(allocator->Get_Resource_Info(texture)->state == Resource_State::RESIDENT);
+
+        const int texture_index = static_cast<int>(Streaming_Allocator::Resource_Category::TEXTURE);
+        const int geometry_index = static_cast<int>(Streaming_Allocator::Resource_Category::GEOMETRY);
+
+        auto stats = allocator->Get_Stats();
+        DS_EXPECT_EQ(stats.total_memory_borrowed, 2ull * 1024 * 1024);
+        DS_EXPECT_EQ(stats.category_stats[texture_index].memory_borrowed, 2ull * 1024 * 1024);
+
+        ds_u64 total_lent = 0;
+        for (int i = 0; i < 6; i++)
+        {
+            total_lent += stats.category_stats[i].memory_lent;
+        }
+        DS_EXPECT_EQ(total_lent, stats.total_memory_borrowed);
+
+        // Guaranteed budgets are never lent, so a request that needs them still fails
+        request.path = "memory://adaptive_texture_too_large";
+        request.estimated_size = 4 * 1024 * 1024;
+        Resource_Handle too_large = allocator->Request_Resource(request);
+        allocator->Update(0.016f);
+        DS_EXPECT(allocator->Get_Resource_Info(too_large)->state == Resource_State::FAILED);
+
+        // Geometry fits its own budget but needs back what it lent, so the texture is evicted
+        request.path = "memory://adaptive_geometry";
+        request.category = Streaming_Allocator::Resource_Category::GEOMETRY;
+        request.estimated_size = 4608 * 1024;
+        Resource_Handle geometry = allocator->Request_Resource(request);
+        allocator->Update(0.016f);
+        DS_EXPECT(allocator->Get_Resource_Info(geometry)->state == Resource_State::RESIDENT);
+        DS_EXPECT(allocator->Get_Resource_Info(texture)->state == Resource_State::UNLOADED);
+
+        stats = allocator->Get_Stats();
+        DS_EXPECT_EQ(stats.borrowed_evictions, 1u);
+        DS_EXPECT_EQ(stats.total_memory_borrowed, 0ull);
+        DS_EXPECT_EQ(stats.category_stats[geometry_index].memory_used, 4608ull * 1024);
+        DS_EXPECT(stats.total_memory_used <= stats.total_memory_budget);
+
+        return true;
+    }
+
+    static ds_bool Test_Streaming_Direct_Memory()
+    {
+        Streaming_Allocator::Config config;
+        config.total_memory_budget = 16 * 1024 * 1024; // Generic budget is 3% (~491KB)
+        std::unique_ptr<Streaming_Allocator> allocator =
+            std::make_unique<Streaming_Allocator>(config, "DirectStreamingAllocator");
+
+        // Allocations are usable immediately and charged to the budget in whole pages
+        Streaming_Allocator_Adapter<ds_u32> adapter(*allocator);
+        ds_u32* values = adapter.allocate(1000);
+        DS_EXPECT(values != nullptr);
+        DS_EXPECT(reinterpret_cast<ds_uiptr>(values) % Page_Allocator::Get_System_Page_Size() == 0);
+        for (ds_u32 i = 0; i < 1000; i++)
+        {
+            values[i] = i;
+        }
+        DS_EXPECT_EQ(values[999], 999u);
+
+        auto stats = allocator->Get_Stats();
+        DS_EXPECT_EQ(stats.direct_allocation_count, 1u);
+        DS_EXPECT_EQ(stats.total_memory_used, config.page_size);
+        DS_EXPECT_EQ(stats.resource_count, 0ull);
+
+        // Requests beyond the category budget are refused instead of waiting
+        void* too_large = allocator->Allocate_Memory(1024 * 1024);
+        DS_EXPECT(too_large == nullptr);
+
+        // Released pages are reused by the next allocation of the same size
+        adapter.deallocate(values, 1000);
+        stats = allocator->Get_Stats();
+        DS_EXPECT_EQ(stats.direct_allocation_count, 0u);
+        DS_EXPECT_EQ(stats.total_memory_used, 0ull);
+
+        DS_EXPECT_EQ(stats.cached_memory_bytes, config.page_size);
+
+        ds_u32* reused = adapter.allocate(1000);
+        DS_EXPECT(reused == values);
+        DS_EXPECT_EQ(allocator->Get_Stats().cached_memory_bytes, 0ull);
+        adapter.deallocate(reused, 1000);
+
+        // Clearing resources also gives the cached pages back
+        allocator->Clear_Non_Critical_Resources();
+        DS_EXPECT_EQ(allocator->Get_Stats().cached_memory_bytes, 0ull);
+
+        return true;
+    }
+
+    static ds_bool Test_Streaming_Hot_Reload()
+    {
+#ifdef DS_PLATFORM_LINUX
+        const char* path = "test_data/hot_reload.bin";
+        {
+            std::ofstream file(path, std::ios::binary);
+            std::string contents(4096, 'A');
+            file.write(contents.data(), contents.size());
+        }
+
+        Streaming_Allocator::Config config;
+        config.enable_hot_reload = true;
+        std::unique_ptr<Streaming_Allocator> allocator =
+            std::make_unique<Streaming_Allocator>(config, "HotReloadStreamingAllocator");
+
+        ds_u32 callback_count = 0;
+        Streaming_Allocator::Resource_Request request;
+        request.resource_id = 0;
+        request.path = path;
+        request.category = Streaming_Allocator::Resource_Category::GENERIC;
+        request.priority = Resource_Priority::MEDIUM;
+        request.access_mode = Streaming_Allocator::Access_Mode::READ_ONLY;
+        request.callback = [](ds_u64, void*, ds_u64, void* user_data) { (*static_cast<ds_u32*>(user_data))++; };
+        request.user_data = &callback_count;
+        request.auto_unload = false;
+        request.estimated_size = 4096;
+
+        Resource_Handle handle = allocator->Request_Resource(request);
+        allocator->Update(0.016f);
+        DS_EXPECT_EQ(callback_count, 1u);
+        DS_EXPECT(static_cast<const char*>(allocator->Access_Resource(handle))[0] == 'A');
+
+        // Save the new contents the way editors do: write a temporary file and rename it over the old one
+        {
+            std::ofstream file("test_data/hot_reload.tmp", std::ios::binary);
+            std::string contents(8192, 'B');
+            file.write(contents.data(), contents.size());
+        }
+        // A referenced resource keeps its old data until the reference is released
+        DS_EXPECT(allocator->Reference_Resource(handle));
+        std::filesystem::rename("test_data/hot_reload.tmp", path);
+
+        for (int i = 0; i < 30; i++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            allocator->Update(0.016f);
+        }
+
+        DS_EXPECT_EQ(callback_count, 1u);
+        DS_EXPECT(static_cast<const char*>(allocator->Access_Resource(handle))[0] == 'A');
+        DS_EXPECT(allocator->Release_Resource(handle));
+
+        // The watcher reloads in the background, Update swaps the data in
+        for (int i = 0; i < 200 && callback_count < 2; i++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            allocator->Update(0.016f);
+        }
+
+        DS_EXPECT_EQ(callback_count, 2u);
+        DS_EXPECT(static_cast<const char*>(allocator->Access_Resource(handle))[0] == 'B');
+        DS_EXPECT_EQ(allocator->Get_Resource_Info(handle)->size, 8192ull);
+
+        auto stats = allocator->Get_Stats();
+        DS_EXPECT_EQ(stats.hot_reload_count, 1u);
+        DS_EXPECT_EQ(stats.total_memory_used, 8192ull);
+#endif
+        return true;
+    }
+
     // Add all tests to the test suite
     static ds_bool Add_All_Tests(Test_Suite& test_suite)
     {
@@ -860,6 +1233,36 @@ namespace ds::test::streaming_allocator
             return Test_Streaming_Memory_Mapped_Files();
         });
 
+        DS_TEST(test_suite, "Streaming Telemetry")
+        {
+            return Test_Streaming_Telemetry();
+        });
+
+        DS_TEST(test_suite, "Streaming Bundle Loading")
+        {
+            return Test_Streaming_Bundles();
+        });
+
+        DS_TEST(test_suite, "Streaming Resource Dependencies")
+        {
+            return Test_Streaming_Dependencies();
+        });
+
+        DS_TEST(test_suite, "Streaming Adaptive Budgets")
+        {
+            return Test_Streaming_Adaptive_Budgets();
+        });
+
+        DS_TEST(test_suite, "Streaming Direct Memory")
+        {
+            return Test_Streaming_Direct_Memory();
+        });
+
+        DS_TEST(test_suite, "Streaming Hot Reload")
+        {
+            return Test_Streaming_Hot_Reload();
+        });
+
         return true;
     }
 }
\ No newline at end of file
@@ -0,0 +1,547 @@
+#pragma once
+#include <core/ds_pch.h>
+#include <core/profiler/profiler.h>
+#include <core/profiler/trace_export.h>
+#include <core/memory/memory.h>
+#include <core/platform/time.h>
+#include <test_framework.h>
+
+#include <fstream>
+#include <sstream>
+
+using namespace ds::core;
+using namespace ds::core::memory;
+using namespace ds::core::profiler;
+using namespace ds::test;
+
+namespace ds::test::profiler
+{
+	// Config used by the suite, passed explicitly whenever the profiler is restarted
+	static Profiler::Config Make_Test_Config(ds_u64 thread_buffer_capacity)
+	{
+		Profiler::Config config;
+		config.thread_buffer_capacity = thread_buffer_capacity;
+		config.calibration_milliseconds = 20;
+		return config;
+	}
+
+	// Id of the first thread whose tree has a zone with that name
+	static ds_u32 Find_Thread_With_Zone(const Profile_Frame& frame, std::string_view name)
+	{
+		for (const Profile_Thread& thread : frame.threads)
+		{
+			if (frame.Find_Node(thread.id, name))
+			{
+				return thread.id;
+			}
+		}
+		return PROFILE_NO_PARENT;
+	}
+
+	static void Simulate_Physics()
+	{
+		DS_PROFILE_FUNCTION();
+	}
+
+	static std::string Read_File(const std::string& path)
+	{
+		std::ifstream file(path, std::ios::binary);
+		std::stringstream content;
+		content << file.rdbuf();
+		return content.str();
+	}
+
+	static ds_u64 Count_Occurrences(std::string_view text, std::string_view pattern)
+	{
+		ds_u64 count = 0;
+		for (ds_u64 at = text.find(pattern); at != std::string_view::npos; at = text.find(pattern, at + 1))
+		{
+			count++;
+		}
+		return count;
+	}
+
+	// Restart the profiler recording allocations and profile a frame with every kind of event
+	static void Record_Export_Frame()
+	{
+		Profiler::Shutdown();
+		Profiler::Config config = Make_Test_Config(16 * 1024);
+		config.record_allocations = true;
+		Profiler::Initialize(config);
+		Profiler::Set_Thread_Name("Main");
+
+		static ds_u8 pool_block[64];
+
+		Profiler::Begin_Frame();
+		{
+			DS_PROFILE_SCOPE("Frame");
+			{
+				DS_PROFILE_SCOPE_CATEGORY("Streaming Load", STREAMING, 42);
+				DS_PROFILE_ALLOCATION("Test Pool", pool_block, sizeof(pool_block));
+			}
+			{
+				DS_PROFILE_SCOPE_CATEGORY("Log Flush", LOGGER, 3);
+			}
+			DS_PROFILE_FREE("Test Pool", pool_block);
+
+			void* block = Memory::Malloc(128);
+			Memory::Free(block);
+		}
+		Profiler::End_Frame();
+	}
+
+	// A field of a protobuf message, varints in value and length delimited fields in bytes
+	struct Proto_Field
+	{
+		ds_u32 number;
+		ds_u64 value;
+		std::string_view bytes;
+	};
+
+	static ds_u64 Read_Varint(std::string_view data, ds_u64& at)
+	{
+		ds_u64 value = 0;
+		for (ds_u32 shift = 0; at < data.size(); shift += 7)
+		{
+			ds_u8 byte = static_cast<ds_u8>(data[at++]);
+			value |= static_cast<ds_u64>(byte & 0x7F) << shift;
+			if (!(byte & 0x80))
+			{
+				break;
+			}
+		}
+		return value;
+	}
+
+	// Fields of a message with varint and length delimited fields only, empty if it is malformed
+	static std::vector<Proto_Field> Read_Message(std::string_view data)
+	{
+		std::vector<Proto_Field> fields;
+		ds_u64 at = 0;
+		while (at < data.size())
+		{
+			ds_u64 key = Read_Varint(data, at);
+			Proto_Field field{ static_cast<ds_u32>(key >> 3), 0, {} };
+			if ((key & 7) == 0)
+			{
+				field.value = Read_Varint(data, at);
+			}
+			else if ((key & 7) == 2)
+			{
+				ds_u64 length = Read_Varint(data, at);
+				if (at + length > data.size())
+				{
+					return {};
+				}
+				field.bytes = data.substr(at, length);
+				at += length;
+			}
+			else
+			{
+				return {};
+			}
+			fields.push_back(field);
+		}
+		return fields;
+	}
+
+	static const Proto_Field* Find_Field(const std::vector<Proto_Field>& fields, ds_u32 number)
+	{
+		for (const Proto_Field& field : fields)
+		{
+			if (field.number == number)
+			{
+				return &field;
+			}
+		}
+		return nullptr;
+	}
+
+	// Test that the calibrated clock agrees with Platform_Time
+	static ds_bool Test_Clock_Calibration()
+	{
+		DS_EXPECT(Profiler::Is_Initialized());
+		DS_EXPECT_GT(Profile_Clock::Get_Ticks_Per_Microsecond(), 0.0);
+
+		ds_u64 start = Profile_Clock::Now();
+		Platform_Time::Sleep(20);
+		ds_f64 elapsed = Profile_Clock::Get_Microseconds(Profile_Clock::Now() - start);
+		DS_EXPECT_GE(elapsed, 19000.0);
+		DS_EXPECT_LT(elapsed, 200000.0);
+
+		// Ticks land on the clock log messages are stamped with
+		ds_f64 platform_now = static_cast<ds_f64>(Platform_Time::Get_Time_Microseconds());
+		DS_EXPECT_NEAR(Profile_Clock::Get_Platform_Microseconds(Profile_Clock::Now()), platform_now, 2000.0);
+
+		return true;
+	}
+
+	// Test that nested zones merge into a call tree with self and total times
+	static ds_bool Test_Frame_Call_Tree()
+	{
+		Profiler::Begin_Frame();
+		{
+			DS_PROFILE_SCOPE("Frame");
+			for (ds_u32 i = 0; i < 3; i++)
+			{
+				DS_PROFILE_SCOPE("Update");
+				Simulate_Physics();
+			}
+			{
+				DS_PROFILE_SCOPE("Render");
+				Platform_Time::Sleep(2);
+			}
+		}
+		Profiler::End_Frame();
+
+		const Profile_Frame& frame = Profiler::Get_Last_Frame();
+		DS_EXPECT_EQ(frame.zones.size(), 8u);
+		DS_EXPECT_EQ(frame.threads.size(), 1u);
+		DS_EXPECT_GE(frame.Get_Duration_Microseconds(), 1500.0);
+
+		const std::vector<Profile_Node>& nodes = frame.threads[0].nodes;
+		DS_EXPECT_EQ(nodes.size(), 4u);
+
+		// Depth first, in the order the zones first began
+		DS_EXPECT(std::string_view(nodes[0].name) == "Frame");
+		DS_EXPECT(std::string_view(nodes[1].name) == "Update");
+		DS_EXPECT(std::string_view(nodes[2].name) == "Simulate_Physics");
+		DS_EXPECT(std::string_view(nodes[3].name) == "Render");
+		DS_EXPECT_EQ(nodes[0].parent, PROFILE_NO_PARENT);
+		DS_EXPECT_EQ(nodes[1].parent, 0u);
+		DS_EXPECT_EQ(nodes[2].parent, 1u);
+		DS_EXPECT_EQ(nodes[3].parent, 0u);
+		DS_EXPECT_EQ(nodes[2].depth, 2u);
+
+		DS_EXPECT_EQ(nodes[0].call_count, 1u);
+		DS_EXPECT_EQ(nodes[1].call_count, 3u);
+		DS_EXPECT_EQ(nodes[2].call_count, 3u);
+
+		DS_EXPECT_GE(nodes[3].total_microseconds, 1500.0);
+		DS_EXPECT_GE(nodes[0].total_microseconds, nodes[1].total_microseconds + nodes[3].total_microseconds);
+		DS_EXPECT_NEAR(nodes[0].self_microseconds, nodes[0].total_microseconds - nodes[1].total_microseconds - nodes[3].total_microseconds, 0.001);
+		DS_EXPECT_LE(nodes[1].self_microseconds, nodes[1].total_microseconds);
+
+		// An empty frame has no threads
+		ds_u64 index = frame.index;
+		Profiler::Begin_Frame();
+		Profiler::End_Frame();
+		DS_EXPECT_EQ(Profiler::Get_Last_Frame().threads.size(), 0u);
+		DS_EXPECT_EQ(Profiler::Get_Last_Frame().index, index + 1);
+
+		return true;
+	}
+
+	// Test that zones of several threads, including exited ones, reach the frame
+	static ds_bool Test_Worker_Threads()
+	{
+		const ds_u32 thread_count = 4;
+
+		Profiler::Begin_Frame();
+		std::vector<std::thread> threads;
+		for (ds_u32 t = 0; t < thread_count; t++)
+		{
+			threads.emplace_back([t]()
+			{
+				std::string name = "Worker " + std::to_string(t);
+				Profiler::Set_Thread_Name(name);
+				DS_PROFILE_SCOPE("Worker Loop");
+				for (ds_u32 i = 0; i < 100; i++)
+				{
+					DS_PROFILE_SCOPE("Job");
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		Profiler::End_Frame();
+
+		const Profile_Frame& frame = Profiler::Get_Last_Frame();
+		DS_EXPECT_EQ(frame.threads.size(), thread_count);
+		DS_EXPECT_EQ(frame.zones.size(), thread_count * 101u);
+		DS_EXPECT_EQ(frame.dropped_zone_count, 0u);
+
+		std::vector<std::string> names;
+		for (const Profile_Thread& thread : frame.threads)
+		{
+			names.push_back(thread.name);
+			DS_EXPECT_EQ(thread.nodes.size(), 2u);
+			DS_EXPECT_EQ(thread.nodes[1].call_count, 100u);
+			DS_EXPECT_EQ(thread.nodes[1].parent, 0u);
+		}
+		std::sort(names.begin(), names.end());
+		DS_EXPECT(names[0] == "Worker 0");
+		DS_EXPECT(names[3] == "Worker 3");
+
+		// The exited threads' buffers are gone, the next frame is empty
+		Profiler::Begin_Frame();
+		Profiler::End_Frame();
+		DS_EXPECT_EQ(Profiler::Get_Last_Frame().threads.size(), 0u);
+
+		return true;
+	}
+
+	// Test that a full thread buffer drops zones and counts them
+	static ds_bool Test_Dropped_Zones()
+	{
+		Profiler::Shutdown();
+		DS_EXPECT(!Profiler::Is_Initialized());
+
+		// Zones are ignored while the profiler is off
+		{
+			DS_PROFILE_SCOPE("Ignored");
+		}
+
+		Profiler::Initialize(Make_Test_Config(64));
+		Profiler::Begin_Frame();
+		for (ds_u32 i = 0; i < 100; i++)
+		{
+			DS_PROFILE_SCOPE("Overflow");
+		}
+		Profiler::End_Frame();
+
+		const Profile_Frame& frame = Profiler::Get_Last_Frame();
+		DS_EXPECT_EQ(frame.zones.size(), 64u);
+		DS_EXPECT_EQ(frame.dropped_zone_count, 36u);
+		DS_EXPECT_EQ(Profiler::Get_Dropped_Zone_Count(), 36u);
+		DS_EXPECT_EQ(Find_Thread_With_Zone(frame, "Ignored"), PROFILE_NO_PARENT);
+		DS_EXPECT_EQ(frame.Find_Node(frame.threads[0].id, "Overflow")->call_count, 64u);
+
+		// Drained buffers record again in the next frame
+		Profiler::Begin_Frame();
+		{
+			DS_PROFILE_SCOPE("After Overflow");
+		}
+		Profiler::End_Frame();
+		DS_EXPECT_EQ(Profiler::Get_Last_Frame().zones.size(), 1u);
+		DS_EXPECT_EQ(Profiler::Get_Last_Frame().dropped_zone_count, 0u);
+
+		Profiler::Shutdown();
+		Profiler::Initialize(Make_Test_Config(16 * 1024));
+
+		return true;
+	}
+
+	// Test that restarting the profiler while other threads record zones frees no buffer under them
+	static ds_bool Test_Shutdown_While_Recording()
+	{
+		const ds_u32 thread_count = 4;
+
+		std::atomic<bool> stop{ false };
+		std::vector<std::thread> threads;
+		for (ds_u32 t = 0; t < thread_count; t++)
+		{
+			threads.emplace_back([&stop]()
+			{
+				while (!stop.load(std::memory_order_relaxed))
+				{
+					DS_PROFILE_SCOPE("Busy");
+				}
+			});
+		}
+
+		for (ds_u32 i = 0; i < 50; i++)
+		{
+			Profiler::Shutdown();
+			Profiler::Initialize(Make_Test_Config(64));
+		}
+
+		stop.store(true);
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		// Every buffer was either freed by Shutdown or retired by its exited thread
+		Profiler::Begin_Frame();
+		Profiler::End_Frame();
+		Profiler::Begin_Frame();
+		Profiler::End_Frame();
+		DS_EXPECT_EQ(Profiler::Get_Last_Frame().threads.size(), 0u);
+
+		Profiler::Shutdown();
+		Profiler::Initialize(Make_Test_Config(16 * 1024));
+
+		return true;
+	}
+
+	// Test that the Chrome trace has the zones, frames, allocations and counters of a frame
+	static ds_bool Test_Chrome_Trace_Export()
+	{
+		Record_Export_Frame();
+		const Profile_Frame& frame = Profiler::Get_Last_Frame();
+		DS_EXPECT_EQ(frame.zones.size(), 3u);
+		DS_EXPECT_GE(frame.allocations.size(), 4u);
+		DS_EXPECT(frame.allocations[0].size == 64 && !frame.allocations[0].is_free);
+		DS_EXPECT(frame.allocations[1].is_free);
+
+		Chrome_Trace_Exporter::Config config;
+		config.path = "profiler_test_trace.json";
+		{
+			Chrome_Trace_Exporter exporter(config);
+			DS_EXPECT(exporter.Is_Open());
+			exporter.Add_Frame(frame);
+			exporter.Add_Frame(frame);
+			DS_EXPECT_EQ(exporter.Get_Frame_Count(), 2u);
+			DS_EXPECT(exporter.Finish());
+		}
+
+		std::string trace = Read_File(config.path);
+		DS_EXPECT(trace.starts_with("{\"traceEvents\":["));
+		DS_EXPECT(trace.ends_with("],\"displayTimeUnit\":\"ms\"}\n"));
+
+		// Two frames of one frame event and three zones, the thread is named once
+		DS_EXPECT_EQ(Count_Occurrences(trace, "\"ph\":\"X\""), 8u);
+		DS_EXPECT_EQ(Count_Occurrences(trace, "\"args\":{\"name\":\"Main\"}"), 1u);
+		DS_EXPECT_EQ(Count_Occurrences(trace, "\"name\":\"Frame " + std::to_string(frame.index) + "\""), 2u);
+		DS_EXPECT_EQ(Count_Occurrences(trace, "\"cat\":\"streaming\""), 2u);
+		DS_EXPECT_EQ(Count_Occurrences(trace, "\"resource_id\":42"), 2u);
+		DS_EXPECT_EQ(Count_Occurrences(trace, "\"cat\":\"logger\""), 2u);
+		DS_EXPECT_EQ(Count_Occurrences(trace, "\"messages\":3"), 2u);
+
+		// The pool block is allocated and freed in each frame, so its counter returns to 0
+		DS_EXPECT_EQ(Count_Occurrences(trace, "\"name\":\"Test Pool live bytes\",\"ph\":\"C\""), 4u);
+		DS_EXPECT_EQ(Count_Occurrences(trace, "\"args\":{\"bytes\":64}"), 2u);
+		DS_EXPECT_EQ(Count_Occurrences(trace, "\"allocator\":\"Memory\""), 4u);
+		DS_EXPECT_EQ(Count_Occurrences(trace, "\"ph\":\"i\""), frame.allocations.size() * 2);
+
+		std::remove(config.path.c_str());
+		Profiler::Shutdown();
+		Profiler::Initialize(Make_Test_Config(16 * 1024));
+
+		return true;
+	}
+
+	// Test that the Perfetto trace is well formed protobuf with matching slices and counters
+	static ds_bool Test_Perfetto_Trace_Export()
+	{
+		Record_Export_Frame();
+		const Profile_Frame& frame = Profiler::Get_Last_Frame();
+
+		Perfetto_Trace_Exporter::Config config;
+		config.path = "profiler_test_trace.perfetto-trace";
+		{
+			Perfetto_Trace_Exporter exporter(config);
+			exporter.Add_Frame(frame);
+		}
+
+		std::string trace = Read_File(config.path);
+		std::vector<Proto_Field> packets = Read_Message(trace);
+		DS_EXPECT(!packets.empty());
+
+		ds_u64 descriptor_count = 0;
+		ds_u64 open_slices = 0;
+		ds_u64 instant_count = 0;
+		std::vector<ds_u64> counter_values;
+		std::vector<std::string> slice_names;
+		bool named_thread = false;
+
+		for (ds_u64 i = 0; i < packets.size(); i++)
+		{
+			DS_EXPECT_EQ(packets[i].number, 1u);
+			std::vector<Proto_Field> packet = Read_Message(packets[i].bytes);
+			DS_EXPECT(!packet.empty());
+			DS_EXPECT(Find_Field(packet, 10) && Find_Field(packet, 10)->value == 1);
+
+			// Only the first packet clears the incremental state
+			DS_EXPECT_EQ(Find_Field(packet, 13) != nullptr, i == 0);
+
+			if (const Proto_Field* descriptor = Find_Field(packet, 60))
+			{
+				descriptor_count++;
+				std::vector<Proto_Field> track = Read_Message(descriptor->bytes);
+				if (const Proto_Field* thread = Find_Field(track, 4))
+				{
+					std::vector<Proto_Field> thread_descriptor = Read_Message(thread->bytes);
+					const Proto_Field* name = Find_Field(thread_descriptor, 5);
+					named_thread |= name && name->bytes == "Main";
+				}
+				continue;
+			}
+
+			const Proto_Field* event_field = Find_Field(packet, 11);
+			DS_EXPECT(event_field && Find_Field(packet, 8));
+			std::vector<Proto_Field> event = Read_Message(event_field->bytes);
+			switch (Find_Field(event, 9)->value)
+			{
+			case 1:
+				open_slices++;
+				slice_names.emplace_back(Find_Field(event, 23)->bytes);
+				break;
+			case 2:
+				DS_EXPECT_GT(open_slices, 0u);
+				open_slices--;
+				break;
+			case 3:
+				instant_count++;
+				break;
+			case 4:
+				counter_values.push_back(Find_Field(event, 30)->value);
+				break;
+			}
+		}
+
+		// Process, frame and thread tracks and a counter track per allocator
+		DS_EXPECT_EQ(descriptor_count, 5u);
+		DS_EXPECT(named_thread);
+		DS_EXPECT_EQ(open_slices, 0u);
+		DS_EXPECT_EQ(slice_names.size(), 4u);
+		DS_EXPECT(slice_names[0] == "Frame " + std::to_string(frame.index));
+		DS_EXPECT(slice_names[1] == "Frame");
+		DS_EXPECT(slice_names[2] == "Streaming Load");
+		DS_EXPECT(slice_names[3] == "Log Flush");
+		DS_EXPECT_EQ(instant_count, frame.allocations.size());
+		DS_EXPECT_EQ(counter_values.size(), frame.allocations.size());
+		DS_EXPECT_EQ(counter_values[0], 64u);
+		DS_EXPECT_EQ(counter_values[1], 0u);
+
+		std::remove(config.path.c_str());
+		Profiler::Shutdown();
+		Profiler::Initialize(Make_Test_Config(16 * 1024));
+
+		return true;
+	}
+
+	// Add all tests to the test suite
+	static ds_bool Add_All_Tests(Test_Suite& test_suite)
+	{
+		DS_TEST(test_suite, "Clock Calibration")
+		{
+			return Test_Clock_Calibration();
+		});
+
+		DS_TEST(test_suite, "Frame Call Tree")
+		{
+			return Test_Frame_Call_Tree();
+		});
+
+		DS_TEST(test_suite, "Worker Threads")
+		{
+			return Test_Worker_Threads();
+		});
+
+		DS_TEST(test_suite, "Dropped Zones")
+		{
+			return Test_Dropped_Zones();
+		});
+
+		DS_TEST(test_suite, "Shutdown While Recording")
+		{
+			return Test_Shutdown_While_Recording();
+		});
+
+		DS_TEST(test_suite, "Chrome Trace Export")
+		{
+			return Test_Chrome_Trace_Export();
+		});
+
+		DS_TEST(test_suite, "Perfetto Trace Export")
+		{
+			return Test_Perfetto_Trace_Export();
+		});
+
+		return true;
+	}
+}
@@ -0,0 +1,32 @@
+#include <core/ds_pch.h>
+#include <core/defines.h>
+#include <core/profiler/profiler.h>
+#include <test_framework.h>
+
+#include <profiler_tests.h>
+
+using namespace ds::core::profiler;
+using namespace ds::test;
+using namespace ds;
+
+// Run all profiler tests
+int main(int argc, char** argv)
+{
+	return Test_Runner::Run_Tests([]()
+	{
+		// The logger thread records its flushes as zones, keep it out of the tested frames
+		ds::core::Logger::Get_Instance().Set_Synchronous_Mode(true);
+
+		Profiler::Initialize(ds::test::profiler::Make_Test_Config(16 * 1024));
+
+		Test_Suite profiler_tests("Core Profiler Tests");
+
+		ds::test::profiler::Add_All_Tests(profiler_tests);
+
+		bool result = profiler_tests.Run_All();
+
+		Profiler::Shutdown();
+
+		return result;
+	});
+}
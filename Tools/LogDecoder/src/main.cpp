@@ -0,0 +1,268 @@
+#include <core/ds_pch.h>
+#include <core/logger/binary_log.h>
+#include <core/logger/crash_log.h>
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+/**
+ * DsLogDecoder - Decodes binary log files written by Binary_Log_Sink and crash logs
+ * written by Logger::Enable_Crash_Log
+ *
+ * Usage: DsLogDecoder [--json] [--monotonic] <file>
+ *
+ * Text output matches the lines of ds.log. JSON output is one object per line with the
+ * message fields, and for binary logs the format string and the arguments of deferred messages.
+ */
+
+namespace
+{
+    // Helper function to format a time like the logger does
+    void Append_Time(std::string& out, const ds::core::Log_Time& time, bool monotonic)
+    {
+        std::time_t seconds = static_cast<std::time_t>(time.timestamp / 1000000000ll);
+        std::tm local_time{};
+#ifdef DS_PLATFORM_WINDOWS
+        localtime_s(&local_time, &seconds);
+#else
+        localtime_r(&seconds, &local_time);
+#endif
+        char text[64];
+        ds::ds_u64 length = std::strftime(text, sizeof(text), "[%Y-%m-%d %H:%M:%S", &local_time);
+        out.append(text, length);
+
+        if (monotonic)
+        {
+            std::snprintf(text, sizeof(text), " +%llu.%06llu",
+                static_cast<unsigned long long>(time.monotonic_microseconds / 1000000),
+                static_cast<unsigned long long>(time.monotonic_microseconds % 1000000));
+            out.append(text);
+        }
+        out += ']';
+    }
+
+    // Helper function to append a JSON string literal
+    void Append_Json_String(std::string& out, std::string_view text)
+    {
+        out += '"';
+        for (char c : text)
+        {
+            switch (c)
+            {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\r':
+                out += "\\r";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                    out += escaped;
+                }
+                else
+                {
+                    out += c;
+                }
+            }
+        }
+        out += '"';
+    }
+
+    // Helper function to append a packed argument as a JSON value
+    void Append_Json_Argument(std::string& out, const ds::core::Log_Argument_Value& value)
+    {
+        std::visit([&](const auto& argument) {
+            using T = std::decay_t<decltype(argument)>;
+            if constexpr (std::is_same_v<T, bool>) {
+                out += argument ? "true" : "false";
+            }
+            else if constexpr (std::is_same_v<T, char>) {
+                Append_Json_String(out, std::string_view(&argument, 1));
+            }
+            else if constexpr (std::is_same_v<T, std::string_view>) {
+                Append_Json_String(out, argument);
+            }
+            else if constexpr (std::is_same_v<T, const void*>) {
+                Append_Json_String(out, std::format("{}", argument));
+            }
+            else if constexpr (std::is_floating_point_v<T>) {
+                // JSON has no NaN or infinity
+                if (argument != argument || argument - argument != 0) {
+                    out += "null";
+                }
+                else {
+                    out += std::format("{}", argument);
+                }
+            }
+            else {
+                out += std::format("{}", argument);
+            }
+        }, value);
+    }
+
+    void Append_Json_Message(std::string& out, const ds::core::Log_Message& message, bool monotonic)
+    {
+        std::string_view level = ds::core::Logger::Get_Level_Name(message.level);
+
+        std::string time_text;
+        Append_Time(time_text, message.time, monotonic);
+
+        out += "{\"time\":";
+        Append_Json_String(out, std::string_view(time_text).substr(1, time_text.size() - 2));
+        out += std::format(",\"timestamp\":{},\"monotonic_us\":{},\"level\":", message.time.timestamp, message.time.monotonic_microseconds);
+        Append_Json_String(out, level.substr(1, level.size() - 2));
+        out += ",\"channel\":";
+        Append_Json_String(out, ds::core::Logger::Get_Channel_Name(message.channel));
+        out += ",\"message\":";
+        std::string text;
+        ds::core::Log_Sink::Append_Without_Ansi(text, message.text);
+        Append_Json_String(out, text);
+
+        if (message.arguments)
+        {
+            out += ",\"format\":";
+            Append_Json_String(out, message.format);
+            out += ",\"args\":[";
+
+            const ds::ds_u8* argument = message.arguments;
+            const ds::ds_u8* end = message.arguments + message.arguments_size;
+            ds::core::Log_Argument_Value value;
+            bool first = true;
+            while (argument < end && ds::core::Unpack_Tagged_Log_Argument(argument, end, value))
+            {
+                if (!first)
+                {
+                    out += ',';
+                }
+                Append_Json_Argument(out, value);
+                first = false;
+            }
+            out += ']';
+        }
+
+        out += "}\n";
+    }
+
+    void Append_Text_Message(std::string& out, ds::core::Log_Message& message, bool monotonic)
+    {
+        std::string time_text;
+        Append_Time(time_text, message.time, monotonic);
+        message.time_text = time_text;
+
+        ds::core::Log_Sink::Append_Prefix(out, message);
+        ds::core::Log_Sink::Append_Without_Ansi(out, message.text);
+        out += '\n';
+    }
+
+    // Helper function to write every message of a reader to standard output
+    template<typename Reader>
+    void Decode(Reader& reader, bool json, bool monotonic)
+    {
+        std::string out;
+        ds::core::Log_Message message;
+        while (reader.Next(message))
+        {
+            if (json)
+            {
+                Append_Json_Message(out, message, monotonic);
+            }
+            else
+            {
+                Append_Text_Message(out, message, monotonic);
+            }
+
+            if (out.size() >= 64 * 1024)
+            {
+                std::cout.write(out.data(), static_cast<std::streamsize>(out.size()));
+                out.clear();
+            }
+        }
+        std::cout.write(out.data(), static_cast<std::streamsize>(out.size()));
+        std::cout.flush();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    bool monotonic = false;
+    const char* path = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string_view argument = argv[i];
+        if (argument == "--json")
+        {
+            json = true;
+        }
+        else if (argument == "--monotonic")
+        {
+            monotonic = true;
+        }
+        else if (!path && !argument.starts_with("--"))
+        {
+            path = argv[i];
+        }
+        else
+        {
+            path = nullptr;
+            break;
+        }
+    }
+
+    if (!path)
+    {
+        std::cerr << "Usage: DsLogDecoder [--json] [--monotonic] <file>" << std::endl;
+        return 1;
+    }
+
+    // Crash logs are told apart by their magic, everything else is read as a binary log
+    char magic[sizeof(ds::core::CRASH_LOG_MAGIC)] = {};
+    std::ifstream(path, std::ios::binary).read(magic, sizeof(magic));
+    if (std::memcmp(magic, ds::core::CRASH_LOG_MAGIC, sizeof(magic)) == 0)
+    {
+        ds::core::Crash_Log_Reader reader;
+        if (!reader.Open(path))
+        {
+            std::cerr << "DsLogDecoder: " << path << " is not a readable crash log" << std::endl;
+            return 1;
+        }
+
+        Decode(reader, json, monotonic);
+        return 0;
+    }
+
+    ds::core::Binary_Log_Reader reader;
+    if (!reader.Open(path))
+    {
+        std::cerr << "DsLogDecoder: " << path << " is not a readable binary log" << std::endl;
+        return 1;
+    }
+
+    Decode(reader, json, monotonic);
+
+    // Expected for the file of a process that crashed, everything before the damage was decoded
+    if (reader.Is_Truncated())
+    {
+        std::cerr << "DsLogDecoder: " << path << " ends with an incomplete entry" << std::endl;
+    }
+
+    return 0;
+}
@@ -66,12 +66,15 @@ group "Tests"
     include "Test/TestFramework"
     include "Test/MemoryTests"
     include "Test/ContainerTests"
+    include "Test/AlgorithmTests"
     include "Test/LoggerTests"
+    include "Test/ProfilerTests"
 group ""
 
--- Include the editor project
+-- Include the editor and tool projects
 group "Tools"
     include "Tools/Editor"
+    include "Tools/LogDecoder"
 group ""
 
 -- Include examples